@@ -467,6 +467,7 @@ void GDExtension::_register_extension_class_internal(GDExtensionClassLibraryPtr
 	}
 #endif // DISABLE_DEPRECATED
 	extension->gdextension.notification2 = p_extension_funcs->notification_func;
+	extension->gdextension.process_batch = nullptr; // Registered separately, after the class.
 	extension->gdextension.to_string = p_extension_funcs->to_string_func;
 	extension->gdextension.reference = p_extension_funcs->reference_func;
 	extension->gdextension.unreference = p_extension_funcs->unreference_func;
@@ -659,6 +660,24 @@ void GDExtension::_register_extension_class_signal(GDExtensionClassLibraryPtr p_
 	ClassDB::add_signal(class_name, s);
 }
 
+void GDExtension::_register_extension_class_process_batch(GDExtensionClassLibraryPtr p_library, GDExtensionConstStringNamePtr p_class_name, GDExtensionClassProcessBatch p_process_batch_func) {
+	GDExtension *self = reinterpret_cast<GDExtension *>(p_library);
+
+	StringName class_name = *reinterpret_cast<const StringName *>(p_class_name);
+	ERR_FAIL_COND_MSG(!self->extension_classes.has(class_name), vformat("Attempt to register process batch function for unexisting class '%s'.", class_name));
+
+	Extension *extension = &self->extension_classes[class_name];
+#ifdef TOOLS_ENABLED
+	// If the extension is still marked as reloading, that means it failed to register again.
+	if (extension->is_reloading) {
+		return;
+	}
+#endif
+
+	ERR_FAIL_COND_MSG(!ClassDB::is_parent_class(class_name, SNAME("Node")), vformat("Process batch functions can only be registered for classes inheriting Node, '%s' doesn't.", class_name));
+	extension->gdextension.process_batch = p_process_batch_func;
+}
+
 void GDExtension::_unregister_extension_class(GDExtensionClassLibraryPtr p_library, GDExtensionConstStringNamePtr p_class_name) {
 	GDExtension *self = reinterpret_cast<GDExtension *>(p_library);
 
@@ -834,6 +853,7 @@ void GDExtension::initialize_gdextensions() {
 	register_interface_function("classdb_register_extension_class_property_group", (GDExtensionInterfaceFunctionPtr)&GDExtension::_register_extension_class_property_group);
 	register_interface_function("classdb_register_extension_class_property_subgroup", (GDExtensionInterfaceFunctionPtr)&GDExtension::_register_extension_class_property_subgroup);
 	register_interface_function("classdb_register_extension_class_signal", (GDExtensionInterfaceFunctionPtr)&GDExtension::_register_extension_class_signal);
+	register_interface_function("classdb_register_extension_class_process_batch", (GDExtensionInterfaceFunctionPtr)&GDExtension::_register_extension_class_process_batch);
 	register_interface_function("classdb_unregister_extension_class", (GDExtensionInterfaceFunctionPtr)&GDExtension::_unregister_extension_class);
 	register_interface_function("get_library_path", (GDExtensionInterfaceFunctionPtr)&GDExtension::_get_library_path);
 	register_interface_function("editor_register_get_classes_used_callback", (GDExtensionInterfaceFunctionPtr)&GDExtension::_register_get_classes_used_callback);
@@ -191,6 +191,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *borrow_buffer(uint64_t p_length) const { return nullptr; } ///< get a read-only view of the next p_length bytes without copying them, and advance the position; returns nullptr (without advancing) when unsupported or when fewer bytes are left, use get_buffer then. The view is valid while the file is open.
+	virtual const uint8_t *map_read_only() { return nullptr; } ///< map the whole file read-only in memory, valid until the file is closed; returns nullptr when unsupported.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -46,6 +46,35 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
+void PackedData::remove_pack(const String &p_path) {
+	for (const String &path : get_file_paths()) {
+		HashMap<PathMD5, PackedFile, PathMD5>::ConstIterator E = files.find(PathMD5(path.simplify_path().trim_prefix("res://").md5_buffer()));
+		if (E && E->value.pack == p_path) {
+			remove_path(path);
+		}
+	}
+	_remove_empty_packed_dirs(root);
+
+	LocalVector<PathMD5> patchless_paths;
+	for (KeyValue<PathMD5, Vector<PackedFile>> &E : delta_patches) {
+		for (int i = E.value.size() - 1; i >= 0; i--) {
+			if (E.value[i].pack == p_path) {
+				E.value.remove_at(i);
+			}
+		}
+		if (E.value.is_empty()) {
+			patchless_paths.push_back(E.key);
+		}
+	}
+	for (const PathMD5 &pmd5 : patchless_paths) {
+		delta_patches.erase(pmd5);
+	}
+
+	for (PackSource *source : sources) {
+		source->remove_pack(p_path);
+	}
+}
+
 void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
@@ -194,6 +223,20 @@ PackedData::PackedData() {
 	add_pack_source(memnew(PackedSourcePCK));
 }
 
+void PackedData::_remove_empty_packed_dirs(PackedDir *p_dir) {
+	LocalVector<String> empty_dirs;
+	for (const KeyValue<String, PackedDir *> &E : p_dir->subdirs) {
+		_remove_empty_packed_dirs(E.value);
+		if (E.value->files.is_empty() && E.value->subdirs.is_empty()) {
+			empty_dirs.push_back(E.key);
+		}
+	}
+	for (const String &dir : empty_dirs) {
+		memdelete(p_dir->subdirs[dir]);
+		p_dir->subdirs.erase(dir);
+	}
+}
+
 void PackedData::_free_packed_dirs(PackedDir *p_dir) {
 	for (const KeyValue<String, PackedDir *> &E : p_dir->subdirs) {
 		_free_packed_dirs(E.value);
@@ -354,11 +397,46 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		}
 	}
 
+	if (!sparse_bundle && PackedData::get_singleton()->is_using_memory_mapping()) {
+		_map_pack(p_path);
+	}
+
 	return true;
 }
 
+void PackedSourcePCK::_map_pack(const String &p_path) {
+	// Always map again, the pack may have been replaced on disk since it was last added.
+	mapped_packs.erase(p_path);
+
+	MappedPack mp;
+	mp.file = FileAccess::open(p_path, FileAccess::READ);
+	if (mp.file.is_null()) {
+		return;
+	}
+	mp.data = mp.file->map_read_only();
+	if (!mp.data) {
+		return; // Not supported, files will be read through regular file access.
+	}
+	mp.size = mp.file->get_length();
+	mapped_packs.insert(p_path, mp);
+}
+
+void PackedSourcePCK::remove_pack(const String &p_path) {
+	mapped_packs.erase(p_path);
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	Ref<FileAccess> file(memnew(FileAccessPack(p_path, *p_file)));
+	Ref<FileAccess> file;
+
+	if (!p_file->encrypted && !p_file->bundle && PackedData::get_singleton()->is_using_memory_mapping()) {
+		HashMap<String, MappedPack>::ConstIterator E = mapped_packs.find(p_file->pack);
+		if (E && p_file->offset <= E->value.size && p_file->size <= E->value.size - p_file->offset) {
+			file = Ref<FileAccess>(memnew(FileAccessPack(p_path, *p_file, E->value.file, E->value.data + p_file->offset)));
+		}
+	}
+	if (file.is_null()) {
+		file = Ref<FileAccess>(memnew(FileAccessPack(p_path, *p_file)));
+	}
 
 	if (PackedData::get_singleton()->has_delta_patches(p_path)) {
 		Ref<FileAccessPatched> file_patched;
@@ -417,7 +495,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped_data) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -425,7 +505,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -433,7 +513,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -454,7 +536,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped_data, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -467,21 +549,38 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	uint64_t from = pos;
 	pos += to_read;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + from, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::borrow_buffer(uint64_t p_length) const {
+	if (!mapped_data || eof || pos > pf.size || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *ptr = mapped_data + pos;
+	pos += p_length;
+	return ptr;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -505,6 +604,8 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapping = Ref<FileAccess>();
+	mapped_data = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) {
@@ -542,6 +643,16 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 	eof = false;
 }
 
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapping, const uint8_t *p_mapped_data) {
+	path = p_path;
+	pf = p_file;
+	mapping = p_mapping;
+	mapped_data = p_mapped_data;
+	off = pf.offset;
+	pos = 0;
+	eof = false;
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // DIR ACCESS
 //////////////////////////////////////////////////////////////////////////////////
@@ -113,8 +113,10 @@ private:
 
 	static inline PackedData *singleton = nullptr;
 	bool disabled = false;
+	bool use_memory_mapping = true;
 
 	void _free_packed_dirs(PackedDir *p_dir);
+	void _remove_empty_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
 
 public:
@@ -129,8 +131,16 @@ public:
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
 
+	// When enabled, PCK files are mapped in memory when supported by the platform,
+	// so pack-referenced files are read (and can be borrowed) straight from the mapping.
+	void set_use_memory_mapping(bool p_enable) { use_memory_mapping = p_enable; }
+	_FORCE_INLINE_ bool is_using_memory_mapping() const { return use_memory_mapping; }
+
 	static PackedData *get_singleton() { return singleton; }
 	Error add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset);
+	// Removes the files added from this pack and lets the sources release it.
+	// Files of other packs that it replaced are not restored.
+	void remove_pack(const String &p_path);
 
 	void clear();
 
@@ -150,13 +160,25 @@ class PackSource {
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) = 0;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) = 0;
+	virtual void remove_pack(const String &p_path) {}
 	virtual ~PackSource() {}
 };
 
 class PackedSourcePCK : public PackSource {
+	struct MappedPack {
+		Ref<FileAccess> file; // Owns the mapping.
+		const uint8_t *data = nullptr;
+		uint64_t size = 0;
+	};
+
+	HashMap<String, MappedPack> mapped_packs;
+
+	void _map_pack(const String &p_path);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
+	virtual void remove_pack(const String &p_path) override;
 };
 
 class PackedSourceDirectory : public PackSource {
@@ -177,6 +199,11 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Set instead of `f` when reading from a memory mapped pack.
+	Ref<FileAccess> mapping;
+	const uint8_t *mapped_data = nullptr;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -203,6 +230,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *borrow_buffer(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -217,6 +245,7 @@ public:
 	virtual void close() override;
 
 	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapping, const uint8_t *p_mapped_data);
 };
 
 int64_t PackedData::get_size(const String &p_path) {
@@ -32,6 +32,8 @@
 
 #include "core/config/engine.h"
 #include "core/io/file_access.h"
+#include "core/io/stream_peer.h"
+#include "core/math/simd.h"
 #include "core/object/script_language.h"
 #include "core/variant/container_type_validate.h"
 
@@ -559,6 +561,520 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 	return ERR_PARSE_ERROR;
 }
 
+// Returns the first '"', '\\' or null byte in the range, or `p_end` if there is none.
+// String contents make up most of a typical payload, so they are skipped 16 bytes at a time.
+static _FORCE_INLINE_ const uint8_t *_find_string_special(const uint8_t *p_ptr, const uint8_t *p_end) {
+#if defined(SIMD_SSE2_ENABLED)
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i zero = _mm_setzero_si128();
+	while (p_end - p_ptr >= 16) {
+		const __m128i chunk = _mm_loadu_si128((const __m128i *)p_ptr);
+		const __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), _mm_cmpeq_epi8(chunk, zero));
+		if (_mm_movemask_epi8(hits)) {
+			break;
+		}
+		p_ptr += 16;
+	}
+#elif defined(SIMD_NEON_ENABLED)
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	while (p_end - p_ptr >= 16) {
+		const uint8x16_t chunk = vld1q_u8(p_ptr);
+		const uint8x16_t hits = vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)), vceqzq_u8(chunk));
+		if (vmaxvq_u8(hits)) {
+			break;
+		}
+		p_ptr += 16;
+	}
+#endif
+	while (p_ptr < p_end && *p_ptr != '"' && *p_ptr != '\\' && *p_ptr != 0) {
+		p_ptr++;
+	}
+	return p_ptr;
+}
+
+static _FORCE_INLINE_ bool _is_scalar_terminator(uint8_t p_char) {
+	switch (p_char) {
+		case '{':
+		case '}':
+		case '[':
+		case ']':
+		case ':':
+		case ',':
+		case '"':
+			return true;
+		default:
+			return p_char <= 32;
+	}
+}
+
+static bool _parse_hex_utf8(const uint8_t *p_ptr, const uint8_t *p_end, char32_t &r_value, String &r_err_str) {
+	if (p_end - p_ptr < 4) {
+		r_err_str = "Unterminated string";
+		return false;
+	}
+	r_value = 0;
+	for (int j = 0; j < 4; j++) {
+		const char32_t c = p_ptr[j];
+		if (c == 0) {
+			r_err_str = "Unterminated string";
+			return false;
+		}
+		if (!is_hex_digit(c)) {
+			r_err_str = "Malformed hex constant in string";
+			return false;
+		}
+		r_value <<= 4;
+		if (is_digit(c)) {
+			r_value |= c - '0';
+		} else {
+			r_value |= (c | 0x20) - 'a' + 10;
+		}
+	}
+	return true;
+}
+
+// Stage one: record the offset of every structural character, string and scalar
+// so the second stage never has to look at whitespace or string contents again.
+// Returns the end offset of the first complete top-level value when
+// `p_stop_at_value_end` is set and one was found, or -1.
+int64_t JSON::_scan_utf8(const uint8_t *p_buffer, uint32_t p_len, UTF8ScanState &r_state, LocalVector<uint32_t> &r_structurals, bool p_stop_at_value_end) {
+	if (r_state.terminated) {
+		return p_stop_at_value_end && !r_structurals.is_empty() ? int64_t(r_state.length) : -1;
+	}
+
+	uint32_t i = r_state.position;
+	while (i < p_len) {
+		if (r_state.in_string) {
+			if (r_state.escaped) {
+				r_state.escaped = false;
+				i++;
+				continue;
+			}
+			i = _find_string_special(p_buffer + i, p_buffer + p_len) - p_buffer;
+			if (i == p_len) {
+				break;
+			}
+			if (p_buffer[i] == '\\') {
+				r_state.escaped = true;
+				i++;
+				continue;
+			}
+			if (p_buffer[i] == 0) {
+				r_state.terminated = true;
+				break;
+			}
+			r_state.in_string = false;
+			i++;
+			if (p_stop_at_value_end && r_state.depth == 0) {
+				r_state.position = i;
+				return i;
+			}
+			continue;
+		}
+
+		const uint8_t c = p_buffer[i];
+		if (c == 0) {
+			r_state.terminated = true;
+			break;
+		}
+		if (r_state.in_scalar) {
+			if (!_is_scalar_terminator(c)) {
+				i++;
+				continue;
+			}
+			r_state.in_scalar = false;
+			if (p_stop_at_value_end && r_state.depth == 0) {
+				r_state.position = i;
+				return i;
+			}
+		}
+
+		switch (c) {
+			case '{':
+			case '[': {
+				r_structurals.push_back(i);
+				r_state.depth++;
+			} break;
+			case '}':
+			case ']': {
+				r_structurals.push_back(i);
+				r_state.depth--;
+				if (p_stop_at_value_end && r_state.depth <= 0) {
+					r_state.depth = 0;
+					r_state.position = i + 1;
+					return i + 1;
+				}
+			} break;
+			case ':':
+			case ',': {
+				r_structurals.push_back(i);
+			} break;
+			case '"': {
+				r_structurals.push_back(i);
+				r_state.in_string = true;
+			} break;
+			default: {
+				if (c > 32) {
+					r_structurals.push_back(i);
+					r_state.in_scalar = true;
+				}
+			} break;
+		}
+		i++;
+	}
+
+	r_state.position = i;
+	r_state.length = i;
+	if (r_state.terminated) {
+		r_state.in_string = false;
+		r_state.in_scalar = false;
+		return p_stop_at_value_end && !r_structurals.is_empty() ? int64_t(i) : -1;
+	}
+	return -1;
+}
+
+Error JSON::_parse_string_utf8(UTF8Cursor &p_cursor, uint32_t p_offset, Variant &r_value, String &r_err_str) {
+	const uint8_t *ptr = p_cursor.buffer + p_offset;
+	const uint8_t *end = p_cursor.buffer + p_cursor.length;
+
+	const uint8_t *special = _find_string_special(ptr, end);
+	if (special < end && *special == '"') {
+		// Fast path, no escape sequences: decode straight from the buffer.
+		// Invalid sequences are cleaned up and logged, like when decoding a `String`.
+		r_value = String::utf8((const char *)ptr, special - ptr);
+		return OK;
+	}
+
+	LocalVector<char> unescaped;
+	while (true) {
+		special = _find_string_special(ptr, end);
+		for (const uint8_t *c = ptr; c < special; c++) {
+			unescaped.push_back(char(*c));
+		}
+		if (special == end || *special == 0) {
+			p_cursor.error_offset = special - p_cursor.buffer;
+			r_err_str = "Unterminated string";
+			return ERR_PARSE_ERROR;
+		}
+		if (*special == '"') {
+			break;
+		}
+
+		// Escaped characters...
+		ptr = special + 1;
+		p_cursor.error_offset = ptr - p_cursor.buffer;
+		if (ptr == end || *ptr == 0) {
+			r_err_str = "Unterminated string";
+			return ERR_PARSE_ERROR;
+		}
+		char32_t res = 0;
+		switch (*ptr) {
+			case 'b':
+				res = 8;
+				break;
+			case 't':
+				res = 9;
+				break;
+			case 'n':
+				res = 10;
+				break;
+			case 'f':
+				res = 12;
+				break;
+			case 'r':
+				res = 13;
+				break;
+			case 'u': {
+				if (!_parse_hex_utf8(ptr + 1, end, res, r_err_str)) {
+					return ERR_PARSE_ERROR;
+				}
+				ptr += 4;
+
+				if ((res & 0xfffffc00) == 0xd800) {
+					if (end - ptr < 3 || ptr[1] != '\\' || ptr[2] != 'u') {
+						r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+						return ERR_PARSE_ERROR;
+					}
+					ptr += 2;
+					char32_t trail = 0;
+					if (!_parse_hex_utf8(ptr + 1, end, trail, r_err_str)) {
+						return ERR_PARSE_ERROR;
+					}
+					if ((trail & 0xfffffc00) == 0xdc00) {
+						res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+						ptr += 4;
+					} else {
+						r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+						return ERR_PARSE_ERROR;
+					}
+				} else if ((res & 0xfffffc00) == 0xdc00) {
+					r_err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+					return ERR_PARSE_ERROR;
+				}
+			} break;
+			case '"':
+			case '\\':
+			case '/': {
+				res = *ptr;
+			} break;
+			default: {
+				r_err_str = "Invalid escape sequence";
+				return ERR_PARSE_ERROR;
+			}
+		}
+		ptr++;
+
+		// Re-encode the escaped code point, the whole string is decoded at once below.
+		if (res < 0x80) {
+			unescaped.push_back(char(res));
+		} else if (res < 0x800) {
+			unescaped.push_back(char(0xc0 | (res >> 6)));
+			unescaped.push_back(char(0x80 | (res & 0x3f)));
+		} else if (res < 0x10000) {
+			unescaped.push_back(char(0xe0 | (res >> 12)));
+			unescaped.push_back(char(0x80 | ((res >> 6) & 0x3f)));
+			unescaped.push_back(char(0x80 | (res & 0x3f)));
+		} else {
+			unescaped.push_back(char(0xf0 | (res >> 18)));
+			unescaped.push_back(char(0x80 | ((res >> 12) & 0x3f)));
+			unescaped.push_back(char(0x80 | ((res >> 6) & 0x3f)));
+			unescaped.push_back(char(0x80 | (res & 0x3f)));
+		}
+	}
+
+	r_value = String::utf8(unescaped.ptr(), unescaped.size());
+	return OK;
+}
+
+Error JSON::_get_token_utf8(UTF8Cursor &p_cursor, Token &r_token, String &r_err_str) {
+	if (p_cursor.next == p_cursor.structural_count) {
+		p_cursor.error_offset = p_cursor.length;
+		r_token.type = TK_EOF;
+		return OK;
+	}
+
+	const uint32_t offset = p_cursor.structurals[p_cursor.next++];
+	p_cursor.error_offset = offset;
+	const uint8_t c = p_cursor.buffer[offset];
+	switch (c) {
+		case '{': {
+			r_token.type = TK_CURLY_BRACKET_OPEN;
+			return OK;
+		}
+		case '}': {
+			r_token.type = TK_CURLY_BRACKET_CLOSE;
+			return OK;
+		}
+		case '[': {
+			r_token.type = TK_BRACKET_OPEN;
+			return OK;
+		}
+		case ']': {
+			r_token.type = TK_BRACKET_CLOSE;
+			return OK;
+		}
+		case ':': {
+			r_token.type = TK_COLON;
+			return OK;
+		}
+		case ',': {
+			r_token.type = TK_COMMA;
+			return OK;
+		}
+		case '"': {
+			r_token.type = TK_STRING;
+			return _parse_string_utf8(p_cursor, offset + 1, r_token.value, r_err_str);
+		}
+		default: {
+			uint32_t end = offset;
+			while (end < p_cursor.length && !_is_scalar_terminator(p_cursor.buffer[end])) {
+				end++;
+			}
+			const char *scalar = (const char *)p_cursor.buffer + offset;
+			const uint32_t scalar_len = end - offset;
+
+			if (c == '-' || is_digit(c)) {
+				// The buffer is not null-terminated, so convert from a terminated copy.
+				char stack_buffer[64];
+				CharString heap_buffer;
+				char *number = stack_buffer;
+				if (scalar_len >= sizeof(stack_buffer)) {
+					heap_buffer.resize_uninitialized(scalar_len + 1);
+					number = heap_buffer.ptrw();
+				}
+				memcpy(number, scalar, scalar_len);
+				number[scalar_len] = 0;
+
+				const char *number_end = nullptr;
+				const double value = String::to_float(number, &number_end);
+				if (number_end != number + scalar_len) {
+					p_cursor.error_offset = offset + (number_end - number);
+					r_err_str = "Unexpected character";
+					return ERR_PARSE_ERROR;
+				}
+				r_token.type = TK_NUMBER;
+				r_token.value = value;
+				return OK;
+			}
+
+			for (uint32_t i = 0; i < scalar_len; i++) {
+				if (!is_ascii_alphabet_char(scalar[i])) {
+					p_cursor.error_offset = offset + i;
+					r_err_str = "Unexpected character";
+					return ERR_PARSE_ERROR;
+				}
+			}
+			r_token.type = TK_IDENTIFIER;
+			r_token.value = String::ascii(Span(scalar, scalar_len));
+			return OK;
+		}
+	}
+}
+
+Error JSON::_parse_value_utf8(Variant &value, Token &token, UTF8Cursor &p_cursor, int p_depth, String &r_err_str) {
+	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+		r_err_str = "JSON structure is too deep";
+		return ERR_OUT_OF_MEMORY;
+	}
+
+	if (token.type == TK_CURLY_BRACKET_OPEN) {
+		Dictionary d;
+		Error err = _parse_object_utf8(d, p_cursor, p_depth + 1, r_err_str);
+		if (err) {
+			return err;
+		}
+		value = d;
+	} else if (token.type == TK_BRACKET_OPEN) {
+		Array a;
+		Error err = _parse_array_utf8(a, p_cursor, p_depth + 1, r_err_str);
+		if (err) {
+			return err;
+		}
+		value = a;
+	} else if (token.type == TK_IDENTIFIER) {
+		String id = token.value;
+		if (id == "true") {
+			value = true;
+		} else if (id == "false") {
+			value = false;
+		} else if (id == "null") {
+			value = Variant();
+		} else {
+			r_err_str = vformat("Expected 'true', 'false', or 'null', got '%s'", id);
+			return ERR_PARSE_ERROR;
+		}
+	} else if (token.type == TK_NUMBER) {
+		value = token.value;
+	} else if (token.type == TK_STRING) {
+		value = token.value;
+	} else {
+		r_err_str = vformat("Expected value, got '%s'", String(tk_name[token.type]));
+		return ERR_PARSE_ERROR;
+	}
+
+	return OK;
+}
+
+Error JSON::_parse_array_utf8(Array &array, UTF8Cursor &p_cursor, int p_depth, String &r_err_str) {
+	Token token;
+	bool need_comma = false;
+
+	while (p_cursor.next < p_cursor.structural_count) {
+		Error err = _get_token_utf8(p_cursor, token, r_err_str);
+		if (err != OK) {
+			return err;
+		}
+
+		if (token.type == TK_BRACKET_CLOSE) {
+			return OK;
+		}
+
+		if (need_comma) {
+			if (token.type != TK_COMMA) {
+				r_err_str = "Expected ','";
+				return ERR_PARSE_ERROR;
+			} else {
+				need_comma = false;
+				continue;
+			}
+		}
+
+		Variant v;
+		err = _parse_value_utf8(v, token, p_cursor, p_depth, r_err_str);
+		if (err) {
+			return err;
+		}
+
+		array.push_back(v);
+		need_comma = true;
+	}
+
+	p_cursor.error_offset = p_cursor.length;
+	r_err_str = "Expected ']'";
+	return ERR_PARSE_ERROR;
+}
+
+Error JSON::_parse_object_utf8(Dictionary &object, UTF8Cursor &p_cursor, int p_depth, String &r_err_str) {
+	String key;
+	Token token;
+	bool need_comma = false;
+
+	while (p_cursor.next < p_cursor.structural_count) {
+		Error err = _get_token_utf8(p_cursor, token, r_err_str);
+		if (err != OK) {
+			return err;
+		}
+
+		if (token.type == TK_CURLY_BRACKET_CLOSE) {
+			return OK;
+		}
+
+		if (need_comma) {
+			if (token.type != TK_COMMA) {
+				r_err_str = "Expected '}' or ','";
+				return ERR_PARSE_ERROR;
+			} else {
+				need_comma = false;
+				continue;
+			}
+		}
+
+		if (token.type != TK_STRING) {
+			r_err_str = "Expected key";
+			return ERR_PARSE_ERROR;
+		}
+
+		key = token.value;
+		err = _get_token_utf8(p_cursor, token, r_err_str);
+		if (err != OK) {
+			return err;
+		}
+		if (token.type != TK_COLON) {
+			r_err_str = "Expected ':'";
+			return ERR_PARSE_ERROR;
+		}
+
+		err = _get_token_utf8(p_cursor, token, r_err_str);
+		if (err != OK) {
+			return err;
+		}
+
+		Variant v;
+		err = _parse_value_utf8(v, token, p_cursor, p_depth, r_err_str);
+		if (err) {
+			return err;
+		}
+		object[key] = v;
+		need_comma = true;
+	}
+
+	p_cursor.error_offset = p_cursor.length;
+	r_err_str = "Expected '}'";
+	return ERR_PARSE_ERROR;
+}
+
 void JSON::set_data(const Variant &p_data) {
 	data = p_data;
 	text.clear();
@@ -606,10 +1122,149 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::_parse_utf8(const uint8_t *p_buffer, uint32_t p_len, const LocalVector<uint32_t> &p_structurals, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	UTF8Cursor cursor;
+	cursor.buffer = p_buffer;
+	cursor.length = p_len;
+	cursor.structurals = p_structurals.ptr();
+	cursor.structural_count = p_structurals.size();
+	r_err_line = 0;
+
+	Token token;
+	Error err = _get_token_utf8(cursor, token, r_err_str);
+	if (err == OK) {
+		err = _parse_value_utf8(r_ret, token, cursor, 0, r_err_str);
+	}
+
+	// Check if EOF is reached.
+	if (err == OK && cursor.next < cursor.structural_count) {
+		cursor.error_offset = p_structurals[cursor.next];
+		r_err_str = "Expected 'EOF'";
+		err = ERR_PARSE_ERROR;
+	}
+
+	if (err != OK) {
+		// Reset return value to empty `Variant`
+		r_ret = Variant();
+		// Lines are only needed for errors, so count them lazily.
+		for (uint32_t i = 0; i < cursor.error_offset && i < p_len; i++) {
+			if (p_buffer[i] == '\n') {
+				r_err_line++;
+			}
+		}
+	}
+	return err;
+}
+
+Error JSON::parse_utf8(const PackedByteArray &p_json_buffer, bool p_keep_text) {
+	const uint8_t *buffer = p_json_buffer.ptr();
+	uint32_t len = p_json_buffer.size();
+	// Skip the UTF-8 byte order mark, like `String::utf8()` does.
+	if (len >= 3 && buffer[0] == 0xef && buffer[1] == 0xbb && buffer[2] == 0xbf) {
+		buffer += 3;
+		len -= 3;
+	}
+
+	UTF8ScanState state;
+	LocalVector<uint32_t> structurals;
+	_scan_utf8(buffer, len, state, structurals, false);
+
+	Error err = _parse_utf8(buffer, state.length, structurals, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text = String::utf8((const char *)buffer, len);
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
 
+void JSON::begin_stream(bool p_keep_text) {
+	stream_buffer.clear();
+	stream_structurals.clear();
+	stream_state = UTF8ScanState();
+	stream_keep_text = p_keep_text;
+}
+
+Error JSON::_parse_stream(bool p_finish) {
+	int64_t end = _scan_utf8(stream_buffer.ptr(), stream_buffer.size(), stream_state, stream_structurals, true);
+	if (end < 0) {
+		if (!p_finish) {
+			return ERR_BUSY;
+		}
+		if (stream_structurals.is_empty()) {
+			// Only whitespace was left after the last value.
+			begin_stream(stream_keep_text);
+			return ERR_FILE_EOF;
+		}
+		end = stream_state.length;
+	}
+
+	Error err = _parse_utf8(stream_buffer.ptr(), end, stream_structurals, data, err_str, err_line);
+	if (err == OK) {
+		err_line = 0;
+	}
+	if (stream_keep_text) {
+		text = String::utf8((const char *)stream_buffer.ptr(), end);
+	}
+
+	if (err != OK || stream_state.terminated) {
+		// Nothing after an error or a null byte can be parsed reliably.
+		begin_stream(stream_keep_text);
+		return err;
+	}
+
+	// Keep the bytes following the value, they are the start of the next one.
+	const uint32_t remaining = stream_buffer.size() - end;
+	if (remaining > 0) {
+		memmove(stream_buffer.ptr(), stream_buffer.ptr() + end, remaining);
+	}
+	stream_buffer.resize(remaining);
+	stream_structurals.clear();
+	stream_state = UTF8ScanState();
+	return OK;
+}
+
+Error JSON::feed_stream(const PackedByteArray &p_chunk) {
+	uint32_t offset = 0;
+	if (stream_buffer.is_empty() && stream_state.position == 0 && p_chunk.size() >= 3 && p_chunk[0] == 0xef && p_chunk[1] == 0xbb && p_chunk[2] == 0xbf) {
+		// Skip the UTF-8 byte order mark.
+		offset = 3;
+	}
+
+	const uint32_t prev_size = stream_buffer.size();
+	stream_buffer.resize(prev_size + p_chunk.size() - offset);
+	if (p_chunk.size() > int64_t(offset)) {
+		memcpy(stream_buffer.ptr() + prev_size, p_chunk.ptr() + offset, p_chunk.size() - offset);
+	}
+	return _parse_stream(false);
+}
+
+Error JSON::feed_stream_from_peer(const Ref<StreamPeer> &p_peer) {
+	ERR_FAIL_COND_V(p_peer.is_null(), ERR_INVALID_PARAMETER);
+
+	const int available = p_peer->get_available_bytes();
+	if (available <= 0) {
+		return _parse_stream(false);
+	}
+
+	PackedByteArray chunk;
+	chunk.resize(available);
+	int received = 0;
+	Error err = p_peer->get_partial_data(chunk.ptrw(), available, received);
+	ERR_FAIL_COND_V(err != OK, err);
+	chunk.resize(received);
+	return feed_stream(chunk);
+}
+
+Error JSON::finish_stream() {
+	return _parse_stream(true);
+}
+
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
 	String result;
 	HashSet<const void *> markers;
@@ -629,6 +1284,12 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8", "json_buffer", "keep_text"), &JSON::parse_utf8, DEFVAL(false));
+
+	ClassDB::bind_method(D_METHOD("begin_stream", "keep_text"), &JSON::begin_stream, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("feed_stream", "chunk"), &JSON::feed_stream);
+	ClassDB::bind_method(D_METHOD("feed_stream_from_peer", "peer"), &JSON::feed_stream_from_peer);
+	ClassDB::bind_method(D_METHOD("finish_stream"), &JSON::finish_stream);
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -1563,7 +2224,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
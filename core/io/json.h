@@ -33,8 +33,11 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
+class StreamPeer;
+
 class JSON : public Resource {
 	GDCLASS(JSON, Resource);
 
@@ -64,11 +67,37 @@ class JSON : public Resource {
 		Variant value;
 	};
 
+	// State of the structural scan over UTF-8 input. Kept between calls so
+	// streamed chunks are only scanned once.
+	struct UTF8ScanState {
+		uint32_t position = 0;
+		uint32_t length = 0;
+		int depth = 0;
+		bool in_string = false;
+		bool escaped = false;
+		bool in_scalar = false;
+		bool terminated = false;
+	};
+
+	struct UTF8Cursor {
+		const uint8_t *buffer = nullptr;
+		uint32_t length = 0;
+		const uint32_t *structurals = nullptr;
+		uint32_t structural_count = 0;
+		uint32_t next = 0;
+		uint32_t error_offset = 0;
+	};
+
 	String text;
 	Variant data;
 	String err_str;
 	int err_line = 0;
 
+	LocalVector<uint8_t> stream_buffer;
+	LocalVector<uint32_t> stream_structurals;
+	UTF8ScanState stream_state;
+	bool stream_keep_text = false;
+
 	static const char *tk_name[];
 
 	static void _add_indent(String &r_result, const String &p_indent, int p_size);
@@ -79,6 +108,16 @@ class JSON : public Resource {
 	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
 
+	static int64_t _scan_utf8(const uint8_t *p_buffer, uint32_t p_len, UTF8ScanState &r_state, LocalVector<uint32_t> &r_structurals, bool p_stop_at_value_end);
+	static Error _get_token_utf8(UTF8Cursor &p_cursor, Token &r_token, String &r_err_str);
+	static Error _parse_string_utf8(UTF8Cursor &p_cursor, uint32_t p_offset, Variant &r_value, String &r_err_str);
+	static Error _parse_value_utf8(Variant &value, Token &token, UTF8Cursor &p_cursor, int p_depth, String &r_err_str);
+	static Error _parse_array_utf8(Array &array, UTF8Cursor &p_cursor, int p_depth, String &r_err_str);
+	static Error _parse_object_utf8(Dictionary &object, UTF8Cursor &p_cursor, int p_depth, String &r_err_str);
+	static Error _parse_utf8(const uint8_t *p_buffer, uint32_t p_len, const LocalVector<uint32_t> &p_structurals, Variant &r_ret, String &r_err_str, int &r_err_line);
+
+	Error _parse_stream(bool p_finish);
+
 	static Variant _from_native(const Variant &p_variant, bool p_full_objects, int p_depth);
 	static Variant _to_native(const Variant &p_json, bool p_allow_objects, int p_depth);
 
@@ -87,8 +126,14 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const PackedByteArray &p_json_buffer, bool p_keep_text = false);
 	String get_parsed_text() const;
 
+	void begin_stream(bool p_keep_text = false);
+	Error feed_stream(const PackedByteArray &p_chunk);
+	Error feed_stream_from_peer(const Ref<StreamPeer> &p_peer);
+	Error finish_stream();
+
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
@@ -33,8 +33,10 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/property_utils.h"
 #include "scene/resources/packed_scene.h"
@@ -408,11 +410,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					const HashMap<String, Ref<Resource>> &index_cache = shared_internal_index_cache ? *shared_internal_index_cache : internal_index_cache;
+					const Ref<Resource> *cached = index_cache.getptr(path);
+					if (!cached) {
 						WARN_PRINT(vformat("Couldn't load resource (no cache): %s.", path));
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = *cached;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
@@ -446,7 +450,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
+						const Ref<ResourceLoader::LoadToken> &load_token = external_resources[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
 							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
@@ -678,212 +682,380 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
+// Creates (or fetches from cache) the resource, leaving the file at the start of its property list.
+// r_res stays null when a cached resource was reused, so there is nothing more to load for it.
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	f->seek(offset);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	String t = get_unicode_string();
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-				internal_resources.write[i].path = path; // Update path.
+	r_missing_resource = nullptr;
+
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					r_missing_resource = memnew(MissingResource);
+					r_missing_resource->set_original_class(t);
+					r_missing_resource->set_recording_properties(true);
+					obj = r_missing_resource;
+				} else {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
+			}
+
+			res = Ref<Resource>(r);
+		}
+	}
+
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
 			}
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		f->seek(offset);
+	r_res = res;
+	return OK;
+}
 
-		String t = get_unicode_string();
+Error ResourceLoaderBinary::_parse_internal_resource_properties(LocalVector<Pair<StringName, Variant>> &r_properties) {
+	int pc = f->get_32();
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	r_properties.resize(pc);
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-		MissingResource *missing_resource = nullptr;
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+		r_properties[j].first = name;
+
+		error = parse_variant(r_properties[j].second);
+		if (error) {
+			return error;
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
-			}
+	}
+	return OK;
+}
 
-			if (res.is_null()) {
-				//did not replace
-
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+void ResourceLoaderBinary::_set_internal_resource_properties(const Ref<Resource> &p_res, MissingResource *p_missing_resource, LocalVector<Pair<StringName, Variant>> &p_properties) {
+	Dictionary missing_resource_properties;
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+	for (Pair<StringName, Variant> &property : p_properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && p_missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
 
-				res = Ref<Resource>(r);
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = p_res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = p_res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+				}
+			}
 		}
 
-		int pc = f->get_32();
+		if (set_valid) {
+			p_res->set(name, value);
+		}
+	}
 
-		//set properties
+	if (p_missing_resource) {
+		p_missing_resource->set_recording_properties(false);
+	}
 
-		Dictionary missing_resource_properties;
+	if (!missing_resource_properties.is_empty()) {
+		p_res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+#ifdef TOOLS_ENABLED
+	p_res->set_edited(false);
+#endif
+}
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+void ResourceLoaderBinary::_decode_internal_resources_task(void *p_userdata) {
+	ThreadedDecode *decode = (ThreadedDecode *)p_userdata;
+	const ResourceLoaderBinary *owner = decode->owner;
+
+	// Each task gets its own reader over the shared data, and its own string buffer.
+	Ref<FileAccessMemory> fa;
+	fa.instantiate();
+	fa->open_custom(decode->data_ptr, decode->data_size);
+	fa->set_big_endian(owner->f->is_big_endian());
+	fa->real_is_double = owner->f->real_is_double;
+
+	ResourceLoaderBinary decoder;
+	decoder.f = fa;
+	decoder.local_path = owner->local_path;
+	decoder.res_path = owner->res_path;
+	decoder.ver_format = owner->ver_format;
+	decoder.using_named_scene_ids = owner->using_named_scene_ids;
+	decoder.string_map = owner->string_map;
+	decoder.external_resources = owner->external_resources;
+	decoder.internal_resources = owner->internal_resources;
+	decoder.remaps = owner->remaps;
+	decoder.cache_mode_for_external = owner->cache_mode_for_external;
+	decoder.shared_internal_index_cache = &owner->internal_index_cache;
+
+	while (true) {
+		uint32_t index = decode->next.postincrement();
+		if (index >= decode->resources.size()) {
+			break;
+		}
+		PendingResource &pending = decode->resources[index];
+		fa->seek(pending.properties_offset - decode->data_offset);
+		decoder.error = OK;
+		pending.error = decoder._parse_internal_resource_properties(pending.properties);
+	}
+}
 
-			Variant value;
+Error ResourceLoaderBinary::_load_threaded() {
+	// Create all the resources upfront, so references between them can be resolved no matter the order
+	// they are decoded in. This part can't run in parallel, since it deals with the resource cache.
+	ThreadedDecode decode;
+	decode.owner = this;
+	decode.resources.reserve(internal_resources.size());
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+	for (int i = 0; i < internal_resources.size(); i++) {
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		Error err = _create_internal_resource(i, res, missing_resource);
+		if (err) {
+			return err;
+		}
+		if (res.is_null()) {
+			continue; // Reused from cache.
+		}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+		PendingResource pr;
+		pr.res = res;
+		pr.missing_resource = missing_resource;
+		pr.properties_offset = f->get_position();
+		decode.resources.push_back(pr);
+	}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+	if (decode.resources.is_empty()) {
+		return ERR_FILE_EOF;
+	}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+	// Bring the data in memory once, so every task can decode from it independently.
+	// Memory mapped files (like resources in a PCK) are decoded in place, without copying.
+	decode.data_offset = decode.resources[0].properties_offset;
+	for (const PendingResource &pr : decode.resources) {
+		decode.data_offset = MIN(decode.data_offset, pr.properties_offset);
+	}
+	decode.data_size = f->get_length() - decode.data_offset;
+	f->seek(decode.data_offset);
+	decode.data_ptr = f->borrow_buffer(decode.data_size);
+	if (!decode.data_ptr) {
+		decode.data.resize(decode.data_size);
+		if (f->get_buffer(decode.data.ptrw(), decode.data_size) != decode.data_size) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V_MSG(error, vformat("'%s': Unexpected end of file when reading internal resources.", local_path));
+		}
+		decode.data_ptr = decode.data.ptr();
+	}
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
-			}
+	uint32_t task_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), decode.resources.size() / THREADED_DECODE_MIN_RESOURCES_PER_TASK);
+	task_count = MAX(task_count, 1u);
+	WorkerThreadPool::TaskID *tasks = (WorkerThreadPool::TaskID *)alloca(sizeof(WorkerThreadPool::TaskID) * task_count);
+	for (uint32_t i = 0; i < task_count; i++) {
+		tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_decode_internal_resources_task, &decode, false, SNAME("ResourceLoaderBinaryDecode"));
+	}
+	for (uint32_t i = 0; i < task_count; i++) {
+		// Waiting from a pool thread (the usual case for threaded loads) is collaborative,
+		// so this thread helps decoding too.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
 
-			if (set_valid) {
-				res->set(name, value);
-			}
+	if (progress) {
+		*progress = 0.5f;
+	}
+
+	// Setting properties runs in file order, so setters can rely on their dependencies being already set up.
+	for (uint32_t i = 0; i < decode.resources.size(); i++) {
+		PendingResource &pr = decode.resources[i];
+		if (pr.error) {
+			error = pr.error;
+			return error;
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		_set_internal_resource_properties(pr.res, pr.missing_resource, pr.properties);
+		pr.properties.clear();
+
+		if (progress) {
+			*progress = 0.5f + 0.5f * (i + 1) / float(decode.resources.size());
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		resource_cache.push_back(pr.res);
+	}
+
+	// The main resource is always the last one, and it's never reused from the cache.
+	f.unref();
+	resource = decode.resources[decode.resources.size() - 1].res;
+	resource->set_as_translation_remapped(translation_remapped);
+	error = OK;
+	return OK;
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
+
+		if (remaps.has(path)) {
+			path = remaps[path];
 		}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		}
+
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		if (external_resources[i].load_token.is_null()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+			}
+		}
+	}
+
+	if (use_sub_threads && internal_resources.size() >= THREADED_DECODE_MIN_RESOURCES_PER_TASK * 2 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		return _load_threaded();
+	}
+
+	LocalVector<Pair<StringName, Variant>> properties;
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		bool main = i == (internal_resources.size() - 1);
+
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		Error err = _create_internal_resource(i, res, missing_resource);
+		if (err) {
+			return err;
+		}
+		if (res.is_null()) {
+			continue; // Reused from cache.
+		}
+
+		//set properties
+
+		err = _parse_internal_resource_properties(properties);
+		if (err) {
+			return err;
+		}
+		_set_internal_resource_properties(res, missing_resource, properties);
+		properties.clear();
 
 		if (progress) {
 			*progress = (i + 1) / float(internal_resources.size());
@@ -33,7 +33,12 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/safe_refcount.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -77,6 +82,25 @@ class ResourceLoaderBinary {
 
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
+	const HashMap<String, Ref<Resource>> *shared_internal_index_cache = nullptr; // Set when decoding on behalf of another loader.
+
+	struct PendingResource {
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	struct ThreadedDecode {
+		const ResourceLoaderBinary *owner = nullptr;
+		LocalVector<PendingResource> resources;
+		Vector<uint8_t> data; // Only used when the data can't be borrowed from the file.
+		const uint8_t *data_ptr = nullptr;
+		uint64_t data_size = 0;
+		uint64_t data_offset = 0;
+		SafeNumeric<uint32_t> next;
+	};
 
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
@@ -91,9 +115,19 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	Error _create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource);
+	Error _parse_internal_resource_properties(LocalVector<Pair<StringName, Variant>> &r_properties);
+	void _set_internal_resource_properties(const Ref<Resource> &p_res, MissingResource *p_missing_resource, LocalVector<Pair<StringName, Variant>> &p_properties);
+
+	static void _decode_internal_resources_task(void *p_userdata);
+	Error _load_threaded();
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
+	// For loads using sub-threads, properties of internal resources are decoded in parallel.
+	static const uint32_t THREADED_DECODE_MIN_RESOURCES_PER_TASK = 8;
+
 	Ref<Resource> get_resource();
 	Error load();
 	void set_translation_remapped(bool p_remapped);
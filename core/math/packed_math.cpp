@@ -0,0 +1,286 @@
+/**************************************************************************/
+/*  packed_math.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "packed_math.h"
+
+#include "core/math/simd.h"
+
+namespace PackedMath {
+
+#if defined(SIMD_SSE2_ENABLED)
+
+#define PACKED_MATH_SIMD
+typedef __m128 f32x4;
+static _FORCE_INLINE_ f32x4 f32x4_load(const float *p_src) { return _mm_loadu_ps(p_src); }
+static _FORCE_INLINE_ void f32x4_store(float *p_dst, f32x4 p_v) { _mm_storeu_ps(p_dst, p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_splat(float p_v) { return _mm_set1_ps(p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_add(f32x4 p_a, f32x4 p_b) { return _mm_add_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_sub(f32x4 p_a, f32x4 p_b) { return _mm_sub_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_mul(f32x4 p_a, f32x4 p_b) { return _mm_mul_ps(p_a, p_b); }
+// Like MIN() and MAX(), these return the second operand when either one is NaN.
+static _FORCE_INLINE_ f32x4 f32x4_min(f32x4 p_a, f32x4 p_b) { return _mm_min_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_max(f32x4 p_a, f32x4 p_b) { return _mm_max_ps(p_a, p_b); }
+
+#elif defined(SIMD_NEON_ENABLED)
+
+#define PACKED_MATH_SIMD
+typedef float32x4_t f32x4;
+static _FORCE_INLINE_ f32x4 f32x4_load(const float *p_src) { return vld1q_f32(p_src); }
+static _FORCE_INLINE_ void f32x4_store(float *p_dst, f32x4 p_v) { vst1q_f32(p_dst, p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_splat(float p_v) { return vdupq_n_f32(p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_add(f32x4 p_a, f32x4 p_b) { return vaddq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_sub(f32x4 p_a, f32x4 p_b) { return vsubq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_mul(f32x4 p_a, f32x4 p_b) { return vmulq_f32(p_a, p_b); }
+// vminq_f32() and vmaxq_f32() return NaN when either operand is NaN. Select
+// with a comparison instead, so NaN gives the second operand like MIN() and MAX().
+static _FORCE_INLINE_ f32x4 f32x4_min(f32x4 p_a, f32x4 p_b) { return vbslq_f32(vcltq_f32(p_a, p_b), p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_max(f32x4 p_a, f32x4 p_b) { return vbslq_f32(vcgtq_f32(p_a, p_b), p_a, p_b); }
+
+#endif
+
+#ifdef PACKED_MATH_SIMD
+static _FORCE_INLINE_ float f32x4_reduce_add(f32x4 p_v) {
+	float lanes[4];
+	f32x4_store(lanes, p_v);
+	return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+#endif
+
+// Scalar versions, used for doubles and for the tail of the float kernels.
+
+template <typename T>
+static _FORCE_INLINE_ void _add(const T *p_a, const T *p_b, T *r_dst, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] = p_a[i] + p_b[i];
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _multiply(const T *p_a, const T *p_b, T *r_dst, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] = p_a[i] * p_b[i];
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _scale(const T *p_a, T p_scalar, T *r_dst, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] = p_a[i] * p_scalar;
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _lerp(const T *p_from, const T *p_to, T p_weight, T *r_dst, int64_t p_start, int64_t p_count) {
+	for (int64_t i = p_start; i < p_count; i++) {
+		r_dst[i] = p_from[i] + (p_to[i] - p_from[i]) * p_weight;
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _min(const T *p_a, const T *p_b, T *r_dst, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] = MIN(p_a[i], p_b[i]);
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _max(const T *p_a, const T *p_b, T *r_dst, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] = MAX(p_a[i], p_b[i]);
+	}
+}
+
+// Reductions keep four independent partial sums so consecutive additions
+// don't wait on each other, matching the lane layout of the SIMD versions.
+
+template <typename T>
+static _FORCE_INLINE_ T _sum(const T *p_a, int64_t p_count) {
+	T partial[4] = {};
+	int64_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		partial[0] += p_a[i + 0];
+		partial[1] += p_a[i + 1];
+		partial[2] += p_a[i + 2];
+		partial[3] += p_a[i + 3];
+	}
+	T ret = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+	for (; i < p_count; i++) {
+		ret += p_a[i];
+	}
+	return ret;
+}
+
+template <typename T>
+static _FORCE_INLINE_ T _dot(const T *p_a, const T *p_b, int64_t p_count) {
+	T partial[4] = {};
+	int64_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		partial[0] += p_a[i + 0] * p_b[i + 0];
+		partial[1] += p_a[i + 1] * p_b[i + 1];
+		partial[2] += p_a[i + 2] * p_b[i + 2];
+		partial[3] += p_a[i + 3] * p_b[i + 3];
+	}
+	T ret = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+	for (; i < p_count; i++) {
+		ret += p_a[i] * p_b[i];
+	}
+	return ret;
+}
+
+void add(const float *p_a, const float *p_b, float *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_MATH_SIMD
+	for (; i + 4 <= p_count; i += 4) {
+		f32x4_store(r_dst + i, f32x4_add(f32x4_load(p_a + i), f32x4_load(p_b + i)));
+	}
+#endif
+	_add(p_a, p_b, r_dst, i, p_count);
+}
+
+void add(const double *p_a, const double *p_b, double *r_dst, int64_t p_count) {
+	_add(p_a, p_b, r_dst, 0, p_count);
+}
+
+void multiply(const float *p_a, const float *p_b, float *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_MATH_SIMD
+	for (; i + 4 <= p_count; i += 4) {
+		f32x4_store(r_dst + i, f32x4_mul(f32x4_load(p_a + i), f32x4_load(p_b + i)));
+	}
+#endif
+	_multiply(p_a, p_b, r_dst, i, p_count);
+}
+
+void multiply(const double *p_a, const double *p_b, double *r_dst, int64_t p_count) {
+	_multiply(p_a, p_b, r_dst, 0, p_count);
+}
+
+void scale(const float *p_a, float p_scalar, float *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_MATH_SIMD
+	const f32x4 scalar = f32x4_splat(p_scalar);
+	for (; i + 4 <= p_count; i += 4) {
+		f32x4_store(r_dst + i, f32x4_mul(f32x4_load(p_a + i), scalar));
+	}
+#endif
+	_scale(p_a, p_scalar, r_dst, i, p_count);
+}
+
+void scale(const double *p_a, double p_scalar, double *r_dst, int64_t p_count) {
+	_scale(p_a, p_scalar, r_dst, 0, p_count);
+}
+
+void lerp(const float *p_from, const float *p_to, float p_weight, float *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_MATH_SIMD
+	const f32x4 weight = f32x4_splat(p_weight);
+	for (; i + 4 <= p_count; i += 4) {
+		const f32x4 from = f32x4_load(p_from + i);
+		f32x4_store(r_dst + i, f32x4_add(from, f32x4_mul(f32x4_sub(f32x4_load(p_to + i), from), weight)));
+	}
+#endif
+	_lerp(p_from, p_to, p_weight, r_dst, i, p_count);
+}
+
+void lerp(const double *p_from, const double *p_to, double p_weight, double *r_dst, int64_t p_count) {
+	_lerp(p_from, p_to, p_weight, r_dst, 0, p_count);
+}
+
+void min(const float *p_a, const float *p_b, float *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_MATH_SIMD
+	for (; i + 4 <= p_count; i += 4) {
+		f32x4_store(r_dst + i, f32x4_min(f32x4_load(p_a + i), f32x4_load(p_b + i)));
+	}
+#endif
+	_min(p_a, p_b, r_dst, i, p_count);
+}
+
+void min(const double *p_a, const double *p_b, double *r_dst, int64_t p_count) {
+	_min(p_a, p_b, r_dst, 0, p_count);
+}
+
+void max(const float *p_a, const float *p_b, float *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_MATH_SIMD
+	for (; i + 4 <= p_count; i += 4) {
+		f32x4_store(r_dst + i, f32x4_max(f32x4_load(p_a + i), f32x4_load(p_b + i)));
+	}
+#endif
+	_max(p_a, p_b, r_dst, i, p_count);
+}
+
+void max(const double *p_a, const double *p_b, double *r_dst, int64_t p_count) {
+	_max(p_a, p_b, r_dst, 0, p_count);
+}
+
+float sum(const float *p_a, int64_t p_count) {
+#ifdef PACKED_MATH_SIMD
+	f32x4 partial = f32x4_splat(0.0f);
+	int64_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		partial = f32x4_add(partial, f32x4_load(p_a + i));
+	}
+	float ret = f32x4_reduce_add(partial);
+	for (; i < p_count; i++) {
+		ret += p_a[i];
+	}
+	return ret;
+#else
+	return _sum(p_a, p_count);
+#endif
+}
+
+double sum(const double *p_a, int64_t p_count) {
+	return _sum(p_a, p_count);
+}
+
+float dot(const float *p_a, const float *p_b, int64_t p_count) {
+#ifdef PACKED_MATH_SIMD
+	f32x4 partial = f32x4_splat(0.0f);
+	int64_t i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		partial = f32x4_add(partial, f32x4_mul(f32x4_load(p_a + i), f32x4_load(p_b + i)));
+	}
+	float ret = f32x4_reduce_add(partial);
+	for (; i < p_count; i++) {
+		ret += p_a[i] * p_b[i];
+	}
+	return ret;
+#else
+	return _dot(p_a, p_b, p_count);
+#endif
+}
+
+double dot(const double *p_a, const double *p_b, int64_t p_count) {
+	return _dot(p_a, p_b, p_count);
+}
+
+} // namespace PackedMath
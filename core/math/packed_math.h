@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  packed_math.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/templates/vector.h"
+
+// Element-wise arithmetic over the contents of packed arrays.
+// The float kernels use SSE2 or NEON where available, the double ones are
+// plain loops the compiler can vectorize.
+namespace PackedMath {
+
+void add(const float *p_a, const float *p_b, float *r_dst, int64_t p_count);
+void add(const double *p_a, const double *p_b, double *r_dst, int64_t p_count);
+void multiply(const float *p_a, const float *p_b, float *r_dst, int64_t p_count);
+void multiply(const double *p_a, const double *p_b, double *r_dst, int64_t p_count);
+void scale(const float *p_a, float p_scalar, float *r_dst, int64_t p_count);
+void scale(const double *p_a, double p_scalar, double *r_dst, int64_t p_count);
+void lerp(const float *p_from, const float *p_to, float p_weight, float *r_dst, int64_t p_count);
+void lerp(const double *p_from, const double *p_to, double p_weight, double *r_dst, int64_t p_count);
+void min(const float *p_a, const float *p_b, float *r_dst, int64_t p_count);
+void min(const double *p_a, const double *p_b, double *r_dst, int64_t p_count);
+void max(const float *p_a, const float *p_b, float *r_dst, int64_t p_count);
+void max(const double *p_a, const double *p_b, double *r_dst, int64_t p_count);
+float sum(const float *p_a, int64_t p_count);
+double sum(const double *p_a, int64_t p_count);
+float dot(const float *p_a, const float *p_b, int64_t p_count);
+double dot(const double *p_a, const double *p_b, int64_t p_count);
+
+// Packed arrays of vectors are operated on as flat arrays of their components.
+template <typename T>
+struct Components {
+	using Scalar = T;
+	static constexpr int64_t COUNT = 1;
+};
+
+template <>
+struct Components<Vector3> {
+	using Scalar = real_t;
+	static constexpr int64_t COUNT = 3;
+	static_assert(sizeof(Vector3) == sizeof(real_t) * 3);
+};
+
+template <typename T>
+_FORCE_INLINE_ const typename Components<T>::Scalar *components(const Vector<T> &p_array) {
+	return reinterpret_cast<const typename Components<T>::Scalar *>(p_array.ptr());
+}
+
+template <typename T>
+_FORCE_INLINE_ int64_t component_count(const Vector<T> &p_array) {
+	return p_array.size() * Components<T>::COUNT;
+}
+
+template <typename T>
+using BinaryKernel = void (*)(const typename Components<T>::Scalar *, const typename Components<T>::Scalar *, typename Components<T>::Scalar *, int64_t);
+
+// The binary operations expect both arrays to have the same size.
+template <typename T>
+Vector<T> apply(const Vector<T> &p_a, const Vector<T> &p_b, BinaryKernel<T> p_kernel) {
+	DEV_ASSERT(p_a.size() == p_b.size());
+	Vector<T> ret;
+	ret.resize_uninitialized(p_a.size());
+	p_kernel(components(p_a), components(p_b), reinterpret_cast<typename Components<T>::Scalar *>(ret.ptrw()), component_count(p_a));
+	return ret;
+}
+
+template <typename T>
+Vector<T> add(const Vector<T> &p_a, const Vector<T> &p_b) {
+	return apply<T>(p_a, p_b, &add);
+}
+
+template <typename T>
+Vector<T> multiply(const Vector<T> &p_a, const Vector<T> &p_b) {
+	return apply<T>(p_a, p_b, &multiply);
+}
+
+template <typename T>
+Vector<T> min(const Vector<T> &p_a, const Vector<T> &p_b) {
+	return apply<T>(p_a, p_b, &min);
+}
+
+template <typename T>
+Vector<T> max(const Vector<T> &p_a, const Vector<T> &p_b) {
+	return apply<T>(p_a, p_b, &max);
+}
+
+template <typename T>
+Vector<T> scale(const Vector<T> &p_a, double p_scalar) {
+	using Scalar = typename Components<T>::Scalar;
+	Vector<T> ret;
+	ret.resize_uninitialized(p_a.size());
+	scale(components(p_a), Scalar(p_scalar), reinterpret_cast<Scalar *>(ret.ptrw()), component_count(p_a));
+	return ret;
+}
+
+template <typename T>
+Vector<T> lerp(const Vector<T> &p_from, const Vector<T> &p_to, double p_weight) {
+	using Scalar = typename Components<T>::Scalar;
+	DEV_ASSERT(p_from.size() == p_to.size());
+	Vector<T> ret;
+	ret.resize_uninitialized(p_from.size());
+	lerp(components(p_from), components(p_to), Scalar(p_weight), reinterpret_cast<Scalar *>(ret.ptrw()), component_count(p_from));
+	return ret;
+}
+
+template <typename T>
+T sum(const Vector<T> &p_a) {
+	return sum(p_a.ptr(), int64_t(p_a.size()));
+}
+
+template <>
+inline Vector3 sum(const Vector<Vector3> &p_a) {
+	Vector3 ret;
+	for (const Vector3 &v : p_a) {
+		ret += v;
+	}
+	return ret;
+}
+
+template <typename T>
+T dot(const Vector<T> &p_a, const Vector<T> &p_b) {
+	DEV_ASSERT(p_a.size() == p_b.size());
+	return dot(p_a.ptr(), p_b.ptr(), int64_t(p_a.size()));
+}
+
+} // namespace PackedMath
@@ -883,7 +883,7 @@ use_script:
 	return scr.is_valid() && scr->is_valid() && scr->is_abstract();
 }
 
-void ClassDB::_add_class(const GDType &p_class, const GDType *p_inherits) {
+void ClassDB::_add_class(const GDType &p_class, const GDType *p_inherits, bool p_declares_callp) {
 	Locker::Lock lock(Locker::STATE_WRITE);
 
 	const StringName &name = p_class.get_name();
@@ -906,6 +906,8 @@ void ClassDB::_add_class(const GDType &p_class, const GDType *p_inherits) {
 	} else {
 		ti.inherits_ptr = nullptr;
 	}
+
+	ti.overrides_callp = p_declares_callp || (ti.inherits_ptr && ti.inherits_ptr->overrides_callp);
 }
 
 static MethodInfo info_from_bind(MethodBind *p_method) {
@@ -2178,6 +2180,14 @@ bool ClassDB::is_class_exposed(const StringName &p_class) {
 	return ti->exposed;
 }
 
+bool ClassDB::overrides_callp(const StringName &p_class) {
+	Locker::Lock lock(Locker::STATE_READ);
+
+	ClassInfo *ti = classes.getptr(p_class);
+	ERR_FAIL_NULL_V_MSG(ti, false, vformat("Cannot get class '%s'.", String(p_class)));
+	return ti->overrides_callp;
+}
+
 bool ClassDB::is_class_reloadable(const StringName &p_class) {
 	Locker::Lock lock(Locker::STATE_READ);
 
@@ -164,6 +164,7 @@ public:
 		bool reloadable = false;
 		bool is_virtual = false;
 		bool is_runtime = false;
+		bool overrides_callp = false; // Set if the class or any of its ancestors overrides `Object::callp()`.
 		// The bool argument indicates the need to postinitialize.
 		Object *(*creation_func)(bool) = nullptr;
 	};
@@ -219,7 +220,7 @@ public:
 	static APIType current_api;
 	static HashMap<APIType, uint32_t> api_hashes_cache;
 
-	static void _add_class(const GDType &p_class, const GDType *p_inherits);
+	static void _add_class(const GDType &p_class, const GDType *p_inherits, bool p_declares_callp);
 
 	static HashMap<StringName, HashMap<StringName, Variant>> default_values;
 	static HashSet<StringName> default_values_cached;
@@ -521,6 +522,7 @@ public:
 	static bool is_class_enabled(const StringName &p_class);
 
 	static bool is_class_exposed(const StringName &p_class);
+	static bool overrides_callp(const StringName &p_class);
 	static bool is_class_reloadable(const StringName &p_class);
 	static bool is_class_runtime(const StringName &p_class);
 
@@ -39,32 +39,93 @@
 #ifdef DEV_ENABLED
 // Includes safety checks to ensure that a queue set as a thread singleton override
 // is only ever called from the thread it was set for.
-#define LOCK_MUTEX                                \
+#define LOCK_MUTEX(m_buffer)                      \
 	if (this != MessageQueue::thread_singleton) { \
 		DEV_ASSERT(!is_current_thread_override);  \
-		mutex.lock();                             \
+		(m_buffer)->mutex.lock();                 \
 	} else {                                      \
 		DEV_ASSERT(is_current_thread_override);   \
 	}
 #else
-#define LOCK_MUTEX                                \
+#define LOCK_MUTEX(m_buffer)                      \
 	if (this != MessageQueue::thread_singleton) { \
-		mutex.lock();                             \
+		(m_buffer)->mutex.lock();                 \
 	}
 #endif
 
-#define UNLOCK_MUTEX                              \
+#define UNLOCK_MUTEX(m_buffer)                    \
 	if (this != MessageQueue::thread_singleton) { \
-		mutex.unlock();                           \
+		(m_buffer)->mutex.unlock();               \
 	}
 
-void CallQueue::_add_page() {
-	if (pages_used == page_bytes.size()) {
-		pages.push_back(allocator->alloc());
-		page_bytes.push_back(0);
+thread_local CallQueue::ThreadBufferCache CallQueue::thread_buffer_cache[THREAD_BUFFER_CACHE_SIZE];
+SafeNumeric<uint64_t> CallQueue::last_queue_id;
+BinaryMutex CallQueue::queues_mutex;
+LocalVector<CallQueue *> CallQueue::queues;
+
+CallQueue::Buffer *CallQueue::_register_thread_buffer() {
+	const Thread::ID thread_id = Thread::get_caller_id();
+	Buffer *buffer = nullptr;
+
+	{
+		MutexLock lock(buffers_mutex);
+		// The buffer may already exist if it was evicted from the cache by another queue.
+		// Otherwise take over the buffer of a thread that exited before allocating a new one.
+		Buffer *unassigned_buffer = nullptr;
+		for (Buffer *E : buffers) {
+			if (E->thread_id == thread_id) {
+				buffer = E;
+				break;
+			}
+			if (!unassigned_buffer && E->thread_id == Thread::UNASSIGNED_ID) {
+				unassigned_buffer = E;
+			}
+		}
+		if (!buffer) {
+			buffer = unassigned_buffer;
+		}
+		if (!buffer) {
+			buffer = memnew(Buffer);
+			buffers.push_back(buffer);
+		}
+		buffer->thread_id = thread_id;
+	}
+
+	ThreadBufferCache &cache = thread_buffer_cache[queue_id % THREAD_BUFFER_CACHE_SIZE];
+	cache.queue_id = queue_id;
+	cache.buffer = buffer;
+	return buffer;
+}
+
+bool CallQueue::_add_page(Buffer *p_buffer) {
+	// Pages are counted for the whole queue, so the limit doesn't grow with the number of threads.
+	if (total_pages_used.increment() > max_pages) {
+		total_pages_used.decrement();
+		return false;
+	}
+
+	if (p_buffer->pages_used == p_buffer->page_bytes.size()) {
+		p_buffer->pages.push_back(allocator->alloc());
+		p_buffer->page_bytes.push_back(0);
 	}
-	page_bytes[pages_used] = 0;
-	pages_used++;
+	p_buffer->page_bytes[p_buffer->pages_used] = 0;
+	p_buffer->pages_used++;
+	return true;
+}
+
+uint8_t *CallQueue::_alloc_message(Buffer *p_buffer, uint32_t p_room_needed) {
+	_ensure_first_page(p_buffer);
+
+	if ((p_buffer->page_bytes[p_buffer->pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (!_add_page(p_buffer)) {
+			return nullptr;
+		}
+	}
+
+	Page *page = p_buffer->pages[p_buffer->pages_used - 1];
+	uint8_t *buffer_end = &page->data[p_buffer->page_bytes[p_buffer->pages_used - 1]];
+	p_buffer->page_bytes[p_buffer->pages_used - 1] += p_room_needed;
+	return buffer_end;
 }
 
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
@@ -88,24 +149,17 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	LOCK_MUTEX;
-
-	_ensure_first_page();
+	Buffer *buffer = _get_thread_buffer();
+	LOCK_MUTEX(buffer);
 
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	uint8_t *buffer_end = _alloc_message(buffer, room_needed);
+	if (!buffer_end) {
+		fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+		UNLOCK_MUTEX(buffer);
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
@@ -126,37 +180,29 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	UNLOCK_MUTEX(buffer);
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
+	Buffer *buffer = _get_thread_buffer();
+	LOCK_MUTEX(buffer);
 
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	uint8_t *buffer_end = _alloc_message(buffer, room_needed);
+	if (!buffer_end) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		UNLOCK_MUTEX(buffer);
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
@@ -167,32 +213,26 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	UNLOCK_MUTEX(buffer);
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
+	Buffer *buffer = _get_thread_buffer();
+	LOCK_MUTEX(buffer);
 
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	uint8_t *buffer_end = _alloc_message(buffer, room_needed);
+	if (!buffer_end) {
+		fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		UNLOCK_MUTEX(buffer);
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
@@ -200,8 +240,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	UNLOCK_MUTEX(buffer);
 
 	return OK;
 }
@@ -223,27 +262,19 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 	}
 }
 
-Error CallQueue::flush() {
-	LOCK_MUTEX;
-
-	if (pages.is_empty()) {
-		// Never allocated
-		UNLOCK_MUTEX;
-		return OK; // Do nothing.
-	}
+bool CallQueue::_flush_buffer(Buffer *p_buffer) {
+	LOCK_MUTEX(p_buffer);
 
-	if (flushing) {
-		UNLOCK_MUTEX;
-		return ERR_BUSY;
+	if (p_buffer->pages.is_empty() || (p_buffer->pages_used == 1 && p_buffer->page_bytes[0] == 0)) {
+		UNLOCK_MUTEX(p_buffer);
+		return false;
 	}
 
-	flushing = true;
-
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
-		Page *page = pages[i];
+	while (i < p_buffer->pages_used && offset < p_buffer->page_bytes[i]) {
+		Page *page = p_buffer->pages[i];
 
 		//lock on each iteration, so a call can re-add itself to the message queue
 
@@ -259,7 +290,7 @@ Error CallQueue::flush() {
 
 		Object *target = message->callable.get_object();
 
-		UNLOCK_MUTEX;
+		UNLOCK_MUTEX(p_buffer);
 
 		switch (message->type & FLAG_MASK) {
 			case TYPE_CALL: {
@@ -290,33 +321,65 @@ Error CallQueue::flush() {
 
 		message->~Message();
 
-		LOCK_MUTEX;
-		if (offset == page_bytes[i]) {
+		LOCK_MUTEX(p_buffer);
+		if (offset == p_buffer->page_bytes[i]) {
 			i++;
 			offset = 0;
 		}
 	}
 
-	page_bytes[0] = 0;
-	pages_used = 1;
+	total_pages_used.sub(p_buffer->pages_used - 1);
+	p_buffer->page_bytes[0] = 0;
+	p_buffer->pages_used = 1;
+
+	UNLOCK_MUTEX(p_buffer);
+	return true;
+}
+
+Error CallQueue::flush() {
+	{
+		MutexLock lock(buffers_mutex);
+		if (flushing) {
+			return ERR_BUSY;
+		}
+		if (buffers.is_empty()) {
+			// Never allocated
+			return OK; // Do nothing.
+		}
+		flushing = true;
+	}
+
+	// Buffers are flushed one after the other, so messages keep the order in which each thread pushed them.
+	// Calls may push more messages to any buffer, keep going until all of them are empty.
+	bool flushed = true;
+	while (flushed) {
+		flushed = false;
+		{
+			MutexLock lock(buffers_mutex);
+			flush_buffers = buffers;
+		}
+		for (Buffer *buffer : flush_buffers) {
+			flushed = _flush_buffer(buffer) || flushed;
+		}
+	}
 
+	MutexLock lock(buffers_mutex);
 	flushing = false;
-	UNLOCK_MUTEX;
 	return OK;
 }
 
-void CallQueue::clear() {
-	LOCK_MUTEX;
+void CallQueue::_clear_buffer(Buffer *p_buffer) {
+	LOCK_MUTEX(p_buffer);
 
-	if (pages.is_empty()) {
-		UNLOCK_MUTEX;
+	if (p_buffer->pages.is_empty()) {
+		UNLOCK_MUTEX(p_buffer);
 		return; // Nothing to clear.
 	}
 
-	for (uint32_t i = 0; i < pages_used; i++) {
+	for (uint32_t i = 0; i < p_buffer->pages_used; i++) {
 		uint32_t offset = 0;
-		while (offset < page_bytes[i]) {
-			Page *page = pages[i];
+		while (offset < p_buffer->page_bytes[i]) {
+			Page *page = p_buffer->pages[i];
 
 			//lock on each iteration, so a call can re-add itself to the message queue
 
@@ -340,87 +403,98 @@ void CallQueue::clear() {
 		}
 	}
 
-	pages_used = 1;
-	page_bytes[0] = 0;
+	total_pages_used.sub(p_buffer->pages_used - 1);
+	p_buffer->pages_used = 1;
+	p_buffer->page_bytes[0] = 0;
 
-	UNLOCK_MUTEX;
+	UNLOCK_MUTEX(p_buffer);
+}
+
+void CallQueue::clear() {
+	// Destroying the arguments may queue new calls, which may need to register a buffer,
+	// so the list lock can't be held meanwhile. Buffers live as long as the queue.
+	LocalVector<Buffer *> buffers_to_clear;
+	{
+		MutexLock lock(buffers_mutex);
+		buffers_to_clear = buffers;
+	}
+	for (Buffer *buffer : buffers_to_clear) {
+		_clear_buffer(buffer);
+	}
 }
 
 void CallQueue::statistics() {
-	LOCK_MUTEX;
+	MutexLock lock(buffers_mutex);
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
 	int null_count = 0;
+	uint32_t pages_used = 0;
 
-	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
-		while (offset < page_bytes[i]) {
-			Page *page = pages[i];
+	for (Buffer *buffer : buffers) {
+		LOCK_MUTEX(buffer);
+		pages_used += buffer->pages_used;
 
-			//lock on each iteration, so a call can re-add itself to the message queue
+		for (uint32_t i = 0; i < buffer->pages_used; i++) {
+			uint32_t offset = 0;
+			while (offset < buffer->page_bytes[i]) {
+				Page *page = buffer->pages[i];
 
-			Message *message = (Message *)&page->data[offset];
+				Message *message = (Message *)&page->data[offset];
 
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
+				uint32_t advance = sizeof(Message);
+				if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+					advance += sizeof(Variant) * message->args;
+				}
 
-			Object *target = message->callable.get_object();
+				Object *target = message->callable.get_object();
 
-			bool null_target = true;
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (target || (message->type & FLAG_NULL_IS_OK)) {
-						if (!call_count.has(message->callable)) {
-							call_count[message->callable] = 0;
-						}
+				bool null_target = true;
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						if (target || (message->type & FLAG_NULL_IS_OK)) {
+							if (!call_count.has(message->callable)) {
+								call_count[message->callable] = 0;
+							}
 
-						call_count[message->callable]++;
-						null_target = false;
-					}
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (target) {
-						if (!notify_count.has(message->notification)) {
-							notify_count[message->notification] = 0;
+							call_count[message->callable]++;
+							null_target = false;
 						}
-
-						notify_count[message->notification]++;
-						null_target = false;
-					}
-				} break;
-				case TYPE_SET: {
-					if (target) {
-						StringName t = message->callable.get_method();
-						if (!set_count.has(t)) {
-							set_count[t] = 0;
+					} break;
+					case TYPE_NOTIFICATION: {
+						if (target) {
+							if (!notify_count.has(message->notification)) {
+								notify_count[message->notification] = 0;
+							}
+
+							notify_count[message->notification]++;
+							null_target = false;
 						}
+					} break;
+					case TYPE_SET: {
+						if (target) {
+							StringName t = message->callable.get_method();
+							if (!set_count.has(t)) {
+								set_count[t] = 0;
+							}
+
+							set_count[t]++;
+							null_target = false;
+						}
+					} break;
+				}
+				if (null_target) {
+					// Object was deleted.
+					fprintf(stdout, "Object was deleted while awaiting a callback.\n");
 
-						set_count[t]++;
-						null_target = false;
-					}
-				} break;
-			}
-			if (null_target) {
-				// Object was deleted.
-				fprintf(stdout, "Object was deleted while awaiting a callback.\n");
-
-				null_count++;
-			}
-
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
+					null_count++;
 				}
-			}
 
-			message->~Message();
+				offset += advance;
+			}
 		}
+
+		UNLOCK_MUTEX(buffer);
 	}
 
 	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", pages_used, pages_used * PAGE_SIZE_BYTES);
@@ -437,8 +511,6 @@ void CallQueue::statistics() {
 	for (const KeyValue<int, int> &E : notify_count) {
 		fprintf(stdout, "NOTIFY %d: %d.\n", E.key, E.value);
 	}
-
-	UNLOCK_MUTEX;
 }
 
 bool CallQueue::is_flushing() const {
@@ -446,21 +518,42 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
-	if (pages_used == 0) {
-		return false;
-	}
-	if (pages_used == 1 && page_bytes[0] == 0) {
-		return false;
+	MutexLock lock(buffers_mutex);
+	for (const Buffer *buffer : buffers) {
+		if (buffer->pages_used > 1 || (buffer->pages_used == 1 && buffer->page_bytes[0] > 0)) {
+			return true;
+		}
 	}
 
-	return true;
+	return false;
+}
+
+void CallQueue::thread_exit() {
+	const Thread::ID thread_id = Thread::get_caller_id();
+
+	MutexLock queues_lock(queues_mutex);
+	for (CallQueue *queue : queues) {
+		MutexLock lock(queue->buffers_mutex);
+		for (Buffer *buffer : queue->buffers) {
+			// Messages still in the buffer are flushed as usual, the next thread appends after them.
+			if (buffer->thread_id == thread_id) {
+				buffer->thread_id = Thread::UNASSIGNED_ID;
+			}
+		}
+	}
 }
 
 int CallQueue::get_max_buffer_usage() const {
-	return pages.size() * PAGE_SIZE_BYTES;
+	MutexLock lock(buffers_mutex);
+	uint32_t page_count = 0;
+	for (const Buffer *buffer : buffers) {
+		page_count += buffer->pages.size();
+	}
+	return page_count * PAGE_SIZE_BYTES;
 }
 
-CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
+CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) :
+		queue_id(last_queue_id.increment()) {
 	if (p_custom_allocator) {
 		allocator = p_custom_allocator;
 		allocator_is_custom = true;
@@ -470,13 +563,24 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 	}
 	max_pages = p_max_pages;
 	error_text = p_error_text;
+
+	MutexLock lock(queues_mutex);
+	queues.push_back(this);
 }
 
 CallQueue::~CallQueue() {
+	{
+		MutexLock lock(queues_mutex);
+		queues.erase(this);
+	}
+
 	clear();
 	// Let go of pages.
-	for (uint32_t i = 0; i < pages.size(); i++) {
-		allocator->free(pages[i]);
+	for (Buffer *buffer : buffers) {
+		for (uint32_t i = 0; i < buffer->pages.size(); i++) {
+			allocator->free(buffer->pages[i]);
+		}
+		memdelete(buffer);
 	}
 	if (!allocator_is_custom) {
 		memdelete(allocator);
@@ -31,9 +31,11 @@
 #pragma once
 
 #include "core/object/object_id.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -65,15 +67,43 @@ private:
 		FLAG_MASK = FLAG_NULL_IS_OK - 1,
 	};
 
-	Mutex mutex;
+	// Every producing thread appends to its own buffer, so threads pushing at the same time don't
+	// contend. A buffer's mutex is only shared between its thread and the one flushing the queue.
+	// When a thread exits its buffer is unassigned, and the next new thread takes it over.
+	struct Buffer {
+		Mutex mutex;
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
+		LocalVector<Page *> pages;
+		LocalVector<uint32_t> page_bytes;
+		uint32_t pages_used = 0;
+	};
+
+	struct ThreadBufferCache {
+		uint64_t queue_id = 0;
+		Buffer *buffer = nullptr;
+	};
+
+	enum {
+		THREAD_BUFFER_CACHE_SIZE = 16,
+	};
+
+	static thread_local ThreadBufferCache thread_buffer_cache[THREAD_BUFFER_CACHE_SIZE];
+	static SafeNumeric<uint64_t> last_queue_id;
+
+	static BinaryMutex queues_mutex; // Protects the list of live queues.
+	static LocalVector<CallQueue *> queues;
+
+	const uint64_t queue_id = 0;
+
+	mutable BinaryMutex buffers_mutex; // Protects the buffer list and the flushing state.
+	LocalVector<Buffer *> buffers;
+	LocalVector<Buffer *> flush_buffers;
 
 	Allocator *allocator = nullptr;
 	bool allocator_is_custom = false;
 
-	LocalVector<Page *> pages;
-	LocalVector<uint32_t> page_bytes;
 	uint32_t max_pages = 0;
-	uint32_t pages_used = 0;
+	SafeNumeric<uint32_t> total_pages_used;
 	bool flushing = false;
 
 #ifdef DEV_ENABLED
@@ -89,15 +119,28 @@ private:
 		};
 	};
 
-	_FORCE_INLINE_ void _ensure_first_page() {
-		if (unlikely(pages.is_empty())) {
-			pages.push_back(allocator->alloc());
-			page_bytes.push_back(0);
-			pages_used = 1;
+	Buffer *_register_thread_buffer();
+	_FORCE_INLINE_ Buffer *_get_thread_buffer() {
+		ThreadBufferCache &cache = thread_buffer_cache[queue_id % THREAD_BUFFER_CACHE_SIZE];
+		if (likely(cache.queue_id == queue_id)) {
+			return cache.buffer;
 		}
+		return _register_thread_buffer();
 	}
 
-	void _add_page();
+	_FORCE_INLINE_ void _ensure_first_page(Buffer *p_buffer) {
+		if (unlikely(p_buffer->pages.is_empty())) {
+			p_buffer->pages.push_back(allocator->alloc());
+			p_buffer->page_bytes.push_back(0);
+			p_buffer->pages_used = 1;
+			total_pages_used.increment();
+		}
+	}
+
+	bool _add_page(Buffer *p_buffer);
+	uint8_t *_alloc_message(Buffer *p_buffer, uint32_t p_room_needed);
+	bool _flush_buffer(Buffer *p_buffer);
+	void _clear_buffer(Buffer *p_buffer);
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
@@ -152,6 +195,9 @@ public:
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
 
+	// Called by threads before they exit, so their buffers can be reused.
+	static void thread_exit();
+
 	CallQueue(Allocator *p_custom_allocator = nullptr, uint32_t p_max_pages = 8192, const String &p_error_text = String());
 	virtual ~CallQueue();
 };
@@ -348,6 +348,7 @@ struct ObjectGDExtension {
 	GDExtensionClassReference reference;
 	GDExtensionClassReference unreference;
 	GDExtensionClassGetRID get_rid;
+	GDExtensionClassProcessBatch process_batch = nullptr;
 
 	void *class_userdata = nullptr;
 
@@ -523,7 +524,7 @@ public:
 			return;                                                                                                                         \
 		}                                                                                                                                   \
 		m_inherits::initialize_class();                                                                                                     \
-		_add_class_to_classdb(get_gdtype_static(), &super_type::get_gdtype_static());                                                       \
+		_add_class_to_classdb(get_gdtype_static(), &super_type::get_gdtype_static(), _declares_callp<m_class>(&m_class::callp));            \
 		if (m_class::_get_bind_methods() != m_inherits::_get_bind_methods()) {                                                              \
 			_bind_methods();                                                                                                                \
 		}                                                                                                                                   \
@@ -635,9 +636,36 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Immutable copy of the connections, shared by every emission until the
+		// connections change, so emitting neither copies callables nor allocates.
+		struct Snapshot {
+			SafeRefCount refcount;
+			LocalVector<Callable> callables;
+			LocalVector<uint32_t> flags;
+			bool has_one_shot = false;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot> slot_map;
 		bool removable = false;
+		// Built lazily on emission and dropped whenever `slot_map` changes.
+		Snapshot *snapshot = nullptr;
+
+		Snapshot *acquire_snapshot();
+		static void release_snapshot(Snapshot *p_snapshot);
+		void invalidate_snapshot();
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), removable(p_other.removable) {}
+		SignalData &operator=(const SignalData &p_other) {
+			invalidate_snapshot();
+			user = p_other.user;
+			slot_map = p_other.slot_map;
+			removable = p_other.removable;
+			return *this;
+		}
+		~SignalData() { invalidate_snapshot(); }
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
@@ -724,6 +752,7 @@ protected:
 	void _gdvirtual_init_method_ptr(uint32_t p_compat_hash, void *&r_fn_ptr, const StringName &p_fn_name, bool p_compat) const;
 
 	friend class GDExtensionMethodBind;
+	friend class PropertyBatch;
 	_ALWAYS_INLINE_ const ObjectGDExtension *_get_extension() const { return _extension; }
 	_ALWAYS_INLINE_ GDExtensionClassInstancePtr _get_extension_instance() const { return _extension_instance; }
 	virtual void _initialize_classv() { initialize_class(); }
@@ -792,7 +821,13 @@ protected:
 	friend class ::ClassDB;
 	friend class PlaceholderExtensionInstance;
 
-	static void _add_class_to_classdb(const GDType &p_class, const GDType *p_inherits);
+	static void _add_class_to_classdb(const GDType &p_class, const GDType *p_inherits, bool p_declares_callp = false);
+	// Whether `T` itself declares `callp()`, as opposed to inheriting it. Taken by pointer so it's
+	// the class' own access to the method being checked.
+	template <typename T, typename C>
+	static constexpr bool _declares_callp(Variant (C::*)(const StringName &, const Variant **, int, Callable::CallError &)) {
+		return std::is_same_v<T, C>;
+	}
 	static void _get_property_list_from_classdb(const StringName &p_class, List<PropertyInfo> *p_list, bool p_no_inheritance, const Object *p_validator);
 
 	bool _disconnect(const StringName &p_signal, const Callable &p_callable, bool p_force = false);
@@ -1137,3 +1172,21 @@ public:
 	static void debug_objects(DebugFunc p_func, void *p_user_data);
 	static int get_object_count();
 };
+
+#ifdef DEBUG_ENABLED
+// Held while a method of the object is called, freeing the object meanwhile fails.
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj_id = p_obj->get_instance_id();
+		p_obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		Object *obj_ptr = ObjectDB::get_instance(obj_id);
+		if (likely(obj_ptr)) {
+			obj_ptr->_lock_index.unref();
+		}
+	}
+};
+#endif // DEBUG_ENABLED
@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*  property_batch.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "property_batch.h"
+
+#include "core/object/class_db.h"
+#include "core/object/method_bind.h"
+#include "core/object/script_instance.h"
+
+Error PropertyBatch::setup(const StringName &p_class, const StringName &p_property) {
+	clear();
+
+	ERR_FAIL_COND_V_MSG(!ClassDB::class_exists(p_class), ERR_INVALID_PARAMETER, vformat("Class '%s' does not exist.", p_class));
+
+	bool is_valid = false;
+	const Variant::Type property_type = ClassDB::get_property_type(p_class, p_property, &is_valid);
+	ERR_FAIL_COND_V_MSG(!is_valid, ERR_INVALID_PARAMETER, vformat("Class '%s' has no property '%s'.", p_class, p_property));
+
+	const StringName property_setter = ClassDB::get_property_setter(p_class, p_property);
+	ERR_FAIL_COND_V_MSG(property_setter == StringName(), ERR_INVALID_PARAMETER, vformat("Property '%s' of class '%s' is read-only.", p_property, p_class));
+
+	MethodBind *method = ClassDB::get_method(p_class, property_setter);
+	ERR_FAIL_NULL_V_MSG(method, ERR_INVALID_PARAMETER, vformat("Setter '%s' of property '%s' is not a bound method.", property_setter, p_property));
+
+	const int property_index = ClassDB::get_property_index(p_class, p_property);
+
+	target_class = p_class;
+	property = p_property;
+	setter_name = property_setter;
+	setter = method;
+	type = property_type;
+	indexed = property_index >= 0;
+	if (indexed) {
+		index = property_index;
+	}
+
+	// Validated calls skip argument checks, so only use them when the setter takes exactly what we pass.
+	const int argument_count = indexed ? 2 : 1;
+	validated = !method->is_vararg() && method->get_argument_count() == argument_count;
+	if (validated && indexed) {
+		validated = method->get_argument_type(0) == Variant::INT;
+	}
+	if (validated) {
+		const PropertyInfo value_info = method->get_argument_info(argument_count - 1);
+		validated = value_info.type == property_type;
+		// Typed containers are only checked by the regular call, objects are checked per value in _set_value().
+		if (value_info.hint == PROPERTY_HINT_ARRAY_TYPE || value_info.hint == PROPERTY_HINT_DICTIONARY_TYPE) {
+			validated = false;
+		} else if (property_type == Variant::OBJECT) {
+			value_class = value_info.class_name;
+			validated = value_class != StringName();
+		}
+	}
+	return OK;
+}
+
+void PropertyBatch::clear() {
+	target_class = StringName();
+	property = StringName();
+	setter_name = StringName();
+	setter = nullptr;
+	type = Variant::NIL;
+	value_class = StringName();
+	index = Variant();
+	indexed = false;
+	validated = false;
+	class_cache.clear();
+	last_class = StringName();
+}
+
+bool PropertyBatch::_can_call_setter(Object *p_object) {
+	// Scripts and extensions can intercept any property in Object::set().
+	if (p_object->get_script_instance() || (p_object->_get_extension() && p_object->_get_extension()->set)) {
+		return false;
+	}
+
+	const StringName &object_class = p_object->get_class_name();
+	if (object_class == last_class) {
+		return true;
+	}
+
+	bool *cached = class_cache.getptr(object_class);
+	if (!cached) {
+		// Derived classes may register a property with the same name and a different setter.
+		const bool matches = ClassDB::is_parent_class(object_class, target_class) &&
+				ClassDB::get_property_setter(object_class, property) == setter_name &&
+				ClassDB::get_property_index(object_class, property) == (indexed ? int(index) : -1);
+		cached = &class_cache.insert(object_class, matches)->value;
+	}
+	if (*cached) {
+		last_class = object_class;
+	}
+	return *cached;
+}
+
+void PropertyBatch::_set_value(Object *p_object, const Variant &p_value) {
+	if (!_can_call_setter(p_object)) {
+		p_object->set(property, p_value);
+		return;
+	}
+
+	const Variant *args[2];
+	int argument_count = 0;
+	if (indexed) {
+		args[argument_count++] = &index;
+	}
+	args[argument_count++] = &p_value;
+
+	bool can_validate = validated && (type == Variant::NIL || p_value.get_type() == type);
+	if (can_validate && type == Variant::OBJECT) {
+		// A validated call would pass an object of any class straight to the setter.
+		const Object *value_object = p_value.get_validated_object();
+		can_validate = value_object && ClassDB::is_parent_class(value_object->get_class_name(), value_class);
+	}
+
+	if (can_validate) {
+		setter->validated_call(p_object, args, nullptr);
+	} else {
+		// Let the regular call convert the value, or report why it can't.
+		Callable::CallError ce;
+		setter->call(p_object, args, argument_count, ce);
+		if (ce.error != Callable::CallError::CALL_OK) {
+			ERR_PRINT(vformat("Failed to set property '%s': %s", property, Variant::get_call_error_text(p_object, setter_name, args, argument_count, ce)));
+		}
+	}
+}
+
+Error PropertyBatch::set_values(const Array &p_objects, const Variant &p_values) {
+	ERR_FAIL_COND_V_MSG(!is_valid(), ERR_UNCONFIGURED, "PropertyBatch has not been set up.");
+	ERR_FAIL_COND_V_MSG(!p_values.is_array(), ERR_INVALID_PARAMETER, "Values must be an Array or a packed array.");
+
+	// Packed arrays are converted once, so the values can be passed on by pointer.
+	const Array values = p_values;
+	ERR_FAIL_COND_V_MSG(values.size() != p_objects.size(), ERR_INVALID_PARAMETER, vformat("Got %d values for %d objects.", values.size(), p_objects.size()));
+
+	Error err = OK;
+	for (int i = 0; i < p_objects.size(); i++) {
+		Object *object = p_objects[i].get_validated_object();
+		if (unlikely(!object)) {
+			err = ERR_INVALID_PARAMETER;
+			ERR_CONTINUE_MSG(true, vformat("Object at index %d is null or was freed.", i));
+		}
+		_set_value(object, values[i]);
+	}
+	return err;
+}
+
+Error PropertyBatch::set_all(const Array &p_objects, const Variant &p_value) {
+	ERR_FAIL_COND_V_MSG(!is_valid(), ERR_UNCONFIGURED, "PropertyBatch has not been set up.");
+
+	Error err = OK;
+	for (int i = 0; i < p_objects.size(); i++) {
+		Object *object = p_objects[i].get_validated_object();
+		if (unlikely(!object)) {
+			err = ERR_INVALID_PARAMETER;
+			ERR_CONTINUE_MSG(true, vformat("Object at index %d is null or was freed.", i));
+		}
+		_set_value(object, p_value);
+	}
+	return err;
+}
+
+void PropertyBatch::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("setup", "class_name", "property"), &PropertyBatch::setup);
+	ClassDB::bind_method(D_METHOD("clear"), &PropertyBatch::clear);
+	ClassDB::bind_method(D_METHOD("is_valid"), &PropertyBatch::is_valid);
+	ClassDB::bind_method(D_METHOD("get_target_class"), &PropertyBatch::get_target_class);
+	ClassDB::bind_method(D_METHOD("get_property"), &PropertyBatch::get_property);
+	ClassDB::bind_method(D_METHOD("get_property_type"), &PropertyBatch::get_property_type);
+
+	ClassDB::bind_method(D_METHOD("set_values", "objects", "values"), &PropertyBatch::set_values);
+	ClassDB::bind_method(D_METHOD("set_all", "objects", "value"), &PropertyBatch::set_all);
+}
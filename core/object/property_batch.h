@@ -0,0 +1,75 @@
+/**************************************************************************/
+/*  property_batch.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+
+class MethodBind;
+
+// Writes one property on many objects. The setter is resolved against ClassDB
+// once in setup(), so each write is a validated call instead of going through
+// Object::set() and its property lookups.
+class PropertyBatch : public RefCounted {
+	GDCLASS(PropertyBatch, RefCounted);
+
+	StringName target_class;
+	StringName property;
+	StringName setter_name;
+	MethodBind *setter = nullptr;
+	Variant::Type type = Variant::NIL;
+	StringName value_class;
+	Variant index;
+	bool indexed = false;
+	bool validated = false;
+
+	// Whether objects of a given class resolve the property to the same setter.
+	HashMap<StringName, bool> class_cache;
+	StringName last_class;
+
+	bool _can_call_setter(Object *p_object);
+	void _set_value(Object *p_object, const Variant &p_value);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error setup(const StringName &p_class, const StringName &p_property);
+	void clear();
+
+	bool is_valid() const { return setter != nullptr; }
+	StringName get_target_class() const { return target_class; }
+	StringName get_property() const { return property; }
+	Variant::Type get_property_type() const { return type; }
+
+	Error set_values(const Array &p_objects, const Variant &p_values);
+	Error set_all(const Array &p_objects, const Variant &p_value);
+};
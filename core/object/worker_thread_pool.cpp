@@ -122,6 +122,23 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->group->done_semaphore.post();
 			p_task->group->completed.set_to(true);
 		}
+
+		if (do_post && p_task->group->graph_run) {
+			// Nobody waits for groups belonging to a task graph, so count the missing user here.
+			// This can't be the last user, since this task's own one is still to be counted below.
+			TaskGraphRun *graph_run = p_task->group->graph_run;
+			uint32_t graph_node = p_task->group->graph_node;
+			p_task->group->finished.increment();
+
+			bool graph_finished = false;
+			{
+				MutexLock task_lock(task_mutex);
+				graph_finished = _task_graph_node_done(graph_run, graph_node, task_lock);
+			}
+			if (graph_finished) {
+				_finish_task_graph(graph_run);
+			}
+		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
 
@@ -145,18 +162,22 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call();
 		}
 
-		task_mutex.lock();
-		p_task->completed = true;
-		p_task->pool_thread_index = -1;
-		if (p_task->waiting_user) {
-			p_task->done_semaphore.post(p_task->waiting_user);
-		}
-		// Let awaiters know.
-		for (uint32_t i = 0; i < threads.size(); i++) {
-			if (threads[i].awaited_task == p_task) {
-				threads[i].cond_var.notify_one();
-				threads[i].signaled = true;
+		if (p_task->graph_run) {
+			bool graph_finished = false;
+			{
+				MutexLock task_lock(task_mutex);
+				graph_finished = _task_graph_node_done(p_task->graph_run, p_task->graph_node, task_lock);
 			}
+			if (graph_finished) {
+				_finish_task_graph(p_task->graph_run);
+			}
+
+			// Like for groups, tasks belonging to a graph get rid of themselves.
+			task_mutex.lock();
+			task_allocator.free(p_task);
+		} else {
+			task_mutex.lock();
+			_complete_task(p_task);
 		}
 	}
 
@@ -187,7 +208,13 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 	while (true) {
 		Task *task_to_process = nullptr;
-		{
+
+		if (thread_data->pool->use_work_stealing) {
+			// Fast path: own queue first, then steal from other threads, all without locking.
+			task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+		}
+
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -200,17 +227,29 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					break;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				if (thread_data->pool->use_work_stealing) {
+					// Local queues are only pushed to with the lock held, so checking them here
+					// before waiting can't miss a notification.
+					task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+					if (task_to_process) {
+						break;
+					}
+					if (thread_data->pool->_has_local_queued_tasks()) {
+						// Lost a race against another thief; there may be more.
+						continue;
+					}
+				}
+
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
 			}
 		}
 
@@ -244,10 +283,16 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// Pool threads posting tasks keep them in their own queue, so they can be run
+	// (or stolen by other threads) without going through the mutex.
+	bool use_local_queue = use_work_stealing && caller_pool_thread && !p_pump_task;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			if (!use_local_queue || !caller_pool_thread->local_queue.push(p_tasks[i])) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -338,6 +383,31 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_or_steal_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->local_queue.pop(task)) {
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		if (victim.local_queue.steal(task)) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_local_queued_tasks() const {
+	for (const ThreadData &th : threads) {
+		if (!th.local_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
@@ -398,6 +468,22 @@ bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	return (*taskp)->completed;
 }
 
+// Must be called with task_mutex locked.
+void WorkerThreadPool::_complete_task(Task *p_task) {
+	p_task->completed = true;
+	p_task->pool_thread_index = -1;
+	if (p_task->waiting_user) {
+		p_task->done_semaphore.post(p_task->waiting_user);
+	}
+	// Let awaiters know.
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (threads[i].awaited_task == p_task) {
+			threads[i].cond_var.notify_one();
+			threads[i].signaled = true;
+		}
+	}
+}
+
 Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	task_mutex.lock();
 	Task **taskp = tasks.getptr(p_task_id);
@@ -516,7 +602,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || (use_work_stealing && _has_local_queued_tasks())) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -534,7 +620,9 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			if (use_work_stealing && p_caller_pool_thread->local_queue.pop(task_to_process)) {
+				// Most likely, what's being awaited was posted by this very thread, so it's found here.
+			} else if (p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				if ((p_task == ThreadData::YIELDING || p_caller_pool_thread->has_pump_task == true) && task_to_process->is_pump_task) {
 					task_to_process = nullptr;
@@ -544,6 +632,15 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
+			if (!task_to_process && use_work_stealing) {
+				// Pump tasks never go to local queues, so anything stolen is fine to run here.
+				task_to_process = _pop_or_steal_task(p_caller_pool_thread);
+				if (!task_to_process && _has_local_queued_tasks()) {
+					// Lost a race against another thief; there may be more.
+					continue;
+				}
+			}
+
 			if (!task_to_process) {
 				p_caller_pool_thread->awaited_task = p_task;
 
@@ -587,7 +684,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_local_queued_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -757,6 +854,255 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 #endif
 }
 
+void WorkerThreadPool::_template_task_trampoline(void *p_userdata) {
+	((BaseTemplateUserdata *)p_userdata)->callback();
+}
+
+void WorkerThreadPool::_template_group_task_trampoline(void *p_userdata, uint32_t p_index) {
+	((BaseTemplateUserdata *)p_userdata)->callback_indexed(p_index);
+}
+
+WorkerThreadPool::TaskGraph::Node &WorkerThreadPool::TaskGraph::_add_node(const String &p_description) {
+	nodes.push_back(Node());
+	Node &node = nodes[nodes.size() - 1];
+	node.description = p_description;
+	return node;
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_native_task(void (*p_func)(void *), void *p_userdata, const String &p_description) {
+	Node &node = _add_node(p_description);
+	node.native_func = p_func;
+	node.native_func_userdata = p_userdata;
+	return nodes.size() - 1;
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_task(const Callable &p_action, const String &p_description) {
+	Node &node = _add_node(p_description);
+	node.callable = p_action;
+	return nodes.size() - 1;
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, const String &p_description) {
+	Node &node = _add_node(p_description);
+	node.is_group = true;
+	node.native_group_func = p_func;
+	node.native_func_userdata = p_userdata;
+	node.elements = MAX(p_elements, 0);
+	node.tasks = p_tasks;
+	return nodes.size() - 1;
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_group_task(const Callable &p_action, int p_elements, int p_tasks, const String &p_description) {
+	Node &node = _add_node(p_description);
+	node.is_group = true;
+	node.callable = p_action;
+	node.elements = MAX(p_elements, 0);
+	node.tasks = p_tasks;
+	return nodes.size() - 1;
+}
+
+void WorkerThreadPool::TaskGraph::add_dependency(NodeID p_node, NodeID p_depends_on) {
+	ERR_FAIL_UNSIGNED_INDEX(p_node, nodes.size());
+	ERR_FAIL_UNSIGNED_INDEX(p_depends_on, nodes.size());
+	ERR_FAIL_COND_MSG(p_node == p_depends_on, "A task graph node can't depend on itself.");
+	nodes[p_depends_on].successors.push_back(p_node);
+	nodes[p_node].dependency_count++;
+}
+
+void WorkerThreadPool::TaskGraph::set_continuation(void (*p_func)(void *), void *p_userdata) {
+	continuation_func = p_func;
+	continuation_userdata = p_userdata;
+}
+
+WorkerThreadPool::TaskGraph::~TaskGraph() {
+	for (BaseTemplateUserdata *ud : template_userdatas) {
+		memdelete(ud);
+	}
+}
+
+// Returns whether the whole graph is done, in which case the caller must call _finish_task_graph() once unlocked.
+bool WorkerThreadPool::_post_task_graph_node(TaskGraphRun *p_run, uint32_t p_node, MutexLock<BinaryMutex> &p_lock) {
+	const TaskGraph::Node &node = p_run->graph->nodes[p_node];
+
+	if (node.is_group) {
+		if (node.elements == 0) {
+			// Nothing to do, but successors still have to be released.
+			return _task_graph_node_done(p_run, p_node, p_lock);
+		}
+
+		int task_count = node.tasks < 0 ? MAX(1u, threads.size()) : MAX(node.tasks, 1);
+
+		Group *group = group_allocator.alloc();
+		group->max = node.elements;
+		group->tasks_used = task_count;
+		group->graph_run = p_run;
+		group->graph_node = p_node;
+
+		Task **tasks_posted = (Task **)alloca(sizeof(Task *) * task_count);
+		for (int i = 0; i < task_count; i++) {
+			Task *task = task_allocator.alloc();
+			task->native_group_func = node.native_group_func;
+			task->native_func_userdata = node.native_func_userdata;
+			task->description = node.description;
+			task->group = group;
+			task->callable = node.callable;
+			tasks_posted[i] = task;
+		}
+		_post_tasks(tasks_posted, task_count, p_run->high_priority, p_lock, false);
+	} else {
+		Task *task = task_allocator.alloc();
+		task->callable = node.callable;
+		task->native_func = node.native_func;
+		task->native_func_userdata = node.native_func_userdata;
+		task->description = node.description;
+		task->graph_run = p_run;
+		task->graph_node = p_node;
+		_post_tasks(&task, 1, p_run->high_priority, p_lock, false);
+	}
+	return false;
+}
+
+// Returns whether the whole graph is done, in which case the caller must call _finish_task_graph() once unlocked.
+bool WorkerThreadPool::_task_graph_node_done(TaskGraphRun *p_run, uint32_t p_node, MutexLock<BinaryMutex> &p_lock) {
+	// The run can't finish while successors are being posted, since this node is still pending.
+	for (uint32_t successor : p_run->graph->nodes[p_node].successors) {
+		if (p_run->pending_dependencies[successor].decrement() == 0) {
+			_post_task_graph_node(p_run, successor, p_lock);
+		}
+	}
+	return p_run->pending_nodes.decrement() == 0;
+}
+
+void WorkerThreadPool::_finish_task_graph(TaskGraphRun *p_run) {
+	if (p_run->graph->continuation_func) {
+		p_run->graph->continuation_func(p_run->graph->continuation_userdata);
+	}
+	MutexLock task_lock(task_mutex);
+	_complete_task(p_run->completion_task); // The run may be freed by a waiter from here on.
+}
+
+WorkerThreadPool::TaskGraphID WorkerThreadPool::run_task_graph(const TaskGraph &p_graph, bool p_high_priority) {
+	uint32_t node_count = p_graph.nodes.size();
+
+	TaskGraphRun *run = memnew(TaskGraphRun);
+	run->graph = &p_graph;
+	run->high_priority = p_high_priority;
+	run->pending_dependencies.resize(node_count);
+
+	// Validate there are no cycles (Kahn's algorithm), which would make the graph never complete.
+	{
+		LocalVector<uint32_t> ready;
+		for (uint32_t i = 0; i < node_count; i++) {
+			run->pending_dependencies[i].set(p_graph.nodes[i].dependency_count);
+			if (p_graph.nodes[i].dependency_count == 0) {
+				ready.push_back(i);
+			}
+		}
+		uint32_t visited = 0;
+		while (visited < ready.size()) {
+			for (uint32_t successor : p_graph.nodes[ready[visited]].successors) {
+				if (run->pending_dependencies[successor].decrement() == 0) {
+					ready.push_back(successor);
+				}
+			}
+			visited++;
+		}
+		if (visited != node_count) {
+			memdelete(run);
+			ERR_FAIL_V_MSG(INVALID_TASK_ID, "Task graph has a dependency cycle.");
+		}
+		for (uint32_t i = 0; i < node_count; i++) {
+			run->pending_dependencies[i].set(p_graph.nodes[i].dependency_count);
+		}
+	}
+
+	run->pending_nodes.set(node_count + 1); // Plus one so the run can't finish while roots are being posted.
+
+	bool graph_finished = false;
+	TaskGraphID id;
+	{
+		MutexLock<BinaryMutex> lock(task_mutex);
+
+		id = last_task++;
+		run->self = id;
+		run->completion_task = task_allocator.alloc();
+		run->completion_task->self = id;
+		task_graphs.insert(id, run);
+
+		for (uint32_t i = 0; i < node_count; i++) {
+			if (p_graph.nodes[i].dependency_count == 0) {
+				_post_task_graph_node(run, i, lock);
+			}
+		}
+		graph_finished = run->pending_nodes.decrement() == 0;
+	}
+
+	if (graph_finished) {
+		_finish_task_graph(run);
+	}
+
+	return id;
+}
+
+bool WorkerThreadPool::is_task_graph_completed(TaskGraphID p_graph) const {
+	MutexLock task_lock(task_mutex);
+	TaskGraphRun *const *runp = task_graphs.getptr(p_graph);
+	if (!runp) {
+		ERR_FAIL_V_MSG(false, "Invalid Task Graph ID");
+	}
+	return (*runp)->completion_task->completed;
+}
+
+Error WorkerThreadPool::wait_for_task_graph_completion(TaskGraphID p_graph) {
+	task_mutex.lock();
+	TaskGraphRun **runp = task_graphs.getptr(p_graph);
+	if (!runp) {
+		task_mutex.unlock();
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Invalid Task Graph ID.");
+	}
+	TaskGraphRun *run = *runp;
+	Task *task = run->completion_task;
+
+	if (!task->completed) {
+		ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+		if (caller_pool_thread && p_graph <= caller_pool_thread->current_task->self) {
+			// Same deadlock prevention as in wait_for_task_completion().
+			task_mutex.unlock();
+			return ERR_BUSY;
+		}
+
+		if (caller_pool_thread) {
+			// Run other tasks meanwhile, the graph may need this very thread to make progress.
+			task->waiting_pool++;
+			task_mutex.unlock();
+			_wait_collaboratively(caller_pool_thread, task);
+			task_mutex.lock();
+			task->waiting_pool--;
+		} else {
+			task->waiting_user++;
+			task_mutex.unlock();
+			if (this == singleton) {
+				_unlock_unlockable_mutexes();
+			}
+			task->done_semaphore.wait();
+			if (this == singleton) {
+				_lock_unlockable_mutexes();
+			}
+			task_mutex.lock();
+			task->waiting_user--;
+		}
+	}
+
+	if (task->waiting_pool == 0 && task->waiting_user == 0) {
+		task_graphs.erase(p_graph);
+		task_allocator.free(task);
+		memdelete(run);
+	}
+
+	task_mutex.unlock();
+	return OK;
+}
+
 int WorkerThreadPool::get_thread_index() const {
 	Thread::ID tid = Thread::get_caller_id();
 	return thread_ids.has(tid) ? thread_ids[tid] : -1;
@@ -806,10 +1152,11 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, bool p_use_work_stealing) {
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
+	use_work_stealing = p_use_work_stealing;
 
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
@@ -817,7 +1164,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	max_low_priority_threads = CLAMP(p_thread_count * p_low_priority_task_ratio, 1, p_thread_count - 1);
 
-	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority.", p_thread_count, max_low_priority_threads));
+	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority, work stealing %s.", p_thread_count, max_low_priority_threads, use_work_stealing ? "enabled" : "disabled"));
 
 #ifdef THREADS_ENABLED
 	// Reserve 5 threads in case we need separate threads for 1) 2D physics 2) 3D physics 3) rendering 4) GPU texture compression, 5) all other tasks.
@@ -879,6 +1226,12 @@ void WorkerThreadPool::finish() {
 		for (KeyValue<TaskID, Task *> &E : tasks) {
 			task_allocator.free(E.value);
 		}
+		for (KeyValue<TaskGraphID, TaskGraphRun *> &E : task_graphs) {
+			print_error("Task graph run was never waited for.");
+			task_allocator.free(E.value->completion_task);
+			memdelete(E.value);
+		}
+		task_graphs.clear();
 	}
 
 	threads.clear();
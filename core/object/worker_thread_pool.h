@@ -40,6 +40,7 @@
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -50,9 +51,13 @@ public:
 
 	typedef int64_t TaskID;
 	typedef int64_t GroupID;
+	typedef int64_t TaskGraphID;
+
+	class TaskGraph;
 
 private:
 	struct Task;
+	struct TaskGraphRun;
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
@@ -69,6 +74,19 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		TaskGraphRun *graph_run = nullptr;
+		uint32_t graph_node = 0;
+	};
+
+	struct TaskGraphRun {
+		TaskGraphID self = -1;
+		const TaskGraph *graph = nullptr;
+		TightLocalVector<SafeNumeric<uint32_t>> pending_dependencies; // Per node.
+		SafeNumeric<uint32_t> pending_nodes;
+		bool high_priority = false;
+		// Never posted. It's completed along with the last node, so the run is awaited
+		// the same way as a task, including collaboratively from pool threads.
+		Task *completion_task = nullptr;
 	};
 
 	struct Task {
@@ -89,6 +107,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		TaskGraphRun *graph_run = nullptr;
+		uint32_t graph_node = 0;
 
 		void free_template_userdata();
 		Task() :
@@ -123,6 +143,9 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		// Only used when work stealing is enabled. Tasks posted by this thread go here;
+		// it pops them LIFO without locking, and other threads steal them FIFO.
+		WorkStealingDeque<Task *> local_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -164,6 +187,7 @@ private:
 			HashMapComparatorDefault<GroupID>,
 			PagedAllocator<HashMapElement<GroupID, Group *>, false, GROUPS_PAGE_SIZE>>
 			groups;
+	HashMap<TaskGraphID, TaskGraphRun *> task_graphs;
 
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
@@ -172,6 +196,8 @@ private:
 	uint64_t last_task = 1;
 	int pump_task_count = 0;
 
+	bool use_work_stealing = false;
+
 	static HashMap<StringName, WorkerThreadPool *> named_pools;
 
 	static void _thread_function(void *p_user);
@@ -183,6 +209,9 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	Task *_pop_or_steal_task(ThreadData *p_thread_data);
+	bool _has_local_queued_tasks() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -217,6 +246,15 @@ private:
 		}
 	};
 
+	static void _template_task_trampoline(void *p_userdata);
+	static void _template_group_task_trampoline(void *p_userdata, uint32_t p_index);
+
+	bool _post_task_graph_node(TaskGraphRun *p_run, uint32_t p_node, MutexLock<BinaryMutex> &p_lock);
+	bool _task_graph_node_done(TaskGraphRun *p_run, uint32_t p_node, MutexLock<BinaryMutex> &p_lock);
+	void _finish_task_graph(TaskGraphRun *p_run);
+
+	void _complete_task(Task *p_task);
+
 	void _wait_collaboratively(ThreadData *p_caller_pool_thread, Task *p_task);
 
 	void _switch_runlevel(Runlevel p_runlevel);
@@ -267,6 +305,84 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// A set of tasks and group tasks with dependencies between them, run as a whole
+	// with run_task_graph(). A node is posted as soon as all the nodes it depends on
+	// have completed, so independent stages can overlap instead of the caller having
+	// to wait for each one before posting the next.
+	// A graph can be run again once its previous run has completed. It must not be
+	// modified nor destroyed while a run is in progress.
+	// Like tasks, every run must be waited for with wait_for_task_graph_completion(),
+	// which is what frees it.
+	class TaskGraph {
+		friend class WorkerThreadPool;
+
+		struct Node {
+			Callable callable;
+			void (*native_func)(void *) = nullptr;
+			void (*native_group_func)(void *, uint32_t) = nullptr;
+			void *native_func_userdata = nullptr;
+			bool is_group = false;
+			int elements = 0;
+			int tasks = -1;
+			String description;
+			LocalVector<uint32_t> successors;
+			uint32_t dependency_count = 0;
+		};
+
+		LocalVector<Node> nodes;
+		LocalVector<BaseTemplateUserdata *> template_userdatas;
+
+		void (*continuation_func)(void *) = nullptr;
+		void *continuation_userdata = nullptr;
+
+		Node &_add_node(const String &p_description);
+
+	public:
+		typedef uint32_t NodeID;
+
+		template <typename C, typename M, typename U>
+		NodeID add_template_task(C *p_instance, M p_method, U p_userdata, const String &p_description = String()) {
+			typedef TaskUserData<C, M, U> TUD;
+			TUD *ud = memnew(TUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			template_userdatas.push_back(ud);
+			return add_native_task(&WorkerThreadPool::_template_task_trampoline, ud, p_description);
+		}
+		NodeID add_native_task(void (*p_func)(void *), void *p_userdata, const String &p_description = String());
+		NodeID add_task(const Callable &p_action, const String &p_description = String());
+
+		template <typename C, typename M, typename U>
+		NodeID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, const String &p_description = String()) {
+			typedef GroupUserData<C, M, U> GroupUD;
+			GroupUD *ud = memnew(GroupUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			template_userdatas.push_back(ud);
+			return add_native_group_task(&WorkerThreadPool::_template_group_task_trampoline, ud, p_elements, p_tasks, p_description);
+		}
+		NodeID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, const String &p_description = String());
+		NodeID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, const String &p_description = String());
+
+		// p_node won't start until p_depends_on has completed.
+		void add_dependency(NodeID p_node, NodeID p_depends_on);
+		// Called on the thread that completes the last node, before waiters are released.
+		void set_continuation(void (*p_func)(void *), void *p_userdata);
+
+		_FORCE_INLINE_ uint32_t get_node_count() const { return nodes.size(); }
+
+		TaskGraph() {}
+		TaskGraph(const TaskGraph &) = delete;
+		TaskGraph &operator=(const TaskGraph &) = delete;
+		~TaskGraph();
+	};
+
+	TaskGraphID run_task_graph(const TaskGraph &p_graph, bool p_high_priority = false);
+	bool is_task_graph_completed(TaskGraphID p_graph) const;
+	Error wait_for_task_graph_completion(TaskGraphID p_graph);
+
 	_FORCE_INLINE_ int get_thread_count() const {
 #ifdef THREADS_ENABLED
 		return threads.size();
@@ -295,7 +411,9 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	_FORCE_INLINE_ bool is_using_work_stealing() const { return use_work_stealing; }
+
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, bool p_use_work_stealing = true);
 	void exit_languages_threads();
 	void finish();
 	WorkerThreadPool(bool p_singleton = true);
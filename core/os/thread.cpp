@@ -35,6 +35,7 @@
 #include "thread.h"
 
 #ifdef THREADS_ENABLED
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 
 SafeNumeric<uint64_t> Thread::id_counter(1); // The first value after .increment() is 2, hence by default the main thread ID should be 1.
@@ -64,6 +65,7 @@ void Thread::callback(ID p_caller_id, const Settings &p_settings, Callback p_cal
 		p_callback(p_userdata);
 	}
 	ScriptServer::thread_exit();
+	CallQueue::thread_exit(); // Let other threads reuse the message buffers of this one.
 	if (platform_functions.term) {
 		platform_functions.term();
 	}
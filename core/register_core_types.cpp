@@ -72,6 +72,7 @@
 #include "core/math/random_number_generator.h"
 #include "core/math/triangle_mesh.h"
 #include "core/object/class_db.h"
+#include "core/object/property_batch.h"
 #include "core/object/script_backtrace.h"
 #include "core/object/script_language_extension.h"
 #include "core/object/undo_redo.h"
@@ -255,6 +256,7 @@ void register_core_types() {
 	GDREGISTER_CLASS(TranslationDomain);
 	GDREGISTER_CLASS(OptimizedTranslation);
 	GDREGISTER_CLASS(UndoRedo);
+	GDREGISTER_CLASS(PropertyBatch);
 	GDREGISTER_CLASS(TriangleMesh);
 
 	GDREGISTER_ABSTRACT_CLASS(FileAccess);
@@ -352,6 +354,7 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+	GLOBAL_DEF("threading/worker_pool/use_work_stealing", true);
 }
 
 void register_early_core_singletons() {
@@ -116,16 +116,39 @@ class RID_Alloc : public RID_AllocBase {
 
 	mutable Mutex mutex;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
+	// Validators are read without locking in thread-safe mode, so they are
+	// accessed atomically there. Bit 31 marks slots that are free or not
+	// initialized yet.
+	_FORCE_INLINE_ static uint32_t _load_validator(const Chunk &p_chunk) {
 		if constexpr (THREAD_SAFE) {
-			mutex.lock();
+			return ((const std::atomic<uint32_t> *)&p_chunk.validator)->load(std::memory_order_acquire);
+		} else {
+			return p_chunk.validator;
+		}
+	}
+
+	_FORCE_INLINE_ static void _store_validator(Chunk &p_chunk, uint32_t p_validator) {
+		if constexpr (THREAD_SAFE) {
+			((std::atomic<uint32_t> *)&p_chunk.validator)->store(p_validator, std::memory_order_release);
+		} else {
+			p_chunk.validator = p_validator;
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t _load_max_alloc() const {
+		if constexpr (THREAD_SAFE) { // Read atomically to avoid data race with the store in _allocate_rid_locked().
+			return ((const std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_acquire);
+		} else {
+			return max_alloc;
 		}
+	}
 
+	// Expects the mutex to be locked in thread-safe mode.
+	RID _allocate_rid_locked() {
 		if (alloc_count == max_alloc) {
 			//allocate a new chunk
 			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
 			if (THREAD_SAFE && chunk_count == chunk_limit) {
-				mutex.unlock();
 				if (description != nullptr) {
 					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
 				} else {
@@ -152,8 +175,8 @@ class RID_Alloc : public RID_AllocBase {
 			}
 
 			if constexpr (THREAD_SAFE) {
-				// Store atomically to avoid data race with the load in get_or_null().
-				((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_relaxed);
+				// Publish the new chunk to the lock-free readers in get_or_null() and owns().
+				((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_release);
 			} else {
 				max_alloc += elements_in_chunk;
 			}
@@ -169,16 +192,46 @@ class RID_Alloc : public RID_AllocBase {
 		id <<= 32;
 		id |= free_index;
 
-		chunks[free_chunk][free_element].validator = validator;
-		chunks[free_chunk][free_element].validator |= 0x80000000; //mark uninitialized bit
+		_store_validator(chunks[free_chunk][free_element], validator | 0x80000000); //mark uninitialized bit
 
 		alloc_count++;
 
+		return _make_from_id(id);
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
+
+		RID rid = _allocate_rid_locked();
+
 		if constexpr (THREAD_SAFE) {
 			mutex.unlock();
 		}
 
-		return _make_from_id(id);
+		return rid;
+	}
+
+	// Expects the mutex to be locked in thread-safe mode.
+	void _free_locked(const RID &p_rid) {
+		uint64_t id = p_rid.get_id();
+		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+		ERR_FAIL_COND(idx >= max_alloc);
+
+		uint32_t idx_chunk = idx / elements_in_chunk;
+		uint32_t idx_element = idx % elements_in_chunk;
+
+		uint32_t validator = uint32_t(id >> 32);
+		Chunk &c = chunks[idx_chunk][idx_element];
+		ERR_FAIL_COND_MSG(c.validator & 0x80000000, "Attempted to free an uninitialized or invalid RID");
+		ERR_FAIL_COND(c.validator != validator);
+
+		c.data.~T();
+		_store_validator(c, 0xFFFFFFFF); // go invalid
+
+		alloc_count--;
+		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
 	}
 
 public:
@@ -209,13 +262,7 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		uint32_t ma;
-		if constexpr (THREAD_SAFE) { // Read atomically to avoid data race with the store in _allocate_rid().
-			ma = ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_relaxed);
-		} else {
-			ma = max_alloc;
-		}
-		if (unlikely(idx >= ma)) {
+		if (unlikely(idx >= _load_max_alloc())) {
 			return nullptr;
 		}
 
@@ -241,19 +288,22 @@ public:
 #endif
 		}
 
+		// Generation check, no lock needed: a freed or reused slot has a different validator.
+		const uint32_t current_validator = _load_validator(c);
+
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(c.validator & 0x80000000))) {
+			if (unlikely(!(current_validator & 0x80000000))) {
 				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 			}
 
-			if (unlikely((c.validator & 0x7FFFFFFF) != validator)) {
+			if (unlikely((current_validator & 0x7FFFFFFF) != validator)) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			c.validator &= 0x7FFFFFFF; //initialized
+			_store_validator(c, current_validator & 0x7FFFFFFF); //initialized
 
-		} else if (unlikely(c.validator != validator)) {
-			if ((c.validator & 0x80000000) && c.validator != 0xFFFFFFFF) {
+		} else if (unlikely(current_validator != validator)) {
+			if ((current_validator & 0x80000000) && current_validator != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
@@ -320,14 +370,7 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		uint32_t ma;
-		if constexpr (THREAD_SAFE) {
-			ma = ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_relaxed);
-		} else {
-			ma = max_alloc;
-		}
-
-		if (unlikely(idx >= ma)) {
+		if (unlikely(idx >= _load_max_alloc())) {
 			return false;
 		}
 
@@ -353,7 +396,7 @@ public:
 #endif
 		}
 
-		bool owned = (c.validator & 0x7FFFFFFF) == validator;
+		bool owned = (_load_validator(c) & 0x7FFFFFFF) == validator;
 
 		if constexpr (THREAD_SAFE) {
 #ifdef TSAN_ENABLED
@@ -369,36 +412,7 @@ public:
 			mutex.lock();
 		}
 
-		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
-			ERR_FAIL();
-		}
-
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
-			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
-			ERR_FAIL();
-		}
-
-		chunks[idx_chunk][idx_element].data.~T();
-		chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
-
-		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
+		_free_locked(p_rid);
 
 		if constexpr (THREAD_SAFE) {
 			mutex.unlock();
@@ -413,10 +427,15 @@ public:
 		if constexpr (THREAD_SAFE) {
 			mutex.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
-			if (validator != 0xFFFFFFFF) {
-				owned.push_back(_make_from_id((validator << 32) | i));
+		owned.reserve(alloc_count);
+		const uint32_t chunk_count = max_alloc / elements_in_chunk;
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			const Chunk *chunk = chunks[i];
+			for (uint32_t j = 0; j < elements_in_chunk; j++) {
+				uint64_t validator = chunk[j].validator;
+				if (validator != 0xFFFFFFFF) {
+					owned.push_back(_make_from_id((validator << 32) | (i * elements_in_chunk + j)));
+				}
 			}
 		}
 		if constexpr (THREAD_SAFE) {
@@ -431,11 +450,15 @@ public:
 			mutex.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
-			if (validator != 0xFFFFFFFF) {
-				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
-				idx++;
+		const uint32_t chunk_count = max_alloc / elements_in_chunk;
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			const Chunk *chunk = chunks[i];
+			for (uint32_t j = 0; j < elements_in_chunk; j++) {
+				uint64_t validator = chunk[j].validator;
+				if (validator != 0xFFFFFFFF) {
+					p_rid_buffer[idx] = _make_from_id((validator << 32) | (i * elements_in_chunk + j));
+					idx++;
+				}
 			}
 		}
 
@@ -444,6 +467,30 @@ public:
 		}
 	}
 
+	// Calls `p_callback(RID, T *)` for every initialized element, walking each
+	// chunk in memory order. In thread-safe mode the owner is locked meanwhile,
+	// so the callback must not allocate or free RIDs from it.
+	template <typename C>
+	void for_each_owned(C p_callback) {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
+		const uint32_t chunk_count = max_alloc / elements_in_chunk;
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			Chunk *chunk = chunks[i];
+			for (uint32_t j = 0; j < elements_in_chunk; j++) {
+				uint64_t validator = chunk[j].validator;
+				if (validator & 0x80000000) {
+					continue; // Free or uninitialized.
+				}
+				p_callback(_make_from_id((validator << 32) | (i * elements_in_chunk + j)), &chunk[j].data);
+			}
+		}
+		if constexpr (THREAD_SAFE) {
+			mutex.unlock();
+		}
+	}
+
 	void set_description(const char *p_description) {
 		description = p_description;
 	}
@@ -542,6 +589,11 @@ public:
 		alloc.fill_owned_buffer(p_rid_buffer);
 	}
 
+	template <typename C>
+	void for_each_owned(C p_callback) {
+		alloc.for_each_owned([&p_callback](const RID &p_rid, T **p_ptr) { p_callback(p_rid, *p_ptr); });
+	}
+
 	void set_description(const char *p_description) {
 		alloc.set_description(p_description);
 	}
@@ -597,6 +649,11 @@ public:
 		alloc.fill_owned_buffer(p_rid_buffer);
 	}
 
+	template <typename C>
+	void for_each_owned(C p_callback) {
+		alloc.for_each_owned(p_callback);
+	}
+
 	void set_description(const char *p_description) {
 		alloc.set_description(p_description);
 	}
@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/packed_math.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/a_hash_map.h"
@@ -1167,6 +1168,41 @@ struct _VariantCall {
 		return ret;
 	}
 
+	template <typename T>
+	static Vector<T> func_Packed_add(Vector<T> *p_instance, const Vector<T> &p_with) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_with.size(), Vector<T>(), "Arrays must have the same size.");
+		return PackedMath::add(*p_instance, p_with);
+	}
+
+	template <typename T>
+	static Vector<T> func_Packed_lerp(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_to.size(), Vector<T>(), "Arrays must have the same size.");
+		return PackedMath::lerp(*p_instance, p_to, p_weight);
+	}
+
+	template <typename T>
+	static Vector<T> func_Packed_min(Vector<T> *p_instance, const Vector<T> &p_with) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_with.size(), Vector<T>(), "Arrays must have the same size.");
+		return PackedMath::min(*p_instance, p_with);
+	}
+
+	template <typename T>
+	static Vector<T> func_Packed_max(Vector<T> *p_instance, const Vector<T> &p_with) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_with.size(), Vector<T>(), "Arrays must have the same size.");
+		return PackedMath::max(*p_instance, p_with);
+	}
+
+	template <typename T>
+	static T func_Packed_dot(Vector<T> *p_instance, const Vector<T> &p_with) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_with.size(), T(), "Arrays must have the same size.");
+		return PackedMath::dot(*p_instance, p_with);
+	}
+
+	template <typename T>
+	static T func_Packed_sum(Vector<T> *p_instance) {
+		return PackedMath::sum(*p_instance);
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = &VariantInternalAccessor<Callable>::get(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2909,6 +2945,12 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 	bind_method(PackedFloat32Array, erase, sarray("value"), varray());
+	bind_function(PackedFloat32Array, add, _VariantCall::func_Packed_add<float>, sarray("with"), varray());
+	bind_function(PackedFloat32Array, lerp, _VariantCall::func_Packed_lerp<float>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_Packed_min<float>, sarray("with"), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_Packed_max<float>, sarray("with"), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_Packed_dot<float>, sarray("with"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_Packed_sum<float>, sarray(), varray());
 
 	/* Float64 Array */
 
@@ -2937,6 +2979,12 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 	bind_method(PackedFloat64Array, erase, sarray("value"), varray());
+	bind_function(PackedFloat64Array, add, _VariantCall::func_Packed_add<double>, sarray("with"), varray());
+	bind_function(PackedFloat64Array, lerp, _VariantCall::func_Packed_lerp<double>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_Packed_min<double>, sarray("with"), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_Packed_max<double>, sarray("with"), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_Packed_dot<double>, sarray("with"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_Packed_sum<double>, sarray(), varray());
 
 	/* String Array */
 
@@ -3021,6 +3069,11 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 	bind_method(PackedVector3Array, erase, sarray("value"), varray());
+	bind_function(PackedVector3Array, add, _VariantCall::func_Packed_add<Vector3>, sarray("with"), varray());
+	bind_function(PackedVector3Array, lerp, _VariantCall::func_Packed_lerp<Vector3>, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, min, _VariantCall::func_Packed_min<Vector3>, sarray("with"), varray());
+	bind_function(PackedVector3Array, max, _VariantCall::func_Packed_max<Vector3>, sarray("with"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_Packed_sum<Vector3>, sarray(), varray());
 
 	/* Color Array */
 
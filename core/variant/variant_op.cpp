@@ -303,6 +303,24 @@ void Variant::_register_variant_operators() {
 	register_op<OperatorEvaluatorMul<Color, Color, int64_t>>(Variant::OP_MULTIPLY, Variant::COLOR, Variant::INT);
 	register_op<OperatorEvaluatorMul<Color, Color, double>>(Variant::OP_MULTIPLY, Variant::COLOR, Variant::FLOAT);
 
+	register_op<OperatorEvaluatorPackedMul<float>>(Variant::OP_MULTIPLY, Variant::PACKED_FLOAT32_ARRAY, Variant::PACKED_FLOAT32_ARRAY);
+	register_op<OperatorEvaluatorPackedScale<float, int64_t>>(Variant::OP_MULTIPLY, Variant::PACKED_FLOAT32_ARRAY, Variant::INT);
+	register_op<OperatorEvaluatorPackedScale<float, double>>(Variant::OP_MULTIPLY, Variant::PACKED_FLOAT32_ARRAY, Variant::FLOAT);
+	register_op<OperatorEvaluatorPackedScaleInv<float, int64_t>>(Variant::OP_MULTIPLY, Variant::INT, Variant::PACKED_FLOAT32_ARRAY);
+	register_op<OperatorEvaluatorPackedScaleInv<float, double>>(Variant::OP_MULTIPLY, Variant::FLOAT, Variant::PACKED_FLOAT32_ARRAY);
+
+	register_op<OperatorEvaluatorPackedMul<double>>(Variant::OP_MULTIPLY, Variant::PACKED_FLOAT64_ARRAY, Variant::PACKED_FLOAT64_ARRAY);
+	register_op<OperatorEvaluatorPackedScale<double, int64_t>>(Variant::OP_MULTIPLY, Variant::PACKED_FLOAT64_ARRAY, Variant::INT);
+	register_op<OperatorEvaluatorPackedScale<double, double>>(Variant::OP_MULTIPLY, Variant::PACKED_FLOAT64_ARRAY, Variant::FLOAT);
+	register_op<OperatorEvaluatorPackedScaleInv<double, int64_t>>(Variant::OP_MULTIPLY, Variant::INT, Variant::PACKED_FLOAT64_ARRAY);
+	register_op<OperatorEvaluatorPackedScaleInv<double, double>>(Variant::OP_MULTIPLY, Variant::FLOAT, Variant::PACKED_FLOAT64_ARRAY);
+
+	register_op<OperatorEvaluatorPackedMul<Vector3>>(Variant::OP_MULTIPLY, Variant::PACKED_VECTOR3_ARRAY, Variant::PACKED_VECTOR3_ARRAY);
+	register_op<OperatorEvaluatorPackedScale<Vector3, int64_t>>(Variant::OP_MULTIPLY, Variant::PACKED_VECTOR3_ARRAY, Variant::INT);
+	register_op<OperatorEvaluatorPackedScale<Vector3, double>>(Variant::OP_MULTIPLY, Variant::PACKED_VECTOR3_ARRAY, Variant::FLOAT);
+	register_op<OperatorEvaluatorPackedScaleInv<Vector3, int64_t>>(Variant::OP_MULTIPLY, Variant::INT, Variant::PACKED_VECTOR3_ARRAY);
+	register_op<OperatorEvaluatorPackedScaleInv<Vector3, double>>(Variant::OP_MULTIPLY, Variant::FLOAT, Variant::PACKED_VECTOR3_ARRAY);
+
 	register_op<OperatorEvaluatorMul<Transform2D, Transform2D, Transform2D>>(Variant::OP_MULTIPLY, Variant::TRANSFORM2D, Variant::TRANSFORM2D);
 	register_op<OperatorEvaluatorMul<Transform2D, Transform2D, int64_t>>(Variant::OP_MULTIPLY, Variant::TRANSFORM2D, Variant::INT);
 	register_op<OperatorEvaluatorMul<Transform2D, Transform2D, double>>(Variant::OP_MULTIPLY, Variant::TRANSFORM2D, Variant::FLOAT);
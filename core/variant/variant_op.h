@@ -33,6 +33,7 @@
 #include "variant.h"
 
 #include "core/debugger/engine_debugger.h"
+#include "core/math/packed_math.h"
 #include "core/object/class_db.h"
 
 template <typename Evaluator>
@@ -701,6 +702,60 @@ public:
 	using ReturnType = Vector<T>;
 };
 
+template <typename T, typename S>
+class OperatorEvaluatorPackedScale : public CommonEvaluate<OperatorEvaluatorPackedScale<T, S>> {
+public:
+	static inline void validated_evaluate(const Variant *left, const Variant *right, Variant *r_ret) {
+		VariantInternalAccessor<Vector<T>>::get(r_ret) = PackedMath::scale(VariantInternalAccessor<Vector<T>>::get(left), VariantInternalAccessor<S>::get(right));
+	}
+	static void ptr_evaluate(const void *left, const void *right, void *r_ret) {
+		PtrToArg<Vector<T>>::encode(PackedMath::scale(PtrToArg<Vector<T>>::convert(left), PtrToArg<S>::convert(right)), r_ret);
+	}
+	using ReturnType = Vector<T>;
+};
+
+template <typename T, typename S>
+class OperatorEvaluatorPackedScaleInv : public CommonEvaluate<OperatorEvaluatorPackedScaleInv<T, S>> {
+public:
+	static inline void validated_evaluate(const Variant *left, const Variant *right, Variant *r_ret) {
+		VariantInternalAccessor<Vector<T>>::get(r_ret) = PackedMath::scale(VariantInternalAccessor<Vector<T>>::get(right), VariantInternalAccessor<S>::get(left));
+	}
+	static void ptr_evaluate(const void *left, const void *right, void *r_ret) {
+		PtrToArg<Vector<T>>::encode(PackedMath::scale(PtrToArg<Vector<T>>::convert(right), PtrToArg<S>::convert(left)), r_ret);
+	}
+	using ReturnType = Vector<T>;
+};
+
+template <typename T>
+class OperatorEvaluatorPackedMul {
+public:
+	static void evaluate(const Variant &p_left, const Variant &p_right, Variant *r_ret, bool &r_valid) {
+		const Vector<T> &a = VariantInternalAccessor<Vector<T>>::get(&p_left);
+		const Vector<T> &b = VariantInternalAccessor<Vector<T>>::get(&p_right);
+		if (unlikely(a.size() != b.size())) {
+			r_valid = false;
+			*r_ret = "Element-wise multiplication of arrays with different sizes";
+			return;
+		}
+		*r_ret = PackedMath::multiply(a, b);
+		r_valid = true;
+	}
+	static inline void validated_evaluate(const Variant *left, const Variant *right, Variant *r_ret) {
+		const Vector<T> &a = VariantInternalAccessor<Vector<T>>::get(left);
+		const Vector<T> &b = VariantInternalAccessor<Vector<T>>::get(right);
+		VariantInternalAccessor<Vector<T>>::get(r_ret) = Vector<T>();
+		ERR_FAIL_COND_MSG(a.size() != b.size(), "Element-wise multiplication of arrays with different sizes.");
+		VariantInternalAccessor<Vector<T>>::get(r_ret) = PackedMath::multiply(a, b);
+	}
+	static void ptr_evaluate(const void *left, const void *right, void *r_ret) {
+		const Vector<T> a = PtrToArg<Vector<T>>::convert(left);
+		const Vector<T> b = PtrToArg<Vector<T>>::convert(right);
+		ERR_FAIL_COND_MSG(a.size() != b.size(), "Element-wise multiplication of arrays with different sizes.");
+		PtrToArg<Vector<T>>::encode(PackedMath::multiply(a, b), r_ret);
+	}
+	static Variant::Type get_return_type() { return GetTypeInfo<Vector<T>>::VARIANT_TYPE; }
+};
+
 template <typename Left, typename Right>
 class OperatorEvaluatorStringConcat : public CommonEvaluate<OperatorEvaluatorStringConcat<Left, Right>> {
 public:
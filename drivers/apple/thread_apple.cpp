@@ -31,6 +31,7 @@
 #include "thread_apple.h"
 
 #include "core/error/error_macros.h"
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 #include "core/string/ustring.h"
 
@@ -55,6 +56,7 @@ void *Thread::thread_callback(void *p_data) {
 	thread_data->callback(thread_data->userdata);
 
 	ScriptServer::thread_exit();
+	CallQueue::thread_exit(); // Let other threads reuse the message buffers of this one.
 
 	// Clean up
 	memdelete(thread_data);
@@ -36,6 +36,7 @@
 #include "core/string/print_string.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -204,6 +205,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		munmap(mapped_data, mapped_size);
+		mapped_data = nullptr;
+		mapped_size = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -309,6 +316,31 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (mapped_data) {
+		return mapped_data;
+	}
+	if (flags != READ) {
+		return nullptr; // Writes through the stream wouldn't be coherent with the mapping.
+	}
+
+	uint64_t size = get_length();
+	if (size == 0 || size > (uint64_t)SIZE_MAX) {
+		return nullptr;
+	}
+
+	void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return nullptr; // Not fatal, callers fall back to regular reads.
+	}
+
+	mapped_data = (uint8_t *)data;
+	mapped_size = size;
+	return mapped_data;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -132,6 +132,9 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_PATH_CACHE_HIT_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_PATH_CACHE_MISS_COUNT);
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_PATH_SEARCH_POLYGON_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
@@ -227,6 +230,9 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_connected"),
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
+		PNAME("navigation_3d/path_cache_hits"),
+		PNAME("navigation_3d/path_cache_misses"),
+		PNAME("navigation_3d/path_search_polygons"),
 #endif // NAVIGATION_3D_DISABLED
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
@@ -451,6 +457,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case NAVIGATION_3D_PATH_CACHE_HIT_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT);
+		case NAVIGATION_3D_PATH_CACHE_MISS_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT);
+		case NAVIGATION_3D_PATH_SEARCH_POLYGON_COUNT:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_PATH_SEARCH_POLYGON_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 
 		default: {
@@ -524,6 +536,9 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
 
 	};
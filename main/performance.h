@@ -120,6 +120,9 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		NAVIGATION_3D_PATH_CACHE_HIT_COUNT,
+		NAVIGATION_3D_PATH_CACHE_MISS_COUNT,
+		NAVIGATION_3D_PATH_SEARCH_POLYGON_COUNT,
 #endif // _3D_DISABLED
 		MONITOR_MAX
 	};
@@ -31,6 +31,7 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -592,6 +593,7 @@ bool GDScript::_update_exports(bool *r_err, bool p_recursive_call, PlaceHolderSc
 				}
 				valid = false; // to show error in the editor
 				base_cache->valid = false;
+				GDScriptFunction::invalidate_inline_caches();
 				base_cache->inheriters_cache.clear(); // to prevent future stackoverflows
 				base_cache.unref();
 				base.unref();
@@ -810,7 +812,21 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	// Only first loads may use the bytecode cache, reloads must keep state.
+	const bool use_bytecode_cache = !has_instances && !valid && GDScriptBytecodeCache::is_enabled();
+
 	valid = false;
+	GDScriptFunction::invalidate_inline_caches();
+
+	if (use_bytecode_cache && GDScriptBytecodeCache::load(this) == OK) {
+		Error err = OK;
+		if (ScriptServer::is_scripting_enabled() || is_tool()) {
+			err = _static_init();
+		}
+		reloading = false;
+		return err;
+	}
+
 	GDScriptParser parser;
 	Error err;
 	if (!binary_tokens.is_empty()) {
@@ -881,6 +897,10 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	if (use_bytecode_cache) {
+		GDScriptBytecodeCache::save(this, &parser);
+	}
+
 	if (can_run) {
 		err = _static_init();
 		if (err) {
@@ -1563,6 +1583,8 @@ void GDScript::clear(ClearData *p_clear_data) {
 		is_root = true;
 	}
 
+	GDScriptFunction::invalidate_inline_caches();
+
 	{
 		MutexLock lock(func_ptrs_to_update_mutex);
 		for (UpdatableFuncPtr *updatable : func_ptrs_to_update) {
@@ -2347,6 +2369,7 @@ void GDScriptLanguage::finish() {
 
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
+	GDScriptBytecodeCache::clear();
 
 	// Clear dependencies between scripts, to ensure cyclic references are broken
 	// (to avoid leaks at exit).
@@ -2986,6 +3009,7 @@ GDScriptLanguage::GDScriptLanguage() {
 	_debug_max_call_stack = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "512," + itos(GDScriptFunction::MAX_CALL_DEPTH - 1) + ",1"), 1024);
 	track_call_stack = GLOBAL_DEF_RST("debug/settings/gdscript/always_track_call_stacks", false);
 	track_locals = GLOBAL_DEF_RST("debug/settings/gdscript/always_track_local_variables", false);
+	GLOBAL_DEF("gdscript/bytecode_cache/enabled", false);
 
 #ifdef DEBUG_ENABLED
 	track_call_stack = true;
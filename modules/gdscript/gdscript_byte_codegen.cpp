@@ -149,7 +149,7 @@ void GDScriptByteCodeGenerator::pop_temporary() {
 void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
 		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
-		function->default_arguments.push_back(opcodes.size());
+		function->default_arguments.push_back(get_jump_target());
 	}
 }
 
@@ -228,6 +228,9 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_code_size = 0;
 	}
 
+	function->_inline_caches_count = inline_cache_count;
+	function->inline_caches = inline_cache_count ? memnew_arr(GDScriptFunction::InlineCache, inline_cache_count) : nullptr;
+
 	if (function->default_arguments.size()) {
 		function->_default_arg_count = function->default_arguments.size() - 1;
 		function->_default_arg_ptr = &function->default_arguments[0];
@@ -556,6 +559,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
 
+		fusable_instruction_pos = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(Address());
@@ -613,7 +617,11 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
-		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+		// Typed member get followed by an operator, like `velocity.x * delta`.
+		if (!try_fuse_with_last(GDScriptFunction::OPCODE_GET_NAMED_VALIDATED, 4, GDScriptFunction::OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED)) {
+			fusable_instruction_pos = opcodes.size();
+			append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+		}
 		append(p_left_operand);
 		append(p_right_operand);
 		append(p_target);
@@ -691,14 +699,14 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	write_jump_if_not_opcode();
 	append(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	write_jump_if_not_opcode();
 	append(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
@@ -721,14 +729,14 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
+	write_jump_if_opcode();
 	append(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_or_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
+	write_jump_if_opcode();
 	append(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
@@ -755,7 +763,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	write_jump_if_not_opcode();
 	append(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
@@ -859,11 +867,13 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_source) && Variant::get_member_validated_getter(p_source.type.builtin_type, p_name)) {
 		Variant::ValidatedGetter getter = Variant::get_member_validated_getter(p_source.type.builtin_type, p_name);
+		fusable_instruction_pos = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_GET_NAMED_VALIDATED);
 		append(p_source);
 		append(p_target);
@@ -877,6 +887,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -993,7 +1004,10 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_source);
 		append(p_target.type.builtin_type);
 	} else {
-		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
+		// Operation followed by an assignment of its result, like `i += 1`.
+		if (!try_fuse_with_last(GDScriptFunction::OPCODE_OPERATOR_VALIDATED, 5, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN)) {
+			append_opcode(GDScriptFunction::OPCODE_ASSIGN);
+		}
 		append(p_target);
 		append(p_source);
 	}
@@ -1020,7 +1034,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 	} else {
 		write_assign(p_dst, p_src);
 	}
-	function->default_arguments.push_back(opcodes.size());
+	function->default_arguments.push_back(get_jump_target());
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
@@ -1090,6 +1104,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1115,6 +1130,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1349,6 +1365,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1362,6 +1379,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1375,6 +1393,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1509,7 +1528,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	write_jump_if_not_opcode();
 	append(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
@@ -1726,7 +1745,7 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	append(opcodes.size() + (p_is_range ? 7 : 6)); // Skip over 'continue' code.
 
 	// Next iteration.
-	int continue_addr = opcodes.size();
+	int continue_addr = get_jump_target();
 	continue_addrs.push_back(continue_addr);
 	append_opcode(iterate_opcode);
 	append(counter);
@@ -1750,7 +1769,7 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 
 void GDScriptByteCodeGenerator::write_endfor(bool p_is_range) {
 	// Jump back to loop check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP);
+	write_jump_opcode();
 	append(continue_addrs.back()->get());
 	continue_addrs.pop_back();
 
@@ -1779,12 +1798,12 @@ void GDScriptByteCodeGenerator::write_endfor(bool p_is_range) {
 
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
-	continue_addrs.push_back(opcodes.size());
+	continue_addrs.push_back(get_jump_target());
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	write_jump_if_not_opcode();
 	append(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
@@ -1792,7 +1811,7 @@ void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 
 void GDScriptByteCodeGenerator::write_endwhile() {
 	// Jump back to loop check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP);
+	write_jump_opcode();
 	append(continue_addrs.back()->get());
 	continue_addrs.pop_back();
 
@@ -1814,7 +1833,7 @@ void GDScriptByteCodeGenerator::write_break() {
 }
 
 void GDScriptByteCodeGenerator::write_continue() {
-	append_opcode(GDScriptFunction::OPCODE_JUMP);
+	write_jump_opcode();
 	append(continue_addrs.back()->get());
 }
 
@@ -100,6 +100,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 
+	// Some common instruction sequences are fused into superinstructions, which save dispatches in hot
+	// loops. This is the position of the last instruction a following one may be fused with, or -1 when
+	// a jump target was placed after it (fusing would make the jump land in the middle of an instruction).
+	static inline bool superinstructions_enabled = true;
+	int fusable_instruction_pos = -1;
+	int inline_cache_count = 0;
+
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
@@ -399,6 +406,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_name_map_pos(p_name));
 	}
 
+	// Reserves a GDScriptFunction::InlineCache slot for the instruction being written.
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void append(const Variant::ValidatedOperatorEvaluator p_operation) {
 		opcodes.push_back(get_operation_pos(p_operation));
 	}
@@ -453,9 +465,49 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		fusable_instruction_pos = -1;
+	}
+
+	// Jump targets must not be placed between two fused instructions.
+	int get_jump_target() {
+		fusable_instruction_pos = -1;
+		return opcodes.size();
+	}
+
+	// If the last instruction is `p_first` (taking `p_size` slots), turns it into `p_fused`. The caller
+	// then appends the arguments of the following instruction, without its opcode.
+	bool try_fuse_with_last(GDScriptFunction::Opcode p_first, int p_size, GDScriptFunction::Opcode p_fused) {
+		if (!superinstructions_enabled || fusable_instruction_pos < 0 || fusable_instruction_pos + p_size != opcodes.size() || opcodes[fusable_instruction_pos] != p_first) {
+			return false;
+		}
+		opcodes.write[fusable_instruction_pos] = p_fused;
+		return true;
+	}
+
+	// Compare and branch, like `while i < count:`.
+	void write_jump_if_not_opcode() {
+		if (!try_fuse_with_last(GDScriptFunction::OPCODE_OPERATOR_VALIDATED, 5, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT)) {
+			append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		}
+	}
+
+	void write_jump_if_opcode() {
+		if (!try_fuse_with_last(GDScriptFunction::OPCODE_OPERATOR_VALIDATED, 5, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF)) {
+			append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
+		}
+	}
+
+	// Increment and loop back, like `i += 1` at the end of a `while` loop.
+	void write_jump_opcode() {
+		if (!try_fuse_with_last(GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN, 7, GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN_JUMP)) {
+			append_opcode(GDScriptFunction::OPCODE_JUMP);
+		}
 	}
 
 public:
+	static void set_superinstructions_enabled(bool p_enabled) { superinstructions_enabled = p_enabled; }
+	static bool is_superinstructions_enabled() { return superinstructions_enabled; }
+
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local_constant(const StringName &p_name, const Variant &p_constant) override;
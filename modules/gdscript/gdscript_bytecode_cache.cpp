@@ -0,0 +1,2114 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript.h"
+#include "gdscript_byte_codegen.h"
+#include "gdscript_cache.h"
+#include "gdscript_parser.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/version.h"
+
+// "GDBC" in little endian.
+static const uint32_t CACHE_MAGIC = 0x43424447;
+static const int MAX_VARIANT_DEPTH = 512;
+
+// Stored in front of every value written by `_write_variant()`.
+enum {
+	VARIANT_TAG_VALUE, // Anything `encode_variant()` can store without objects.
+	VARIANT_TAG_NULL_OBJECT,
+	VARIANT_TAG_NATIVE_CLASS,
+	VARIANT_TAG_SCRIPT,
+	VARIANT_TAG_RESOURCE,
+	VARIANT_TAG_ARRAY,
+	VARIANT_TAG_DICTIONARY,
+};
+
+// Stored in front of every script written by `_write_script_ref()`.
+enum {
+	SCRIPT_REF_NONE,
+	SCRIPT_REF_GDSCRIPT, // Root path and fully qualified class name.
+	SCRIPT_REF_OTHER, // Resource path.
+};
+
+struct GDScriptBytecodeCache::Writer {
+	LocalVector<uint8_t> data;
+	GDScript *root = nullptr;
+	// Other script files referenced by types and constants.
+	HashSet<String> referenced_paths;
+	// Set when something can't be stored; the script is then not cached at all.
+	bool failed = false;
+
+	void put_u8(uint8_t p_value) {
+		data.push_back(p_value);
+	}
+
+	void put_u32(uint32_t p_value) {
+		uint32_t pos = data.size();
+		data.resize(pos + 4);
+		encode_uint32(p_value, &data[pos]);
+	}
+
+	void put_u64(uint64_t p_value) {
+		uint32_t pos = data.size();
+		data.resize(pos + 8);
+		encode_uint64(p_value, &data[pos]);
+	}
+
+	void put_s32(int32_t p_value) {
+		put_u32((uint32_t)p_value);
+	}
+
+	void put_bool(bool p_value) {
+		put_u8(p_value ? 1 : 0);
+	}
+
+	void put_buffer(const uint8_t *p_buffer, uint32_t p_size) {
+		if (p_size == 0) {
+			return;
+		}
+		uint32_t pos = data.size();
+		data.resize(pos + p_size);
+		memcpy(&data[pos], p_buffer, p_size);
+	}
+
+	void put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		put_u32(utf8.length());
+		put_buffer((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+
+	void put_name(const StringName &p_name) {
+		put_string(p_name);
+	}
+
+	void put_source_hash(const SourceHash &p_hash) {
+		put_buffer(p_hash.sha256, sizeof(p_hash.sha256));
+		put_u64(p_hash.length);
+	}
+};
+
+struct GDScriptBytecodeCache::Reader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t pos = 0;
+	GDScript *root = nullptr;
+	bool failed = false;
+
+	const uint8_t *get_buffer(uint32_t p_size) {
+		if (failed || p_size > size - pos) {
+			failed = true;
+			return nullptr;
+		}
+		const uint8_t *ptr = data + pos;
+		pos += p_size;
+		return ptr;
+	}
+
+	uint8_t get_u8() {
+		const uint8_t *ptr = get_buffer(1);
+		return ptr ? *ptr : 0;
+	}
+
+	uint32_t get_u32() {
+		const uint8_t *ptr = get_buffer(4);
+		return ptr ? decode_uint32(ptr) : 0;
+	}
+
+	uint64_t get_u64() {
+		const uint8_t *ptr = get_buffer(8);
+		return ptr ? decode_uint64(ptr) : 0;
+	}
+
+	int32_t get_s32() {
+		return (int32_t)get_u32();
+	}
+
+	bool get_bool() {
+		return get_u8() != 0;
+	}
+
+	// Element counts are checked against the remaining data, so a damaged
+	// file can't cause huge allocations.
+	uint32_t get_count(uint32_t p_min_element_size = 1) {
+		uint32_t count = get_u32();
+		if (failed || (uint64_t)count * p_min_element_size > size - pos) {
+			failed = true;
+			return 0;
+		}
+		return count;
+	}
+
+	String get_string() {
+		uint32_t length = get_count();
+		const uint8_t *ptr = get_buffer(length);
+		if (ptr == nullptr || length == 0) {
+			return String();
+		}
+		return String::utf8((const char *)ptr, length);
+	}
+
+	StringName get_name() {
+		return StringName(get_string());
+	}
+
+	SourceHash get_source_hash() {
+		SourceHash hash;
+		const uint8_t *ptr = get_buffer(sizeof(hash.sha256));
+		if (ptr) {
+			memcpy(hash.sha256, ptr, sizeof(hash.sha256));
+		}
+		hash.length = get_u64();
+		return hash;
+	}
+};
+
+Mutex GDScriptBytecodeCache::mutex;
+GDScriptBytecodeCache::FunctionTables *GDScriptBytecodeCache::function_tables = nullptr;
+HashMap<String, GDScriptBytecodeCache::SourceHash> GDScriptBytecodeCache::source_hashes;
+
+const GDScriptBytecodeCache::FunctionTables &GDScriptBytecodeCache::_get_function_tables() {
+	MutexLock lock(mutex);
+	if (function_tables) {
+		return *function_tables;
+	}
+
+	// Reverse lookup of every validated function the code generator can use,
+	// built once. Several keys can share one function, any of them will do.
+	FunctionTables *tables = memnew(FunctionTables);
+
+	for (int op = 0; op < Variant::OP_MAX; op++) {
+		for (int a = 0; a < Variant::VARIANT_MAX; a++) {
+			for (int b = 0; b < Variant::VARIANT_MAX; b++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator((Variant::Operator)op, (Variant::Type)a, (Variant::Type)b);
+				if (evaluator && !tables->operators.has(evaluator)) {
+					tables->operators.insert(evaluator, FunctionKey(op, a, b));
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < Variant::VARIANT_MAX; i++) {
+		const Variant::Type type = (Variant::Type)i;
+
+		List<StringName> members;
+		Variant::get_member_list(type, &members);
+		for (const StringName &member : members) {
+			Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, member);
+			if (setter && !tables->setters.has(setter)) {
+				tables->setters.insert(setter, FunctionKey(i, 0, 0, member));
+			}
+			Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, member);
+			if (getter && !tables->getters.has(getter)) {
+				tables->getters.insert(getter, FunctionKey(i, 0, 0, member));
+			}
+		}
+
+		Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type);
+		if (keyed_setter && !tables->keyed_setters.has(keyed_setter)) {
+			tables->keyed_setters.insert(keyed_setter, FunctionKey(i));
+		}
+		Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type);
+		if (keyed_getter && !tables->keyed_getters.has(keyed_getter)) {
+			tables->keyed_getters.insert(keyed_getter, FunctionKey(i));
+		}
+		Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type);
+		if (indexed_setter && !tables->indexed_setters.has(indexed_setter)) {
+			tables->indexed_setters.insert(indexed_setter, FunctionKey(i));
+		}
+		Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type);
+		if (indexed_getter && !tables->indexed_getters.has(indexed_getter)) {
+			tables->indexed_getters.insert(indexed_getter, FunctionKey(i));
+		}
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(type, &methods);
+		for (const StringName &method : methods) {
+			Variant::ValidatedBuiltInMethod builtin_method = Variant::get_validated_builtin_method(type, method);
+			if (builtin_method && !tables->builtin_methods.has(builtin_method)) {
+				tables->builtin_methods.insert(builtin_method, FunctionKey(i, 0, 0, method));
+			}
+		}
+
+		for (int j = 0; j < Variant::get_constructor_count(type); j++) {
+			Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(type, j);
+			if (constructor && !tables->constructors.has(constructor)) {
+				tables->constructors.insert(constructor, FunctionKey(i, j));
+			}
+		}
+	}
+
+	List<StringName> utilities;
+	Variant::get_utility_function_list(&utilities);
+	for (const StringName &utility : utilities) {
+		Variant::ValidatedUtilityFunction function = Variant::get_validated_utility_function(utility);
+		if (function && !tables->utilities.has(function)) {
+			tables->utilities.insert(function, FunctionKey(0, 0, 0, utility));
+		}
+	}
+
+	List<StringName> gds_utilities;
+	GDScriptUtilityFunctions::get_function_list(&gds_utilities);
+	for (const StringName &utility : gds_utilities) {
+		GDScriptUtilityFunctions::FunctionPtr function = GDScriptUtilityFunctions::get_function(utility);
+		if (function && !tables->gds_utilities.has(function)) {
+			tables->gds_utilities.insert(function, FunctionKey(0, 0, 0, utility));
+		}
+	}
+
+	function_tables = tables;
+	return *function_tables;
+}
+
+String GDScriptBytecodeCache::_get_engine_key() {
+	// Everything that changes the generated code without changing the script.
+	String key = vformat("%s.%s", GODOT_VERSION_FULL_BUILD, GODOT_VERSION_HASH);
+#ifdef DEBUG_ENABLED
+	key += ".debug";
+#endif
+#ifdef TOOLS_ENABLED
+	key += ".tools";
+#endif
+#ifdef REAL_T_IS_DOUBLE
+	key += ".double";
+#endif
+#ifdef BIG_ENDIAN_ENABLED
+	key += ".be";
+#endif
+	if (GDScriptByteCodeGenerator::is_superinstructions_enabled()) {
+		key += ".superinstructions";
+	}
+	if (GDScriptLanguage::get_singleton()->should_track_locals()) {
+		key += ".locals";
+	}
+
+	// Local builds may renumber opcodes or change how addresses are encoded without bumping the version.
+	uint32_t layout_hash = hash_murmur3_one_32(GDScriptFunction::OPCODE_END);
+	layout_hash = hash_murmur3_one_32(GDScriptFunction::OPCODE_LINE, layout_hash);
+	layout_hash = hash_murmur3_one_32(GDScriptFunction::ADDR_BITS, layout_hash);
+	layout_hash = hash_murmur3_one_32(GDScriptFunction::ADDR_TYPE_CONSTANT, layout_hash);
+	layout_hash = hash_murmur3_one_32(GDScriptFunction::ADDR_TYPE_MEMBER, layout_hash);
+	layout_hash = hash_murmur3_one_32(GDScriptFunction::ADDR_TYPE_MAX, layout_hash);
+	layout_hash = hash_murmur3_one_32(GDScriptFunction::FIXED_ADDRESSES_MAX, layout_hash);
+	key += vformat(".%d.%08x", GDScriptFunction::OPCODE_END, hash_fmix32(layout_hash));
+	return key;
+}
+
+uint32_t GDScriptBytecodeCache::_get_environment_hash() {
+	// Global indices are baked into the bytecode, and global classes and
+	// autoloads decide what identifiers resolve to. Sums keep the hash
+	// independent of iteration order.
+	uint32_t hash = 0;
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		hash += hash_fmix32(hash_murmur3_one_32(E.value, E.key.hash()));
+	}
+
+	LocalVector<StringName> global_classes;
+	ScriptServer::get_global_class_list(global_classes);
+	for (const StringName &name : global_classes) {
+		hash += hash_fmix32(hash_murmur3_one_32(ScriptServer::get_global_class_path(name).hash(), name.hash()));
+	}
+
+	for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+		hash += hash_fmix32(hash_murmur3_one_32(E.value.path.hash(), hash_murmur3_one_32(E.value.is_singleton, E.key.hash())));
+	}
+	return hash;
+}
+
+GDScriptBytecodeCache::SourceHash GDScriptBytecodeCache::_hash_source(const uint8_t *p_data, uint64_t p_length) {
+	// A 32-bit hash collides too easily to tell sources apart on its own.
+	SourceHash hash;
+	hash.length = p_length;
+	CryptoCore::sha256(p_data, p_length, hash.sha256);
+	return hash;
+}
+
+GDScriptBytecodeCache::SourceHash GDScriptBytecodeCache::_get_source_hash(const String &p_path) {
+	{
+		MutexLock lock(mutex);
+		const SourceHash *hash = source_hashes.getptr(p_path);
+		if (hash) {
+			return *hash;
+		}
+	}
+
+	// Hashed the same way as `_get_script_source_hash()`.
+	const String remapped_path = ResourceLoader::path_remap(p_path);
+	SourceHash hash;
+	if (FileAccess::exists(remapped_path)) {
+		if (remapped_path.has_extension("gdc")) {
+			Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+			hash = _hash_source(tokens.ptr(), tokens.size());
+		} else {
+			CharString source = GDScriptCache::get_source_code(remapped_path).utf8();
+			hash = _hash_source((const uint8_t *)source.get_data(), source.length());
+		}
+	}
+
+	MutexLock lock(mutex);
+	source_hashes[p_path] = hash;
+	return hash;
+}
+
+GDScriptBytecodeCache::SourceHash GDScriptBytecodeCache::_get_script_source_hash(const GDScript *p_script) {
+	if (!p_script->binary_tokens.is_empty()) {
+		return _hash_source(p_script->binary_tokens.ptr(), p_script->binary_tokens.size());
+	}
+	CharString source = p_script->source.utf8();
+	return _hash_source((const uint8_t *)source.get_data(), source.length());
+}
+
+bool GDScriptBytecodeCache::_is_cacheable(const GDScript *p_script) {
+	return is_enabled() && p_script->is_root_script() && p_script->path.is_resource_file();
+}
+
+void GDScriptBytecodeCache::_write_key(Writer &p_writer, const FunctionKey &p_key) {
+	p_writer.put_s32(p_key.a);
+	p_writer.put_s32(p_key.b);
+	p_writer.put_s32(p_key.c);
+	p_writer.put_name(p_key.name);
+}
+
+GDScriptBytecodeCache::FunctionKey GDScriptBytecodeCache::_read_key(Reader &p_reader) {
+	FunctionKey key;
+	key.a = p_reader.get_s32();
+	key.b = p_reader.get_s32();
+	key.c = p_reader.get_s32();
+	key.name = p_reader.get_name();
+	return key;
+}
+
+void GDScriptBytecodeCache::_write_property_info(Writer &p_writer, const PropertyInfo &p_info) {
+	p_writer.put_u32(p_info.type);
+	p_writer.put_string(p_info.name);
+	p_writer.put_name(p_info.class_name);
+	p_writer.put_u32(p_info.hint);
+	p_writer.put_string(p_info.hint_string);
+	p_writer.put_u32(p_info.usage);
+}
+
+PropertyInfo GDScriptBytecodeCache::_read_property_info(Reader &p_reader) {
+	PropertyInfo info;
+	info.type = (Variant::Type)p_reader.get_u32();
+	info.name = p_reader.get_string();
+	info.class_name = p_reader.get_name();
+	info.hint = (PropertyHint)p_reader.get_u32();
+	info.hint_string = p_reader.get_string();
+	info.usage = p_reader.get_u32();
+	if (info.type >= Variant::VARIANT_MAX) {
+		p_reader.failed = true;
+	}
+	return info;
+}
+
+void GDScriptBytecodeCache::_write_method_info(Writer &p_writer, const MethodInfo &p_info) {
+	p_writer.put_string(p_info.name);
+	p_writer.put_u32(p_info.flags);
+	_write_property_info(p_writer, p_info.return_val);
+	p_writer.put_u32(p_info.arguments.size());
+	for (const PropertyInfo &argument : p_info.arguments) {
+		_write_property_info(p_writer, argument);
+	}
+	p_writer.put_u32(p_info.default_arguments.size());
+	for (const Variant &default_argument : p_info.default_arguments) {
+		_write_variant(p_writer, default_argument);
+	}
+}
+
+MethodInfo GDScriptBytecodeCache::_read_method_info(Reader &p_reader) {
+	MethodInfo info;
+	info.name = p_reader.get_string();
+	info.flags = p_reader.get_u32();
+	info.return_val = _read_property_info(p_reader);
+	uint32_t argument_count = p_reader.get_count();
+	for (uint32_t i = 0; i < argument_count && !p_reader.failed; i++) {
+		info.arguments.push_back(_read_property_info(p_reader));
+	}
+	uint32_t default_count = p_reader.get_count();
+	for (uint32_t i = 0; i < default_count && !p_reader.failed; i++) {
+		info.default_arguments.push_back(_read_variant(p_reader));
+	}
+	return info;
+}
+
+void GDScriptBytecodeCache::_write_script_ref(Writer &p_writer, Script *p_script) {
+	if (p_script == nullptr) {
+		p_writer.put_u8(SCRIPT_REF_NONE);
+		return;
+	}
+
+	GDScript *gdscript = Object::cast_to<GDScript>(p_script);
+	if (gdscript) {
+		const bool local = gdscript->get_root_script() == p_writer.root;
+		if (!local && !gdscript->path.is_resource_file()) {
+			p_writer.failed = true; // Built-in or unsaved script.
+			return;
+		}
+		if (!local) {
+			p_writer.referenced_paths.insert(gdscript->path);
+		}
+		p_writer.put_u8(SCRIPT_REF_GDSCRIPT);
+		p_writer.put_string(gdscript->path);
+		p_writer.put_string(gdscript->fully_qualified_name);
+		return;
+	}
+
+	if (!p_script->get_path().is_resource_file()) {
+		p_writer.failed = true;
+		return;
+	}
+	p_writer.put_u8(SCRIPT_REF_OTHER);
+	p_writer.put_string(p_script->get_path());
+}
+
+Ref<Script> GDScriptBytecodeCache::_read_script_ref(Reader &p_reader, bool &r_local) {
+	r_local = false;
+	switch (p_reader.get_u8()) {
+		case SCRIPT_REF_NONE: {
+			return Ref<Script>();
+		} break;
+		case SCRIPT_REF_GDSCRIPT: {
+			const String path = p_reader.get_string();
+			const String fqcn = p_reader.get_string();
+			if (p_reader.failed) {
+				return Ref<Script>();
+			}
+
+			GDScript *script = nullptr;
+			if (path == p_reader.root->path) {
+				script = p_reader.root->find_class(fqcn);
+				r_local = true;
+			} else {
+				// Same as the compiler: other scripts only need to be shallow
+				// now, `GDScriptCache::finish_compiling()` completes them.
+				Error err = OK;
+				Ref<GDScript> other = GDScriptCache::get_shallow_script(path, err, p_reader.root->path);
+				if (err == OK && other.is_valid()) {
+					script = other->find_class(fqcn);
+				}
+			}
+			if (script == nullptr) {
+				p_reader.failed = true;
+			}
+			return Ref<Script>(script);
+		} break;
+		case SCRIPT_REF_OTHER: {
+			const String path = p_reader.get_string();
+			if (p_reader.failed) {
+				return Ref<Script>();
+			}
+			Ref<Script> script = ResourceLoader::load(path, "Script");
+			if (script.is_null()) {
+				p_reader.failed = true;
+			}
+			return script;
+		} break;
+	}
+	p_reader.failed = true;
+	return Ref<Script>();
+}
+
+void GDScriptBytecodeCache::_write_data_type(Writer &p_writer, const GDScriptDataType &p_type) {
+	p_writer.put_u8(p_type.kind);
+	p_writer.put_u32(p_type.builtin_type);
+	p_writer.put_name(p_type.native_type);
+	if (p_type.kind == GDScriptDataType::SCRIPT || p_type.kind == GDScriptDataType::GDSCRIPT) {
+		_write_script_ref(p_writer, p_type.script_type);
+		p_writer.put_bool(p_type.script_type_ref.is_valid());
+	}
+	p_writer.put_u32(p_type.container_element_types.size());
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		_write_data_type(p_writer, element_type);
+	}
+}
+
+GDScriptDataType GDScriptBytecodeCache::_read_data_type(Reader &p_reader) {
+	GDScriptDataType type;
+	const uint8_t kind = p_reader.get_u8();
+	type.builtin_type = (Variant::Type)p_reader.get_u32();
+	type.native_type = p_reader.get_name();
+	if (kind > GDScriptDataType::GDSCRIPT || type.builtin_type >= Variant::VARIANT_MAX) {
+		p_reader.failed = true;
+		return type;
+	}
+	type.kind = (GDScriptDataType::Kind)kind;
+
+	if (type.kind == GDScriptDataType::SCRIPT || type.kind == GDScriptDataType::GDSCRIPT) {
+		bool local = false;
+		Ref<Script> script = _read_script_ref(p_reader, local);
+		// Like the compiler, only hold references to classes of other files.
+		const bool strong = p_reader.get_bool();
+		type.script_type = script.ptr();
+		if (strong) {
+			type.script_type_ref = script;
+		}
+	}
+
+	uint32_t element_count = p_reader.get_count();
+	for (uint32_t i = 0; i < element_count && !p_reader.failed; i++) {
+		type.set_container_element_type(i, _read_data_type(p_reader));
+	}
+	return type;
+}
+
+void GDScriptBytecodeCache::_write_variant(Writer &p_writer, const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Object *object = p_value.get_validated_object();
+			if (object == nullptr) {
+				p_writer.put_u8(VARIANT_TAG_NULL_OBJECT);
+				return;
+			}
+
+			GDScriptNativeClass *native_class = Object::cast_to<GDScriptNativeClass>(object);
+			if (native_class) {
+				p_writer.put_u8(VARIANT_TAG_NATIVE_CLASS);
+				p_writer.put_name(native_class->get_name());
+				return;
+			}
+
+			Script *script = Object::cast_to<Script>(object);
+			if (script) {
+				p_writer.put_u8(VARIANT_TAG_SCRIPT);
+				_write_script_ref(p_writer, script);
+				return;
+			}
+
+			Resource *resource = Object::cast_to<Resource>(object);
+			if (resource && resource->get_path().is_resource_file()) {
+				p_writer.put_u8(VARIANT_TAG_RESOURCE);
+				p_writer.put_string(resource->get_path());
+				p_writer.put_string(resource->get_class());
+				return;
+			}
+
+			// Objects that only exist in memory can't be restored.
+			p_writer.failed = true;
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			const Ref<Script> typed_script = array.get_typed_script();
+			p_writer.put_u8(VARIANT_TAG_ARRAY);
+			p_writer.put_u32(array.get_typed_builtin());
+			p_writer.put_name(array.get_typed_class_name());
+			_write_script_ref(p_writer, typed_script.ptr());
+			p_writer.put_bool(array.is_read_only());
+			p_writer.put_u32(array.size());
+			for (int i = 0; i < array.size() && !p_writer.failed; i++) {
+				_write_variant(p_writer, array[i]);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			const Ref<Script> key_script = dictionary.get_typed_key_script();
+			const Ref<Script> value_script = dictionary.get_typed_value_script();
+			p_writer.put_u8(VARIANT_TAG_DICTIONARY);
+			p_writer.put_u32(dictionary.get_typed_key_builtin());
+			p_writer.put_name(dictionary.get_typed_key_class_name());
+			_write_script_ref(p_writer, key_script.ptr());
+			p_writer.put_u32(dictionary.get_typed_value_builtin());
+			p_writer.put_name(dictionary.get_typed_value_class_name());
+			_write_script_ref(p_writer, value_script.ptr());
+			p_writer.put_bool(dictionary.is_read_only());
+			p_writer.put_u32(dictionary.size());
+			for (const KeyValue<Variant, Variant> &kv : dictionary) {
+				if (p_writer.failed) {
+					break;
+				}
+				_write_variant(p_writer, kv.key);
+				_write_variant(p_writer, kv.value);
+			}
+		} break;
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID: {
+			// Only meaningful within one run.
+			p_writer.failed = true;
+		} break;
+		default: {
+			int length = 0;
+			Error err = encode_variant(p_value, nullptr, length, false);
+			if (err != OK) {
+				p_writer.failed = true;
+				return;
+			}
+			p_writer.put_u8(VARIANT_TAG_VALUE);
+			p_writer.put_u32(length);
+			uint32_t pos = p_writer.data.size();
+			p_writer.data.resize(pos + length);
+			encode_variant(p_value, &p_writer.data[pos], length, false);
+		} break;
+	}
+}
+
+Variant GDScriptBytecodeCache::_read_variant(Reader &p_reader, int p_depth) {
+	if (p_depth > MAX_VARIANT_DEPTH) {
+		p_reader.failed = true;
+		return Variant();
+	}
+
+	switch (p_reader.get_u8()) {
+		case VARIANT_TAG_VALUE: {
+			const uint32_t length = p_reader.get_count();
+			const uint8_t *buffer = p_reader.get_buffer(length);
+			Variant value;
+			if (buffer == nullptr || decode_variant(value, buffer, length, nullptr, false) != OK) {
+				p_reader.failed = true;
+			}
+			return value;
+		} break;
+		case VARIANT_TAG_NULL_OBJECT: {
+			return Variant((Object *)nullptr);
+		} break;
+		case VARIANT_TAG_NATIVE_CLASS: {
+			const StringName name = p_reader.get_name();
+			const int *index = GDScriptLanguage::get_singleton()->get_global_map().getptr(name);
+			if (index == nullptr) {
+				p_reader.failed = true;
+				return Variant();
+			}
+			return GDScriptLanguage::get_singleton()->get_global_array()[*index];
+		} break;
+		case VARIANT_TAG_SCRIPT: {
+			bool local = false;
+			return _read_script_ref(p_reader, local);
+		} break;
+		case VARIANT_TAG_RESOURCE: {
+			const String path = p_reader.get_string();
+			const String type = p_reader.get_string();
+			if (p_reader.failed) {
+				return Variant();
+			}
+			Ref<Resource> resource = ResourceLoader::load(path, type);
+			if (resource.is_null()) {
+				p_reader.failed = true;
+			}
+			return resource;
+		} break;
+		case VARIANT_TAG_ARRAY: {
+			const uint32_t typed_builtin = p_reader.get_u32();
+			const StringName typed_class_name = p_reader.get_name();
+			bool local = false;
+			const Ref<Script> typed_script = _read_script_ref(p_reader, local);
+			const bool read_only = p_reader.get_bool();
+			const uint32_t size = p_reader.get_count();
+			if (p_reader.failed || typed_builtin >= Variant::VARIANT_MAX) {
+				p_reader.failed = true;
+				return Variant();
+			}
+
+			Array array;
+			if (typed_builtin != Variant::NIL) {
+				array.set_typed(typed_builtin, typed_class_name, typed_script);
+			}
+			array.resize(size);
+			for (uint32_t i = 0; i < size && !p_reader.failed; i++) {
+				array[i] = _read_variant(p_reader, p_depth + 1);
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			return array;
+		} break;
+		case VARIANT_TAG_DICTIONARY: {
+			const uint32_t key_builtin = p_reader.get_u32();
+			const StringName key_class_name = p_reader.get_name();
+			bool local = false;
+			const Ref<Script> key_script = _read_script_ref(p_reader, local);
+			const uint32_t value_builtin = p_reader.get_u32();
+			const StringName value_class_name = p_reader.get_name();
+			const Ref<Script> value_script = _read_script_ref(p_reader, local);
+			const bool read_only = p_reader.get_bool();
+			const uint32_t size = p_reader.get_count(2);
+			if (p_reader.failed || key_builtin >= Variant::VARIANT_MAX || value_builtin >= Variant::VARIANT_MAX) {
+				p_reader.failed = true;
+				return Variant();
+			}
+
+			Dictionary dictionary;
+			if (key_builtin != Variant::NIL || value_builtin != Variant::NIL) {
+				dictionary.set_typed(key_builtin, key_class_name, key_script, value_builtin, value_class_name, value_script);
+			}
+			for (uint32_t i = 0; i < size && !p_reader.failed; i++) {
+				const Variant key = _read_variant(p_reader, p_depth + 1);
+				dictionary[key] = _read_variant(p_reader, p_depth + 1);
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			return dictionary;
+		} break;
+	}
+
+	p_reader.failed = true;
+	return Variant();
+}
+
+#define WRITE_FUNCTION_TABLE(m_table, m_keys)                    \
+	p_writer.put_u32(p_function->m_table.size());               \
+	for (const auto &function_ptr : p_function->m_table) {      \
+		const auto *key = m_keys.find(function_ptr);            \
+		if (key == nullptr) {                                   \
+			p_writer.failed = true;                             \
+			return;                                             \
+		}                                                       \
+		_write_key(p_writer, key->value());                     \
+	}
+
+void GDScriptBytecodeCache::_write_function(Writer &p_writer, const GDScriptFunction *p_function) {
+	const FunctionTables &tables = _get_function_tables();
+
+	p_writer.put_name(p_function->name);
+	p_writer.put_bool(p_function->_static);
+	p_writer.put_u32(p_function->argument_types.size());
+	for (const GDScriptDataType &argument_type : p_function->argument_types) {
+		_write_data_type(p_writer, argument_type);
+	}
+	_write_data_type(p_writer, p_function->return_type);
+	_write_method_info(p_writer, p_function->method_info);
+	_write_variant(p_writer, p_function->rpc_config);
+
+	p_writer.put_s32(p_function->_initial_line);
+	p_writer.put_s32(p_function->_argument_count);
+	p_writer.put_s32(p_function->_vararg_index);
+	p_writer.put_s32(p_function->_stack_size);
+	p_writer.put_s32(p_function->_instruction_args_size);
+
+	p_writer.put_u32(p_function->temporary_slots.size());
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		p_writer.put_s32(E.key);
+		p_writer.put_u32(E.value);
+	}
+
+	p_writer.put_u32(p_function->stack_debug.size());
+	for (const GDScriptFunction::StackDebug &stack_debug : p_function->stack_debug) {
+		p_writer.put_s32(stack_debug.line);
+		p_writer.put_s32(stack_debug.pos);
+		p_writer.put_bool(stack_debug.added);
+		p_writer.put_name(stack_debug.identifier);
+	}
+
+	// The code only holds addresses and table indices, so it is stored as is.
+	p_writer.put_u32(p_function->code.size());
+	p_writer.put_buffer((const uint8_t *)p_function->code.ptr(), p_function->code.size() * sizeof(int));
+
+	p_writer.put_u32(p_function->default_arguments.size());
+	for (int default_argument : p_function->default_arguments) {
+		p_writer.put_s32(default_argument);
+	}
+
+	p_writer.put_u32(p_function->constants.size());
+	for (const Variant &constant : p_function->constants) {
+		_write_variant(p_writer, constant);
+	}
+
+	p_writer.put_u32(p_function->global_names.size());
+	for (const StringName &global_name : p_function->global_names) {
+		p_writer.put_name(global_name);
+	}
+
+	WRITE_FUNCTION_TABLE(operator_funcs, tables.operators);
+	WRITE_FUNCTION_TABLE(setters, tables.setters);
+	WRITE_FUNCTION_TABLE(getters, tables.getters);
+	WRITE_FUNCTION_TABLE(keyed_setters, tables.keyed_setters);
+	WRITE_FUNCTION_TABLE(keyed_getters, tables.keyed_getters);
+	WRITE_FUNCTION_TABLE(indexed_setters, tables.indexed_setters);
+	WRITE_FUNCTION_TABLE(indexed_getters, tables.indexed_getters);
+	WRITE_FUNCTION_TABLE(builtin_methods, tables.builtin_methods);
+	WRITE_FUNCTION_TABLE(constructors, tables.constructors);
+	WRITE_FUNCTION_TABLE(utilities, tables.utilities);
+	WRITE_FUNCTION_TABLE(gds_utilities, tables.gds_utilities);
+
+	p_writer.put_u32(p_function->methods.size());
+	for (const MethodBind *method : p_function->methods) {
+		p_writer.put_name(method->get_instance_class());
+		p_writer.put_name(method->get_name());
+		p_writer.put_u32(method->get_hash());
+	}
+
+	p_writer.put_u32(p_function->_inline_caches_count);
+
+	p_writer.put_u32(p_function->lambdas.size());
+	for (const GDScriptFunction *lambda : p_function->lambdas) {
+		const GDScript::LambdaInfo *info = lambda->_script->lambda_info.getptr(const_cast<GDScriptFunction *>(lambda));
+		p_writer.put_bool(info != nullptr);
+		p_writer.put_s32(info ? info->capture_count : 0);
+		p_writer.put_bool(info ? info->use_self : false);
+		_write_function(p_writer, lambda);
+	}
+
+#ifdef DEBUG_ENABLED
+	const Vector<String> *debug_names[] = {
+		&p_function->operator_names,
+		&p_function->setter_names,
+		&p_function->getter_names,
+		&p_function->builtin_methods_names,
+		&p_function->constructors_names,
+		&p_function->utilities_names,
+		&p_function->gds_utilities_names,
+	};
+	for (const Vector<String> *names : debug_names) {
+		p_writer.put_u32(names->size());
+		for (const String &name : *names) {
+			p_writer.put_string(name);
+		}
+	}
+	p_writer.put_name(p_function->profile.signature);
+#endif
+}
+
+#undef WRITE_FUNCTION_TABLE
+
+#define READ_FUNCTION_TABLE(m_table, m_resolve)                                                          \
+	{                                                                                                    \
+		const uint32_t count = p_reader.get_count();                                                     \
+		function->m_table.resize(count);                                                                 \
+		for (uint32_t i = 0; i < count && !p_reader.failed; i++) {                                       \
+			const FunctionKey key = _read_key(p_reader);                                                 \
+			function->m_table.write[i] = p_reader.failed ? nullptr : m_resolve(key);                     \
+			if (function->m_table[i] == nullptr) {                                                       \
+				p_reader.failed = true;                                                                  \
+			}                                                                                            \
+		}                                                                                                \
+		function->_##m_table##_count = function->m_table.size();                                         \
+		function->_##m_table##_ptr = function->m_table.is_empty() ? nullptr : function->m_table.ptr(); \
+	}
+
+GDScriptFunction *GDScriptBytecodeCache::_read_function(Reader &p_reader, GDScript *p_script) {
+	// Keys come from the same engine build (see `_get_engine_key()`), so a
+	// key that doesn't resolve means the file is damaged.
+	static auto is_type = [](int p_type) -> bool {
+		return p_type >= 0 && p_type < Variant::VARIANT_MAX;
+	};
+	static auto resolve_operator = [](const FunctionKey &p_key) -> Variant::ValidatedOperatorEvaluator {
+		if (p_key.a < 0 || p_key.a >= Variant::OP_MAX || !is_type(p_key.b) || !is_type(p_key.c)) {
+			return nullptr;
+		}
+		return Variant::get_validated_operator_evaluator((Variant::Operator)p_key.a, (Variant::Type)p_key.b, (Variant::Type)p_key.c);
+	};
+	static auto resolve_setter = [](const FunctionKey &p_key) -> Variant::ValidatedSetter {
+		return is_type(p_key.a) ? Variant::get_member_validated_setter((Variant::Type)p_key.a, p_key.name) : nullptr;
+	};
+	static auto resolve_getter = [](const FunctionKey &p_key) -> Variant::ValidatedGetter {
+		return is_type(p_key.a) ? Variant::get_member_validated_getter((Variant::Type)p_key.a, p_key.name) : nullptr;
+	};
+	static auto resolve_keyed_setter = [](const FunctionKey &p_key) -> Variant::ValidatedKeyedSetter {
+		return is_type(p_key.a) ? Variant::get_member_validated_keyed_setter((Variant::Type)p_key.a) : nullptr;
+	};
+	static auto resolve_keyed_getter = [](const FunctionKey &p_key) -> Variant::ValidatedKeyedGetter {
+		return is_type(p_key.a) ? Variant::get_member_validated_keyed_getter((Variant::Type)p_key.a) : nullptr;
+	};
+	static auto resolve_indexed_setter = [](const FunctionKey &p_key) -> Variant::ValidatedIndexedSetter {
+		return is_type(p_key.a) ? Variant::get_member_validated_indexed_setter((Variant::Type)p_key.a) : nullptr;
+	};
+	static auto resolve_indexed_getter = [](const FunctionKey &p_key) -> Variant::ValidatedIndexedGetter {
+		return is_type(p_key.a) ? Variant::get_member_validated_indexed_getter((Variant::Type)p_key.a) : nullptr;
+	};
+	static auto resolve_builtin_method = [](const FunctionKey &p_key) -> Variant::ValidatedBuiltInMethod {
+		return is_type(p_key.a) && Variant::has_builtin_method((Variant::Type)p_key.a, p_key.name) ? Variant::get_validated_builtin_method((Variant::Type)p_key.a, p_key.name) : nullptr;
+	};
+	static auto resolve_constructor = [](const FunctionKey &p_key) -> Variant::ValidatedConstructor {
+		if (!is_type(p_key.a) || p_key.b < 0 || p_key.b >= Variant::get_constructor_count((Variant::Type)p_key.a)) {
+			return nullptr;
+		}
+		return Variant::get_validated_constructor((Variant::Type)p_key.a, p_key.b);
+	};
+	static auto resolve_utility = [](const FunctionKey &p_key) -> Variant::ValidatedUtilityFunction {
+		return Variant::has_utility_function(p_key.name) ? Variant::get_validated_utility_function(p_key.name) : nullptr;
+	};
+	static auto resolve_gds_utility = [](const FunctionKey &p_key) -> GDScriptUtilityFunctions::FunctionPtr {
+		return GDScriptUtilityFunctions::function_exists(p_key.name) ? GDScriptUtilityFunctions::get_function(p_key.name) : nullptr;
+	};
+
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+	function->name = p_reader.get_name();
+	function->_static = p_reader.get_bool();
+
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+#endif
+
+	const uint32_t argument_type_count = p_reader.get_count();
+	for (uint32_t i = 0; i < argument_type_count && !p_reader.failed; i++) {
+		function->argument_types.push_back(_read_data_type(p_reader));
+	}
+	function->return_type = _read_data_type(p_reader);
+	function->method_info = _read_method_info(p_reader);
+	function->rpc_config = _read_variant(p_reader);
+
+	function->_initial_line = p_reader.get_s32();
+	function->_argument_count = p_reader.get_s32();
+	function->_vararg_index = p_reader.get_s32();
+	function->_stack_size = p_reader.get_s32();
+	function->_instruction_args_size = p_reader.get_s32();
+
+	const uint32_t temporary_count = p_reader.get_count(8);
+	for (uint32_t i = 0; i < temporary_count && !p_reader.failed; i++) {
+		const int slot = p_reader.get_s32();
+		function->temporary_slots[slot] = (Variant::Type)p_reader.get_u32();
+	}
+
+	const uint32_t stack_debug_count = p_reader.get_count(13);
+	for (uint32_t i = 0; i < stack_debug_count && !p_reader.failed; i++) {
+		GDScriptFunction::StackDebug stack_debug;
+		stack_debug.line = p_reader.get_s32();
+		stack_debug.pos = p_reader.get_s32();
+		stack_debug.added = p_reader.get_bool();
+		stack_debug.identifier = p_reader.get_name();
+		function->stack_debug.push_back(stack_debug);
+	}
+
+	const uint32_t code_size = p_reader.get_count(sizeof(int));
+	const uint8_t *code = p_reader.get_buffer(code_size * sizeof(int));
+	if (code && code_size) {
+		function->code.resize(code_size);
+		memcpy(function->code.ptrw(), code, code_size * sizeof(int));
+	}
+	function->_code_size = function->code.size();
+	function->_code_ptr = function->code.is_empty() ? nullptr : function->code.ptrw();
+
+	const uint32_t default_argument_count = p_reader.get_count(4);
+	for (uint32_t i = 0; i < default_argument_count && !p_reader.failed; i++) {
+		function->default_arguments.push_back(p_reader.get_s32());
+	}
+	function->_default_arg_count = function->default_arguments.is_empty() ? 0 : function->default_arguments.size() - 1;
+	function->_default_arg_ptr = function->default_arguments.is_empty() ? nullptr : function->default_arguments.ptr();
+
+	const uint32_t constant_count = p_reader.get_count();
+	for (uint32_t i = 0; i < constant_count && !p_reader.failed; i++) {
+		function->constants.push_back(_read_variant(p_reader));
+	}
+	function->_constant_count = function->constants.size();
+	function->_constants_ptr = function->constants.is_empty() ? nullptr : function->constants.ptrw();
+
+	const uint32_t global_name_count = p_reader.get_count(4);
+	for (uint32_t i = 0; i < global_name_count && !p_reader.failed; i++) {
+		function->global_names.push_back(p_reader.get_name());
+	}
+	function->_global_names_count = function->global_names.size();
+	function->_global_names_ptr = function->global_names.is_empty() ? nullptr : function->global_names.ptr();
+
+	READ_FUNCTION_TABLE(operator_funcs, resolve_operator);
+	READ_FUNCTION_TABLE(setters, resolve_setter);
+	READ_FUNCTION_TABLE(getters, resolve_getter);
+	READ_FUNCTION_TABLE(keyed_setters, resolve_keyed_setter);
+	READ_FUNCTION_TABLE(keyed_getters, resolve_keyed_getter);
+	READ_FUNCTION_TABLE(indexed_setters, resolve_indexed_setter);
+	READ_FUNCTION_TABLE(indexed_getters, resolve_indexed_getter);
+	READ_FUNCTION_TABLE(builtin_methods, resolve_builtin_method);
+	READ_FUNCTION_TABLE(constructors, resolve_constructor);
+	READ_FUNCTION_TABLE(utilities, resolve_utility);
+	READ_FUNCTION_TABLE(gds_utilities, resolve_gds_utility);
+
+	const uint32_t method_count = p_reader.get_count(12);
+	for (uint32_t i = 0; i < method_count && !p_reader.failed; i++) {
+		const StringName class_name = p_reader.get_name();
+		const StringName method_name = p_reader.get_name();
+		const uint32_t hash = p_reader.get_u32();
+		// The hash changes with the signature, so API changes in extensions
+		// are caught even when the engine itself didn't change.
+		MethodBind *method = ClassDB::get_method(class_name, method_name);
+		if (method == nullptr || method->get_hash() != hash) {
+			p_reader.failed = true;
+			break;
+		}
+		function->methods.push_back(method);
+	}
+	function->_methods_count = function->methods.size();
+	function->_methods_ptr = function->methods.is_empty() ? nullptr : function->methods.ptrw();
+
+	function->_inline_caches_count = p_reader.get_count(0);
+	if (!p_reader.failed && function->_inline_caches_count > 0) {
+		function->inline_caches = memnew_arr(GDScriptFunction::InlineCache, function->_inline_caches_count);
+	} else {
+		function->_inline_caches_count = 0;
+	}
+
+	const uint32_t lambda_count = p_reader.get_count();
+	for (uint32_t i = 0; i < lambda_count && !p_reader.failed; i++) {
+		const bool has_info = p_reader.get_bool();
+		GDScript::LambdaInfo info;
+		info.capture_count = p_reader.get_s32();
+		info.use_self = p_reader.get_bool();
+		GDScriptFunction *lambda = _read_function(p_reader, p_script);
+		if (lambda == nullptr) {
+			p_reader.failed = true;
+			break;
+		}
+		function->lambdas.push_back(lambda);
+		if (has_info) {
+			p_script->lambda_info.insert(lambda, info);
+		}
+	}
+	function->_lambdas_count = function->lambdas.size();
+	function->_lambdas_ptr = function->lambdas.is_empty() ? nullptr : function->lambdas.ptrw();
+
+#ifdef DEBUG_ENABLED
+	Vector<String> *debug_names[] = {
+		&function->operator_names,
+		&function->setter_names,
+		&function->getter_names,
+		&function->builtin_methods_names,
+		&function->constructors_names,
+		&function->utilities_names,
+		&function->gds_utilities_names,
+	};
+	for (Vector<String> *names : debug_names) {
+		const uint32_t name_count = p_reader.get_count(4);
+		for (uint32_t i = 0; i < name_count && !p_reader.failed; i++) {
+			names->push_back(p_reader.get_string());
+		}
+	}
+	function->profile.signature = p_reader.get_name();
+#endif
+
+	if (p_reader.failed || !_validate_code(function, p_script->member_indices.size())) {
+		p_reader.failed = true;
+		memdelete(function);
+		return nullptr;
+	}
+	return function;
+}
+
+#undef READ_FUNCTION_TABLE
+
+bool GDScriptBytecodeCache::_validate_code(GDScriptFunction *p_function, int p_member_count) {
+	// Release builds run the bytecode without checking it, so every operand
+	// the VM uses as an address, a table index or a jump target is checked
+	// once here instead. The layouts follow `GDScriptFunction::call()`.
+	if (p_function->_argument_count < 0 || p_function->argument_types.size() < p_function->_argument_count) {
+		return false;
+	}
+	if (p_function->_stack_size < GDScriptFunction::FIXED_ADDRESSES_MAX + p_function->_argument_count || p_function->_instruction_args_size < 0) {
+		return false;
+	}
+	if (p_function->_vararg_index >= p_function->_stack_size || (p_function->_vararg_index >= 0 && p_function->_vararg_index < GDScriptFunction::FIXED_ADDRESSES_MAX)) {
+		return false;
+	}
+	if (p_function->_default_arg_count > p_function->_argument_count) {
+		return false;
+	}
+
+	int *code = p_function->_code_ptr;
+	const int code_size = p_function->_code_size;
+	const int address_limits[GDScriptFunction::ADDR_TYPE_MAX] = { p_function->_stack_size, p_function->_constant_count, p_member_count };
+
+	LocalVector<bool> instruction_starts;
+	instruction_starts.resize_initialized(code_size);
+	LocalVector<int> jump_targets;
+	for (int default_argument : p_function->default_arguments) {
+		jump_targets.push_back(default_argument);
+	}
+
+	int ip = 0;
+	int size = 0;
+	int last_opcode = -1;
+	bool valid = true;
+
+	auto check_address = [&](int p_offset) {
+		const int address = code[ip + p_offset];
+		const uint32_t type = (uint32_t)address >> GDScriptFunction::ADDR_BITS;
+		if (type >= GDScriptFunction::ADDR_TYPE_MAX || (address & GDScriptFunction::ADDR_MASK) >= address_limits[type]) {
+			valid = false;
+		}
+	};
+	auto check_index = [&](int p_offset, int p_count) {
+		if (code[ip + p_offset] < 0 || code[ip + p_offset] >= p_count) {
+			valid = false;
+		}
+	};
+	auto check_type = [&](int p_offset) {
+		check_index(p_offset, Variant::VARIANT_MAX);
+	};
+	auto check_global_name = [&](int p_offset) {
+		check_index(p_offset, p_function->_global_names_count);
+	};
+	auto add_jump = [&](int p_offset) {
+		jump_targets.push_back(code[ip + p_offset]);
+	};
+	// Fixed size instruction, whose first operands are addresses.
+	auto fixed = [&](int p_size, int p_address_count) -> bool {
+		size = p_size;
+		if (ip + p_size > code_size) {
+			return false;
+		}
+		for (int i = 1; i <= p_address_count; i++) {
+			check_address(i);
+		}
+		return true;
+	};
+	// Instruction with an address count, the addresses, and `p_extra_count`
+	// more operands, the first of them at `r_base + 1`.
+	auto variable = [&](int p_extra_count, int &r_base) -> bool {
+		if (ip + 2 > code_size) {
+			return false;
+		}
+		const int address_count = code[ip + 1];
+		if (address_count < 0 || address_count > p_function->_instruction_args_size || address_count > code_size) {
+			return false;
+		}
+		size = 2 + address_count + p_extra_count;
+		if (ip + size > code_size) {
+			return false;
+		}
+		for (int i = 0; i < address_count; i++) {
+			check_address(2 + i);
+		}
+		r_base = 1 + address_count;
+		return true;
+	};
+	// The argument count selects the address that receives the result, it
+	// has to stay within the addresses of the instruction.
+	auto check_argc = [&](int p_offset, int p_scale, int p_used) {
+		const int64_t argc = code[ip + p_offset];
+		if (argc < 0 || argc * p_scale + p_used > code[ip + 1]) {
+			valid = false;
+		}
+	};
+
+	while (ip < code_size && valid) {
+		instruction_starts[ip] = true;
+		last_opcode = code[ip];
+		int base = 0;
+		bool fits = true;
+
+		switch (last_opcode) {
+			case GDScriptFunction::OPCODE_OPERATOR: {
+				constexpr int pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code);
+				fits = fixed(7 + pointer_size, 3);
+				if (fits) {
+					check_index(4, Variant::OP_MAX);
+					// The evaluator cached by the VM is only valid in the
+					// process that wrote the file.
+					for (int i = 5; i < size; i++) {
+						code[ip + i] = 0;
+					}
+				}
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				if ((fits = fixed(5, 3))) {
+					check_index(4, p_function->_operator_funcs_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_BUILTIN:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+			case GDScriptFunction::OPCODE_CAST_TO_BUILTIN: {
+				if ((fits = fixed(4, 2))) {
+					check_type(3);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_ARRAY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY: {
+				if ((fits = fixed(6, 3))) {
+					check_type(4);
+					check_global_name(5);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_DICTIONARY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_DICTIONARY: {
+				if ((fits = fixed(9, 4))) {
+					check_type(5);
+					check_global_name(6);
+					check_type(7);
+					check_global_name(8);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_NATIVE: {
+				if ((fits = fixed(4, 2))) {
+					check_global_name(3);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_SCRIPT:
+			case GDScriptFunction::OPCODE_SET_KEYED:
+			case GDScriptFunction::OPCODE_GET_KEYED:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_SCRIPT:
+			case GDScriptFunction::OPCODE_CAST_TO_NATIVE:
+			case GDScriptFunction::OPCODE_CAST_TO_SCRIPT: {
+				fits = fixed(4, 3);
+			} break;
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED: {
+				if ((fits = fixed(5, 3))) {
+					check_index(4, p_function->_keyed_setters_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED: {
+				if ((fits = fixed(5, 3))) {
+					check_index(4, p_function->_indexed_setters_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED: {
+				if ((fits = fixed(5, 3))) {
+					check_index(4, p_function->_keyed_getters_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED: {
+				if ((fits = fixed(5, 3))) {
+					check_index(4, p_function->_indexed_getters_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED:
+			case GDScriptFunction::OPCODE_GET_NAMED: {
+				if ((fits = fixed(5, 2))) {
+					check_global_name(3);
+					check_index(4, p_function->_inline_caches_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED: {
+				if ((fits = fixed(4, 2))) {
+					check_index(3, p_function->_setters_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED: {
+				if ((fits = fixed(4, 2))) {
+					check_index(3, p_function->_getters_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_SET_MEMBER:
+			case GDScriptFunction::OPCODE_GET_MEMBER: {
+				if ((fits = fixed(3, 1))) {
+					check_global_name(2);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_SET_STATIC_VARIABLE:
+			case GDScriptFunction::OPCODE_GET_STATIC_VARIABLE: {
+				// The variable index is checked against the class at run time.
+				fits = fixed(4, 2);
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN: {
+				fits = fixed(3, 2);
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_NULL:
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE:
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE:
+			case GDScriptFunction::OPCODE_AWAIT_RESUME:
+			case GDScriptFunction::OPCODE_RETURN: {
+				fits = fixed(2, 1);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_type(base + 2);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_index(base + 2, p_function->_constructors_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_ARRAY: {
+				if ((fits = variable(1, base))) {
+					check_argc(base + 1, 1, 1);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_ARRAY: {
+				if ((fits = variable(3, base))) {
+					check_argc(base + 1, 1, 2);
+					check_type(base + 2);
+					check_global_name(base + 3);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_DICTIONARY: {
+				if ((fits = variable(1, base))) {
+					check_argc(base + 1, 2, 1);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_DICTIONARY: {
+				if ((fits = variable(5, base))) {
+					check_argc(base + 1, 2, 3);
+					check_type(base + 2);
+					check_global_name(base + 3);
+					check_type(base + 4);
+					check_global_name(base + 5);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL:
+			case GDScriptFunction::OPCODE_CALL_RETURN:
+			case GDScriptFunction::OPCODE_CALL_ASYNC: {
+				if ((fits = variable(3, base))) {
+					check_argc(base + 1, 1, 2);
+					check_global_name(base + 2);
+					check_index(base + 3, p_function->_inline_caches_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_SELF_BASE: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_global_name(base + 2);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_index(base + 2, p_function->_utilities_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_GDSCRIPT_UTILITY: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_index(base + 2, p_function->_gds_utilities_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 2);
+					check_index(base + 2, p_function->_builtin_methods_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_RET:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 2);
+					check_index(base + 2, p_function->_methods_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_STATIC: {
+				if ((fits = variable(3, base))) {
+					check_type(base + 1);
+					check_global_name(base + 2);
+					check_argc(base + 3, 1, 1);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC: {
+				if ((fits = variable(2, base))) {
+					check_index(base + 1, p_function->_methods_count);
+					check_argc(base + 2, 1, 1);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_index(base + 2, p_function->_methods_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_AWAIT: {
+				// Always followed by its resume instruction, which the VM
+				// reads as part of this one.
+				if ((fits = fixed(2, 1)) && (ip + 2 >= code_size || code[ip + 2] != GDScriptFunction::OPCODE_AWAIT_RESUME)) {
+					valid = false;
+				}
+			} break;
+			case GDScriptFunction::OPCODE_CREATE_LAMBDA:
+			case GDScriptFunction::OPCODE_CREATE_SELF_LAMBDA: {
+				if ((fits = variable(2, base))) {
+					check_argc(base + 1, 1, 1);
+					check_index(base + 2, p_function->_lambdas_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_JUMP: {
+				if ((fits = fixed(2, 0))) {
+					add_jump(1);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF:
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_JUMP_IF_SHARED: {
+				if ((fits = fixed(3, 1))) {
+					add_jump(2);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT: {
+				// Targets are the default argument entries.
+				fits = fixed(1, 0);
+				if (p_function->default_arguments.is_empty()) {
+					valid = false;
+				}
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN: {
+				if ((fits = fixed(7, 3))) {
+					check_index(4, p_function->_operator_funcs_count);
+					check_address(5);
+					check_address(6);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN_JUMP: {
+				if ((fits = fixed(8, 3))) {
+					check_index(4, p_function->_operator_funcs_count);
+					check_address(5);
+					check_address(6);
+					add_jump(7);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF:
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				if ((fits = fixed(7, 3))) {
+					check_index(4, p_function->_operator_funcs_count);
+					check_address(5);
+					add_jump(6);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED: {
+				if ((fits = fixed(8, 2))) {
+					check_index(3, p_function->_getters_count);
+					check_address(4);
+					check_address(5);
+					check_address(6);
+					check_index(7, p_function->_operator_funcs_count);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN: {
+				if ((fits = fixed(3, 1))) {
+					check_type(2);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_ARRAY: {
+				if ((fits = fixed(5, 2))) {
+					check_type(3);
+					check_global_name(4);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_DICTIONARY: {
+				if ((fits = fixed(8, 3))) {
+					check_type(4);
+					check_global_name(5);
+					check_type(6);
+					check_global_name(7);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_RETURN_TYPED_SCRIPT: {
+				fits = fixed(3, 2);
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_RANGE: {
+				if ((fits = fixed(7, 5))) {
+					add_jump(6);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_RANGE: {
+				if ((fits = fixed(6, 4))) {
+					add_jump(5);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_STORE_GLOBAL: {
+				if ((fits = fixed(3, 1))) {
+					check_index(2, GDScriptLanguage::get_singleton()->get_global_array_size());
+				}
+			} break;
+			case GDScriptFunction::OPCODE_STORE_NAMED_GLOBAL: {
+				if ((fits = fixed(3, 1))) {
+					check_global_name(2);
+				}
+			} break;
+			case GDScriptFunction::OPCODE_ASSERT: {
+				fits = fixed(3, 2);
+			} break;
+			case GDScriptFunction::OPCODE_LINE: {
+				fits = fixed(2, 0);
+			} break;
+			case GDScriptFunction::OPCODE_BREAKPOINT:
+			case GDScriptFunction::OPCODE_END: {
+				fits = fixed(1, 0);
+			} break;
+			default: {
+				if (last_opcode >= GDScriptFunction::OPCODE_ITERATE_BEGIN && last_opcode <= GDScriptFunction::OPCODE_ITERATE_OBJECT) {
+					// Every other iteration instruction: counter, container,
+					// iterator and the exit jump.
+					if ((fits = fixed(5, 3))) {
+						add_jump(4);
+					}
+				} else if (last_opcode >= GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL && last_opcode <= GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY) {
+					fits = fixed(2, 1);
+				} else {
+					return false; // Unknown opcode.
+				}
+			} break;
+		}
+
+		if (!fits) {
+			return false;
+		}
+		ip += size;
+	}
+
+	// The VM dispatches straight to the next opcode, so the code can't run
+	// past its end.
+	if (!valid || (code_size > 0 && last_opcode != GDScriptFunction::OPCODE_END)) {
+		return false;
+	}
+	for (int target : jump_targets) {
+		if (target < 0 || target >= code_size || !instruction_starts[target]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GDScriptBytecodeCache::_write_class_tree(Writer &p_writer, const GDScript *p_script) {
+	p_writer.put_string(p_script->fully_qualified_name);
+	p_writer.put_name(p_script->local_name);
+	p_writer.put_name(p_script->global_name);
+	p_writer.put_string(p_script->simplified_icon_path);
+	p_writer.put_u32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_name(E.key);
+		_write_class_tree(p_writer, E.value.ptr());
+	}
+}
+
+bool GDScriptBytecodeCache::_read_class_tree(Reader &p_reader, GDScript *p_script) {
+	// Mirrors `GDScriptCompiler::make_scripts()` when keeping state.
+	p_script->fully_qualified_name = p_reader.get_string();
+	p_script->local_name = p_reader.get_name();
+	p_script->global_name = p_reader.get_name();
+	p_script->simplified_icon_path = p_reader.get_string();
+
+	HashMap<StringName, Ref<GDScript>> old_subclasses = p_script->subclasses;
+	p_script->subclasses.clear();
+
+	const uint32_t subclass_count = p_reader.get_count();
+	for (uint32_t i = 0; i < subclass_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		const String fqcn = p_script->fully_qualified_name + "::" + String(name);
+
+		Ref<GDScript> subclass;
+		if (old_subclasses.has(name)) {
+			subclass = old_subclasses[name];
+		} else {
+			subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(fqcn);
+		}
+		if (subclass.is_null()) {
+			subclass.instantiate();
+		}
+
+		subclass->_owner = p_script;
+		subclass->path = p_script->path;
+		p_script->subclasses.insert(name, subclass);
+
+		if (!_read_class_tree(p_reader, subclass.ptr())) {
+			return false;
+		}
+	}
+	return !p_reader.failed;
+}
+
+void GDScriptBytecodeCache::_write_class(Writer &p_writer, const GDScript *p_script) {
+	auto write_member_info = [&p_writer](const GDScript::MemberInfo &p_info) {
+		p_writer.put_s32(p_info.index);
+		p_writer.put_name(p_info.setter);
+		p_writer.put_name(p_info.getter);
+		_write_data_type(p_writer, p_info.data_type);
+		_write_property_info(p_writer, p_info.property_info);
+	};
+
+	p_writer.put_bool(p_script->tool);
+	p_writer.put_bool(p_script->_is_abstract);
+	p_writer.put_name(p_script->native.is_valid() ? p_script->native->get_name() : StringName());
+	_write_script_ref(p_writer, p_script->base.ptr());
+
+	p_writer.put_u32(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		p_writer.put_name(E.key);
+		write_member_info(E.value);
+	}
+
+	p_writer.put_u32(p_script->members.size());
+	for (const StringName &member : p_script->members) {
+		p_writer.put_name(member);
+	}
+
+	p_writer.put_u32(p_script->static_variables_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		p_writer.put_name(E.key);
+		write_member_info(E.value);
+	}
+
+	p_writer.put_u32(p_script->constants.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		p_writer.put_name(E.key);
+		_write_variant(p_writer, E.value);
+	}
+
+	p_writer.put_u32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		p_writer.put_name(E.key);
+		_write_method_info(p_writer, E.value);
+	}
+
+	_write_variant(p_writer, p_script->rpc_config);
+
+	p_writer.put_u32(p_script->member_functions.size());
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		_write_function(p_writer, E.value);
+	}
+
+	const GDScriptFunction *special_functions[] = { p_script->implicit_initializer, p_script->implicit_ready, p_script->static_initializer };
+	for (const GDScriptFunction *special_function : special_functions) {
+		p_writer.put_bool(special_function != nullptr);
+		if (special_function) {
+			_write_function(p_writer, special_function);
+		}
+	}
+
+#ifdef TOOLS_ENABLED
+	p_writer.put_u32(p_script->member_default_values.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->member_default_values) {
+		p_writer.put_name(E.key);
+		_write_variant(p_writer, E.value);
+	}
+#endif
+
+	p_writer.put_u32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_name(E.key);
+		_write_class(p_writer, E.value.ptr());
+	}
+}
+
+bool GDScriptBytecodeCache::_read_class(Reader &p_reader, GDScript *p_script) {
+	auto read_member_info = [&p_reader]() {
+		GDScript::MemberInfo info;
+		info.index = p_reader.get_s32();
+		info.setter = p_reader.get_name();
+		info.getter = p_reader.get_name();
+		info.data_type = _read_data_type(p_reader);
+		info.property_info = _read_property_info(p_reader);
+		return info;
+	};
+
+	_clear_class(p_script);
+
+	p_script->tool = p_reader.get_bool();
+	p_script->_is_abstract = p_reader.get_bool();
+
+	const StringName native_name = p_reader.get_name();
+	const int *native_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(native_name);
+	if (native_index) {
+		p_script->native = GDScriptLanguage::get_singleton()->get_global_array()[*native_index];
+	}
+	if (p_script->native.is_null()) {
+		return false;
+	}
+
+	bool local = false;
+	const Ref<Script> base = _read_script_ref(p_reader, local);
+	if (base.is_valid()) {
+		p_script->base = base;
+		if (p_script->base.is_null()) {
+			return false;
+		}
+	}
+
+	const uint32_t member_count = p_reader.get_count();
+	for (uint32_t i = 0; i < member_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		p_script->member_indices[name] = read_member_info();
+	}
+
+	const uint32_t own_member_count = p_reader.get_count();
+	for (uint32_t i = 0; i < own_member_count && !p_reader.failed; i++) {
+		p_script->members.insert(p_reader.get_name());
+	}
+
+	const uint32_t static_count = p_reader.get_count();
+	for (uint32_t i = 0; i < static_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		p_script->static_variables_indices[name] = read_member_info();
+	}
+	p_script->static_variables.resize(p_script->static_variables_indices.size());
+
+	const uint32_t constant_count = p_reader.get_count();
+	for (uint32_t i = 0; i < constant_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		p_script->constants.insert(name, _read_variant(p_reader));
+	}
+
+	const uint32_t signal_count = p_reader.get_count();
+	for (uint32_t i = 0; i < signal_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		p_script->_signals[name] = _read_method_info(p_reader);
+	}
+
+	p_script->rpc_config = _read_variant(p_reader);
+
+	if (p_reader.failed) {
+		return false;
+	}
+
+	const uint32_t function_count = p_reader.get_count();
+	for (uint32_t i = 0; i < function_count; i++) {
+		GDScriptFunction *function = _read_function(p_reader, p_script);
+		if (function == nullptr) {
+			return false;
+		}
+		p_script->member_functions[function->name] = function;
+		if (function->name == GDScriptLanguage::get_singleton()->strings._init) {
+			p_script->initializer = function;
+		}
+	}
+
+	GDScriptFunction **special_functions[] = { &p_script->implicit_initializer, &p_script->implicit_ready, &p_script->static_initializer };
+	for (GDScriptFunction **special_function : special_functions) {
+		if (p_reader.get_bool()) {
+			*special_function = _read_function(p_reader, p_script);
+			if (*special_function == nullptr) {
+				return false;
+			}
+		}
+	}
+
+#ifdef TOOLS_ENABLED
+	p_script->member_default_values.clear();
+	const uint32_t default_value_count = p_reader.get_count();
+	for (uint32_t i = 0; i < default_value_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		p_script->member_default_values[name] = _read_variant(p_reader);
+	}
+#endif
+
+	const uint32_t subclass_count = p_reader.get_count();
+	for (uint32_t i = 0; i < subclass_count && !p_reader.failed; i++) {
+		const StringName name = p_reader.get_name();
+		Ref<GDScript> *subclass = p_script->subclasses.getptr(name);
+		if (subclass == nullptr || !_read_class(p_reader, subclass->ptr())) {
+			return false;
+		}
+	}
+
+	if (p_reader.failed) {
+		return false;
+	}
+
+	p_script->_static_default_init();
+	p_script->valid = true;
+	return true;
+}
+
+void GDScriptBytecodeCache::_clear_class(GDScript *p_script) {
+	// Same cleanup as `GDScriptCompiler::_prepare_compilation()`.
+	p_script->clearing = true;
+
+	p_script->cancel_pending_functions(true);
+
+	p_script->native = Ref<GDScriptNativeClass>();
+	p_script->base = Ref<GDScript>();
+	p_script->members.clear();
+
+	// This makes possible to clear script constants and member_functions without heap-use-after-free errors.
+	HashMap<StringName, Variant> constants;
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		constants.insert(E.key, E.value);
+	}
+	p_script->constants.clear();
+	constants.clear();
+	HashMap<StringName, GDScriptFunction *> member_functions;
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		member_functions.insert(E.key, E.value);
+	}
+	p_script->member_functions.clear();
+	for (const KeyValue<StringName, GDScriptFunction *> &E : member_functions) {
+		memdelete(E.value);
+	}
+	member_functions.clear();
+
+	if (p_script->implicit_initializer) {
+		memdelete(p_script->implicit_initializer);
+	}
+	if (p_script->implicit_ready) {
+		memdelete(p_script->implicit_ready);
+	}
+	if (p_script->static_initializer) {
+		memdelete(p_script->static_initializer);
+	}
+
+	p_script->member_functions.clear();
+	p_script->member_indices.clear();
+	GDScriptFunction::invalidate_inline_caches();
+	p_script->static_variables_indices.clear();
+	p_script->static_variables.clear();
+	p_script->_signals.clear();
+	p_script->initializer = nullptr;
+	p_script->implicit_initializer = nullptr;
+	p_script->implicit_ready = nullptr;
+	p_script->static_initializer = nullptr;
+	p_script->rpc_config.clear();
+	p_script->lambda_info.clear();
+
+	p_script->clearing = false;
+}
+
+bool GDScriptBytecodeCache::_read_header(Reader &p_reader, const GDScript *p_script) {
+	if (p_reader.get_u32() != CACHE_MAGIC || p_reader.get_u32() != FORMAT_VERSION) {
+		return false;
+	}
+	if (p_reader.get_string() != _get_engine_key() || p_reader.get_u32() != _get_environment_hash()) {
+		return false;
+	}
+	if (p_reader.get_source_hash() != _get_script_source_hash(p_script)) {
+		return false;
+	}
+
+	const uint32_t dependency_count = p_reader.get_count(44);
+	for (uint32_t i = 0; i < dependency_count && !p_reader.failed; i++) {
+		const String path = p_reader.get_string();
+		const SourceHash hash = p_reader.get_source_hash();
+		if (p_reader.failed || _get_source_hash(path) != hash) {
+			return false;
+		}
+	}
+	return !p_reader.failed;
+}
+
+static void _collect_dependencies(GDScriptParser *p_parser, HashSet<String> &r_dependencies, bool &r_complete) {
+	for (const KeyValue<String, Ref<GDScriptParserRef>> &E : p_parser->get_depended_parsers()) {
+		if (r_dependencies.has(E.key)) {
+			continue;
+		}
+		const Ref<GDScriptParserRef> &parser_ref = E.value;
+		if (parser_ref.is_null() || parser_ref->get_status() == GDScriptParserRef::EMPTY) {
+			// Its own dependencies are unknown.
+			r_complete = false;
+			continue;
+		}
+		r_dependencies.insert(E.key);
+		_collect_dependencies(parser_ref->get_parser(), r_dependencies, r_complete);
+	}
+}
+
+static bool _class_has_static_data(const GDScriptParser::ClassNode *p_class) {
+	if (p_class->has_static_data) {
+		return true;
+	}
+	for (const GDScriptParser::ClassNode::Member &member : p_class->members) {
+		if (member.type == GDScriptParser::ClassNode::Member::CLASS && _class_has_static_data(member.m_class)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool GDScriptBytecodeCache::is_enabled() {
+	if (Engine::get_singleton()->is_editor_hint()) {
+		// Scripts change all the time in the editor.
+		return false;
+	}
+	return GLOBAL_GET_CACHED(bool, "gdscript/bytecode_cache/enabled");
+}
+
+String GDScriptBytecodeCache::get_cache_path(const String &p_script_path) {
+	return String("user://gdscript_cache").path_join(p_script_path.md5_text() + ".gdbc");
+}
+
+Vector<uint8_t> GDScriptBytecodeCache::serialize(GDScript *p_script, GDScriptParser *p_parser) {
+	ERR_FAIL_NULL_V(p_script, Vector<uint8_t>());
+	ERR_FAIL_NULL_V(p_parser, Vector<uint8_t>());
+	ERR_FAIL_COND_V(!p_script->is_root_script(), Vector<uint8_t>());
+
+	Writer body;
+	body.root = p_script;
+	_write_class_tree(body, p_script);
+	body.put_bool(_class_has_static_data(p_parser->get_tree()) && !p_parser->get_tree()->annotated_static_unload);
+	_write_class(body, p_script);
+	if (body.failed) {
+		return Vector<uint8_t>();
+	}
+
+	HashSet<String> dependencies;
+	bool complete = true;
+	dependencies.insert(p_script->path); // Keeps cycles out, removed below.
+	_collect_dependencies(p_parser, dependencies, complete);
+	dependencies.erase(p_script->path);
+	if (!complete) {
+		return Vector<uint8_t>();
+	}
+	for (const String &path : body.referenced_paths) {
+		dependencies.insert(path);
+	}
+
+	// Dependencies are hashed from their files, like `_read_header()` does.
+	Writer header;
+	header.put_u32(CACHE_MAGIC);
+	header.put_u32(FORMAT_VERSION);
+	header.put_string(_get_engine_key());
+	header.put_u32(_get_environment_hash());
+	header.put_source_hash(_get_script_source_hash(p_script));
+	header.put_u32(dependencies.size());
+	for (const String &path : dependencies) {
+		header.put_string(path);
+		header.put_source_hash(_get_source_hash(path));
+	}
+
+	Vector<uint8_t> data;
+	data.resize(header.data.size() + body.data.size());
+	memcpy(data.ptrw(), header.data.ptr(), header.data.size());
+	memcpy(data.ptrw() + header.data.size(), body.data.ptr(), body.data.size());
+	return data;
+}
+
+Error GDScriptBytecodeCache::_deserialize(GDScript *p_script, const uint8_t *p_data, uint64_t p_size) {
+	if (p_size > UINT32_MAX) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	Reader reader;
+	reader.data = p_data;
+	reader.size = p_size;
+	reader.root = p_script;
+	if (!_read_header(reader, p_script)) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	// From here on the script is modified. If anything fails, compiling from
+	// source afterwards starts by clearing it again.
+	if (!_read_class_tree(reader, p_script)) {
+		return ERR_FILE_CORRUPT;
+	}
+	p_script->_owner = nullptr;
+
+	const bool add_static_script = reader.get_bool();
+	if (!_read_class(reader, p_script) || reader.pos != reader.size) {
+		p_script->valid = false;
+		return ERR_FILE_CORRUPT;
+	}
+
+	if (add_static_script) {
+		GDScriptCache::add_static_script(p_script);
+	}
+	return GDScriptCache::finish_compiling(p_script->path);
+}
+
+Error GDScriptBytecodeCache::_make_scripts(GDScript *p_script, const uint8_t *p_data, uint64_t p_size) {
+	if (p_size > UINT32_MAX) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	Reader reader;
+	reader.data = p_data;
+	reader.size = p_size;
+	reader.root = p_script;
+	if (!_read_header(reader, p_script)) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	return _read_class_tree(reader, p_script) ? OK : ERR_FILE_CORRUPT;
+}
+
+Error GDScriptBytecodeCache::deserialize(GDScript *p_script, const Vector<uint8_t> &p_data) {
+	ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+	return _deserialize(p_script, p_data.ptr(), p_data.size());
+}
+
+Error GDScriptBytecodeCache::make_scripts(GDScript *p_script, const Vector<uint8_t> &p_data) {
+	ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+	return _make_scripts(p_script, p_data.ptr(), p_data.size());
+}
+
+void GDScriptBytecodeCache::save(GDScript *p_script, GDScriptParser *p_parser) {
+	if (!_is_cacheable(p_script)) {
+		return;
+	}
+
+	const Vector<uint8_t> data = serialize(p_script, p_parser);
+	if (data.is_empty()) {
+		print_verbose(vformat("GDScript: \"%s\" can't be stored in the bytecode cache.", p_script->path));
+		return;
+	}
+
+	const String cache_path = get_cache_path(p_script->path);
+	Error err = DirAccess::make_dir_recursive_absolute(cache_path.get_base_dir());
+	ERR_FAIL_COND_MSG(err != OK && err != ERR_ALREADY_EXISTS, vformat("Cannot create the GDScript bytecode cache directory \"%s\".", cache_path.get_base_dir()));
+
+	Ref<FileAccess> file = FileAccess::open(cache_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_MSG(file.is_null(), vformat("Cannot write the GDScript bytecode cache file \"%s\".", cache_path));
+	file->store_buffer(data.ptr(), data.size());
+}
+
+Error GDScriptBytecodeCache::load(GDScript *p_script) {
+	if (!_is_cacheable(p_script)) {
+		return ERR_UNAVAILABLE;
+	}
+
+	const String cache_path = get_cache_path(p_script->path);
+	if (!FileAccess::exists(cache_path)) {
+		return ERR_FILE_NOT_FOUND;
+	}
+
+	// Read straight from the mapped file when possible, the data is only
+	// needed while the classes are filled.
+	Error err = ERR_FILE_CANT_OPEN;
+	Ref<FileAccess> file = FileAccess::open(cache_path, FileAccess::READ);
+	if (file.is_valid()) {
+		const uint8_t *mapped = file->map_read_only();
+		if (mapped) {
+			err = _deserialize(p_script, mapped, file->get_length());
+		} else {
+			const Vector<uint8_t> data = file->get_buffer(file->get_length());
+			err = _deserialize(p_script, data.ptr(), data.size());
+		}
+	}
+	if (err != OK) {
+		print_verbose(vformat("GDScript: Bytecode cache for \"%s\" is out of date, compiling from source.", p_script->path));
+	}
+	return err;
+}
+
+Error GDScriptBytecodeCache::load_shallow(GDScript *p_script) {
+	if (!_is_cacheable(p_script)) {
+		return ERR_UNAVAILABLE;
+	}
+
+	const String cache_path = get_cache_path(p_script->path);
+	if (!FileAccess::exists(cache_path)) {
+		return ERR_FILE_NOT_FOUND;
+	}
+
+	Ref<FileAccess> file = FileAccess::open(cache_path, FileAccess::READ);
+	if (file.is_null()) {
+		return ERR_FILE_CANT_OPEN;
+	}
+	const uint8_t *mapped = file->map_read_only();
+	if (mapped) {
+		return _make_scripts(p_script, mapped, file->get_length());
+	}
+	const Vector<uint8_t> data = file->get_buffer(file->get_length());
+	return _make_scripts(p_script, data.ptr(), data.size());
+}
+
+void GDScriptBytecodeCache::clear() {
+	MutexLock lock(mutex);
+	if (function_tables) {
+		memdelete(function_tables);
+		function_tables = nullptr;
+	}
+	source_hashes.clear();
+}
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript_utility_functions.h"
+
+#include "core/object/object.h"
+#include "core/object/script_language.h"
+#include "core/os/mutex.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/rb_map.h"
+#include "core/variant/variant.h"
+
+class GDScript;
+class GDScriptDataType;
+class GDScriptFunction;
+class GDScriptParser;
+
+// On-disk cache of fully compiled GDScript classes.
+//
+// The cache stores what the compiler produces for a script file (the class
+// tree, members, constants, signals and every GDScriptFunction with its
+// bytecode, constant and global name tables and type information), so that
+// later runs can skip parsing, analysis and code generation for scripts that
+// did not change. Native function pointers are stored as stable keys (type,
+// operator and member names, method hashes) and resolved again on load.
+//
+// Each file records the engine build, the global class and singleton layout,
+// the hash of the script source and the hashes of every script it depends
+// on. Any mismatch makes the file stale and the script is compiled from
+// source again, which also refreshes the cache. The bytecode itself is
+// checked against the tables it indexes before it is used, so a damaged file
+// is rejected instead of being run.
+class GDScriptBytecodeCache {
+	struct FunctionKey {
+		int a = 0;
+		int b = 0;
+		int c = 0;
+		StringName name;
+
+		FunctionKey(int p_a = 0, int p_b = 0, int p_c = 0, const StringName &p_name = StringName()) :
+				a(p_a), b(p_b), c(p_c), name(p_name) {}
+	};
+
+	struct FunctionTables {
+		RBMap<Variant::ValidatedOperatorEvaluator, FunctionKey> operators;
+		RBMap<Variant::ValidatedSetter, FunctionKey> setters;
+		RBMap<Variant::ValidatedGetter, FunctionKey> getters;
+		RBMap<Variant::ValidatedKeyedSetter, FunctionKey> keyed_setters;
+		RBMap<Variant::ValidatedKeyedGetter, FunctionKey> keyed_getters;
+		RBMap<Variant::ValidatedIndexedSetter, FunctionKey> indexed_setters;
+		RBMap<Variant::ValidatedIndexedGetter, FunctionKey> indexed_getters;
+		RBMap<Variant::ValidatedBuiltInMethod, FunctionKey> builtin_methods;
+		RBMap<Variant::ValidatedConstructor, FunctionKey> constructors;
+		RBMap<Variant::ValidatedUtilityFunction, FunctionKey> utilities;
+		RBMap<GDScriptUtilityFunctions::FunctionPtr, FunctionKey> gds_utilities;
+	};
+
+	// SHA-256 and length of a script source or of its binary tokens.
+	struct SourceHash {
+		uint8_t sha256[32] = {};
+		uint64_t length = 0;
+
+		bool operator==(const SourceHash &p_other) const {
+			return length == p_other.length && memcmp(sha256, p_other.sha256, sizeof(sha256)) == 0;
+		}
+		bool operator!=(const SourceHash &p_other) const { return !(*this == p_other); }
+	};
+
+	struct Writer;
+	struct Reader;
+
+	static Mutex mutex;
+	static FunctionTables *function_tables;
+	static HashMap<String, SourceHash> source_hashes;
+
+	static const FunctionTables &_get_function_tables();
+	static String _get_engine_key();
+	static uint32_t _get_environment_hash();
+	static SourceHash _hash_source(const uint8_t *p_data, uint64_t p_length);
+	static SourceHash _get_source_hash(const String &p_path);
+	static SourceHash _get_script_source_hash(const GDScript *p_script);
+	static bool _is_cacheable(const GDScript *p_script);
+
+	static void _write_key(Writer &p_writer, const FunctionKey &p_key);
+	static FunctionKey _read_key(Reader &p_reader);
+	static void _write_property_info(Writer &p_writer, const PropertyInfo &p_info);
+	static PropertyInfo _read_property_info(Reader &p_reader);
+	static void _write_method_info(Writer &p_writer, const MethodInfo &p_info);
+	static MethodInfo _read_method_info(Reader &p_reader);
+	static void _write_script_ref(Writer &p_writer, Script *p_script);
+	static Ref<Script> _read_script_ref(Reader &p_reader, bool &r_local);
+	static void _write_data_type(Writer &p_writer, const GDScriptDataType &p_type);
+	static GDScriptDataType _read_data_type(Reader &p_reader);
+	static void _write_variant(Writer &p_writer, const Variant &p_value);
+	static Variant _read_variant(Reader &p_reader, int p_depth = 0);
+
+	static void _write_function(Writer &p_writer, const GDScriptFunction *p_function);
+	static GDScriptFunction *_read_function(Reader &p_reader, GDScript *p_script);
+	static bool _validate_code(GDScriptFunction *p_function, int p_member_count);
+	static void _write_class_tree(Writer &p_writer, const GDScript *p_script);
+	static bool _read_class_tree(Reader &p_reader, GDScript *p_script);
+	static void _write_class(Writer &p_writer, const GDScript *p_script);
+	static bool _read_class(Reader &p_reader, GDScript *p_script);
+	static void _clear_class(GDScript *p_script);
+
+	static bool _read_header(Reader &p_reader, const GDScript *p_script);
+	static Error _deserialize(GDScript *p_script, const uint8_t *p_data, uint64_t p_size);
+	static Error _make_scripts(GDScript *p_script, const uint8_t *p_data, uint64_t p_size);
+
+public:
+	static constexpr uint32_t FORMAT_VERSION = 2;
+
+	static bool is_enabled();
+	static String get_cache_path(const String &p_script_path);
+
+	// Serializes the compiled classes of `p_script`. `p_parser` must be the
+	// parser it was compiled from; it provides the script dependencies.
+	// Returns an empty buffer if the script can't be cached, for instance
+	// because one of its constants can't be stored.
+	static Vector<uint8_t> serialize(GDScript *p_script, GDScriptParser *p_parser);
+	// Fills `p_script` from a buffer made by `serialize()`, as the compiler
+	// would. Fails without touching the script if the buffer is stale.
+	static Error deserialize(GDScript *p_script, const Vector<uint8_t> &p_data);
+	// Creates the inner class scripts only, like `GDScriptCompiler::make_scripts()`.
+	static Error make_scripts(GDScript *p_script, const Vector<uint8_t> &p_data);
+
+	static void save(GDScript *p_script, GDScriptParser *p_parser);
+	static Error load(GDScript *p_script);
+	static Error load_shallow(GDScript *p_script);
+
+	static void clear();
+};
@@ -308,7 +308,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -329,7 +329,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -708,7 +708,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -1071,6 +1071,70 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+			case OPCODE_OPERATOR_VALIDATED_ASSIGN:
+			case OPCODE_OPERATOR_VALIDATED_ASSIGN_JUMP: {
+				text += "validated operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+
+				text += "; assign ";
+				text += DADDR(5);
+				text += " = ";
+				text += DADDR(6);
+
+				incr = 7;
+				if (opcode == OPCODE_OPERATOR_VALIDATED_ASSIGN_JUMP) {
+					text += "; jump ";
+					text += itos(_code_ptr[ip + 7]);
+
+					incr = 8;
+				}
+			} break;
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF:
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				text += "validated operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+
+				text += opcode == OPCODE_OPERATOR_VALIDATED_JUMP_IF ? "; jump-if " : "; jump-if-not ";
+				text += DADDR(5);
+				text += " to ";
+				text += itos(_code_ptr[ip + 6]);
+
+				incr = 7;
+			} break;
+			case OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED: {
+				text += "get_named validated ";
+				text += DADDR(2);
+				text += " = ";
+				text += DADDR(1);
+				text += "[\"";
+				text += getter_names[_code_ptr[ip + 3]];
+				text += "\"]";
+
+				text += "; validated operator ";
+				text += DADDR(6);
+				text += " = ";
+				text += DADDR(4);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 7]];
+				text += " ";
+				text += DADDR(5);
+
+				incr = 8;
+			} break;
 			case OPCODE_RETURN: {
 				text += "return ";
 				text += DADDR(1);
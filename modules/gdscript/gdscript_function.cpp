@@ -32,6 +32,9 @@
 
 #include "gdscript.h"
 
+#include "core/object/class_db.h"
+#include "scene/scene_string_names.h"
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -126,12 +129,275 @@ GDScriptFunction::~GDScriptFunction() {
 	}
 	return_type.script_type_ref = Ref<Script>();
 
+	if (inline_caches) {
+		memdelete_arr(inline_caches);
+	}
+	invalidate_inline_caches();
+
 #ifdef DEBUG_ENABLED
 	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 	GDScriptLanguage::get_singleton()->function_list.remove(&function_list);
 #endif
 }
 
+bool GDScriptFunction::InlineCache::lookup(const void *p_script, const void *p_native_class, Kind &r_kind, void *&r_target) const {
+	const uint32_t current_epoch = epoch.load(std::memory_order_acquire);
+	for (const Entry &entry : entries) {
+		const uint32_t sequence = entry.sequence.load(std::memory_order_acquire);
+		if (sequence & 1) {
+			continue; // Being written by another thread.
+		}
+		if (entry.epoch.load(std::memory_order_acquire) != current_epoch) {
+			continue;
+		}
+		if (entry.script.load(std::memory_order_relaxed) != p_script || entry.native_class.load(std::memory_order_relaxed) != p_native_class) {
+			continue;
+		}
+		const uint32_t kind = entry.kind.load(std::memory_order_relaxed);
+		void *target = entry.target.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (entry.sequence.load(std::memory_order_relaxed) != sequence) {
+			continue;
+		}
+		r_kind = Kind(kind);
+		r_target = target;
+		return true;
+	}
+	return false;
+}
+
+void GDScriptFunction::InlineCache::store(const void *p_script, const void *p_native_class, Kind p_kind, void *p_target) {
+	const uint32_t current_epoch = epoch.load(std::memory_order_acquire);
+
+	// Reuse a stale entry if there is one, otherwise replace them in turn.
+	int slot = -1;
+	for (int i = 0; i < ENTRY_COUNT; i++) {
+		if (entries[i].epoch.load(std::memory_order_relaxed) != current_epoch) {
+			slot = i;
+			break;
+		}
+	}
+	if (slot < 0) {
+		slot = next_entry.fetch_add(1, std::memory_order_relaxed) % ENTRY_COUNT;
+	}
+
+	Entry &entry = entries[slot];
+	uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+	if ((sequence & 1) || !entry.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire)) {
+		return; // Another thread is filling this entry, the next miss will try again.
+	}
+	// The epoch is cleared first and published last, so a reader seeing the current epoch also sees the other fields.
+	entry.epoch.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	entry.kind.store(p_kind, std::memory_order_relaxed);
+	entry.script.store(p_script, std::memory_order_relaxed);
+	entry.native_class.store(p_native_class, std::memory_order_relaxed);
+	entry.target.store(p_target, std::memory_order_relaxed);
+	entry.epoch.store(current_epoch, std::memory_order_release);
+	entry.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Extension classes resolve members through their own callbacks and can be
+// unregistered at runtime, so their instances never get a cache entry. This is
+// only checked when filling a cache, since class names are unique.
+static bool _is_inline_cacheable_class(const StringName &p_class) {
+	const ClassDB::APIType api = ClassDB::get_api_type(p_class);
+	return api == ClassDB::API_CORE || api == ClassDB::API_EDITOR;
+}
+
+
+bool GDScriptFunction::_get_inline_cache_receiver(Object *p_object, GDScriptInstance *&r_instance, const void *&r_script, const void *&r_native_class) {
+	ScriptInstance *script_instance = p_object->get_script_instance();
+	if (script_instance) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return false;
+		}
+		r_instance = static_cast<GDScriptInstance *>(script_instance);
+		r_script = r_instance->script.ptr();
+	} else {
+		r_instance = nullptr;
+		r_script = nullptr;
+	}
+	r_native_class = p_object->get_class_name().data_unique_pointer();
+	return true;
+}
+
+void GDScriptFunction::_call_inline_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	Object *obj = p_base->get_type() == Variant::OBJECT ? p_base->get_validated_object() : nullptr;
+	GDScriptInstance *instance = nullptr;
+	const void *script = nullptr;
+	const void *native_class = nullptr;
+	if (!obj || !_get_inline_cache_receiver(obj, instance, script, native_class)) {
+		p_base->callp(p_method, p_args, p_argcount, r_ret, r_error);
+		return;
+	}
+
+	InlineCache::Kind kind;
+	void *target = nullptr;
+	if (!p_cache.lookup(script, native_class, kind, target)) {
+		// Same resolution order as Object::callp and GDScriptInstance::callp. `free`
+		// and `_ready` have side effects beyond the call itself, so they always take
+		// the slow path. So do classes overriding `Object::callp()`, like scripts for
+		// their static functions or platform bridges for foreign objects.
+		if (p_method == CoreStringName(free_) || p_method == SceneStringName(_ready) || !_is_inline_cacheable_class(obj->get_class_name()) || ClassDB::overrides_callp(obj->get_class_name())) {
+			p_base->callp(p_method, p_args, p_argcount, r_ret, r_error);
+			return;
+		}
+		bool has_script_method = false;
+		for (GDScript *sptr = instance ? instance->script.ptr() : nullptr; sptr && !target; sptr = sptr->base.ptr()) {
+			has_script_method = has_script_method || sptr->member_functions.has(p_method);
+			if (likely(sptr->valid)) {
+				GDScriptFunction **function = sptr->member_functions.getptr(p_method);
+				if (function) {
+					kind = InlineCache::KIND_SCRIPT_FUNCTION;
+					target = *function;
+				}
+			}
+		}
+		if (!target && has_script_method) {
+			// Only in a script that failed to compile, the instance decides what to do with the call.
+			p_base->callp(p_method, p_args, p_argcount, r_ret, r_error);
+			return;
+		}
+		if (!target) {
+			kind = InlineCache::KIND_METHOD_BIND;
+			target = ClassDB::get_method(obj->get_class_name(), p_method);
+		}
+		if (!target) {
+			p_base->callp(p_method, p_args, p_argcount, r_ret, r_error);
+			return;
+		}
+		p_cache.store(script, native_class, kind, target);
+	}
+
+	// Like `Object::callp()`, the object can't be freed from within the call.
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(obj);
+#endif
+
+	r_error.error = Callable::CallError::CALL_OK;
+	if (kind == InlineCache::KIND_SCRIPT_FUNCTION) {
+		r_ret = static_cast<GDScriptFunction *>(target)->call(instance, p_args, p_argcount, r_error);
+	} else {
+		r_ret = static_cast<MethodBind *>(target)->call(obj, p_args, p_argcount, r_error);
+	}
+}
+
+Variant GDScriptFunction::_get_named_inline_cached(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, bool &r_valid) {
+	Object *obj = p_base->get_type() == Variant::OBJECT ? p_base->get_validated_object() : nullptr;
+	GDScriptInstance *instance = nullptr;
+	const void *script = nullptr;
+	const void *native_class = nullptr;
+	if (!obj || !_get_inline_cache_receiver(obj, instance, script, native_class)) {
+		return p_base->get_named(p_name, r_valid);
+	}
+
+	InlineCache::Kind kind;
+	void *target = nullptr;
+	if (!p_cache.lookup(script, native_class, kind, target)) {
+		// Only members with a fixed location are cached: plain script variables,
+		// and native properties of unscripted objects backed by a bound getter
+		// (scripts may intercept any name through `_get()`).
+		if (!_is_inline_cacheable_class(obj->get_class_name())) {
+			return p_base->get_named(p_name, r_valid);
+		}
+		if (instance) {
+			GDScript::MemberInfo *member = instance->script->member_indices.getptr(p_name);
+			if (member && member->getter == StringName()) {
+				kind = InlineCache::KIND_SCRIPT_MEMBER;
+				target = member;
+			}
+		} else {
+			const StringName &class_name = obj->get_class_name();
+			const StringName getter = ClassDB::get_property_getter(class_name, p_name);
+			if (getter != StringName() && ClassDB::get_property_index(class_name, p_name) < 0) {
+				kind = InlineCache::KIND_METHOD_BIND;
+				target = ClassDB::get_method(class_name, getter);
+			}
+		}
+		if (!target) {
+			return p_base->get_named(p_name, r_valid);
+		}
+		p_cache.store(script, native_class, kind, target);
+	}
+
+	if (kind == InlineCache::KIND_SCRIPT_MEMBER) {
+		const int index = static_cast<const GDScript::MemberInfo *>(target)->index;
+		if (unlikely(index >= instance->members.size())) {
+			return p_base->get_named(p_name, r_valid);
+		}
+		r_valid = true;
+		return instance->members[index];
+	}
+
+	Callable::CallError ce;
+	r_valid = true;
+	return static_cast<MethodBind *>(target)->call(obj, nullptr, 0, ce);
+}
+
+void GDScriptFunction::_set_named_inline_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid) {
+	Object *obj = p_base->get_type() == Variant::OBJECT ? p_base->get_validated_object() : nullptr;
+	GDScriptInstance *instance = nullptr;
+	const void *script = nullptr;
+	const void *native_class = nullptr;
+	if (!obj || !_get_inline_cache_receiver(obj, instance, script, native_class)) {
+		p_base->set_named(p_name, p_value, r_valid);
+		return;
+	}
+#ifdef TOOLS_ENABLED
+	// Object::set() flags the object as edited, let it do so the first time.
+	if (!obj->is_edited()) {
+		p_base->set_named(p_name, p_value, r_valid);
+		return;
+	}
+#endif
+
+	InlineCache::Kind kind;
+	void *target = nullptr;
+	if (!p_cache.lookup(script, native_class, kind, target)) {
+		if (!_is_inline_cacheable_class(obj->get_class_name())) {
+			p_base->set_named(p_name, p_value, r_valid);
+			return;
+		}
+		if (instance) {
+			GDScript::MemberInfo *member = instance->script->member_indices.getptr(p_name);
+			if (member && member->setter == StringName()) {
+				kind = InlineCache::KIND_SCRIPT_MEMBER;
+				target = member;
+			}
+		} else {
+			const StringName &class_name = obj->get_class_name();
+			const StringName setter = ClassDB::get_property_setter(class_name, p_name);
+			if (setter != StringName() && ClassDB::get_property_index(class_name, p_name) < 0) {
+				kind = InlineCache::KIND_METHOD_BIND;
+				target = ClassDB::get_method(class_name, setter);
+			}
+		}
+		if (!target) {
+			p_base->set_named(p_name, p_value, r_valid);
+			return;
+		}
+		p_cache.store(script, native_class, kind, target);
+	}
+
+	if (kind == InlineCache::KIND_SCRIPT_MEMBER) {
+		const GDScript::MemberInfo *member = static_cast<const GDScript::MemberInfo *>(target);
+		// Values needing a conversion go through GDScriptInstance::set().
+		if (unlikely(member->index >= instance->members.size() || !member->data_type.is_type(p_value))) {
+			p_base->set_named(p_name, p_value, r_valid);
+			return;
+		}
+		instance->members.write[member->index] = p_value;
+		r_valid = true;
+		return;
+	}
+
+	const Variant *args[1] = { &p_value };
+	Callable::CallError ce;
+	static_cast<MethodBind *>(target)->call(obj, args, 1, ce);
+	r_valid = ce.error == Callable::CallError::CALL_OK;
+}
+
 /////////////////////
 
 Variant GDScriptFunctionState::_signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
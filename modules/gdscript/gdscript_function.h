@@ -40,6 +40,8 @@
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 class GDScriptInstance;
 class GDScript;
 
@@ -327,6 +329,12 @@ public:
 		OPCODE_JUMP_IF_NOT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
+		// Superinstructions, fused from common sequences by the bytecode generator.
+		OPCODE_OPERATOR_VALIDATED_ASSIGN,
+		OPCODE_OPERATOR_VALIDATED_ASSIGN_JUMP,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED,
 		OPCODE_RETURN,
 		OPCODE_RETURN_TYPED_BUILTIN,
 		OPCODE_RETURN_TYPED_ARRAY,
@@ -443,6 +451,42 @@ public:
 		ADDR_NIL = ADDR_STACK_NIL | (ADDR_TYPE_STACK << ADDR_BITS),
 	};
 
+	// Cache attached to each dynamic call or named property access (OPCODE_CALL,
+	// OPCODE_GET_NAMED and OPCODE_SET_NAMED). It remembers how the member was
+	// resolved for the last few receiver types seen at that site, so repeated
+	// accesses on the same kind of object skip the lookups in Object, ClassDB
+	// and the script member maps. A receiver type is the pair of its GDScript
+	// (if any) and its native class name.
+	// Functions can run on several threads at once, so every entry is guarded
+	// by a sequence counter. Entries are tied to the epoch they were filled in,
+	// and the epoch changes whenever scripts are cleared or recompiled.
+	struct InlineCache {
+		enum Kind {
+			KIND_METHOD_BIND, // Native method or property accessor.
+			KIND_SCRIPT_FUNCTION, // Script function, found through the script inheritance chain.
+			KIND_SCRIPT_MEMBER, // Plain script member variable, without setter or getter.
+		};
+
+		struct Entry {
+			std::atomic<uint32_t> sequence = { 0 }; // Odd while the entry is being written.
+			std::atomic<uint32_t> epoch = { 0 };
+			std::atomic<uint32_t> kind = { 0 };
+			std::atomic<const void *> script = { nullptr };
+			std::atomic<const void *> native_class = { nullptr };
+			std::atomic<void *> target = { nullptr };
+		};
+
+		static constexpr int ENTRY_COUNT = 4;
+
+		Entry entries[ENTRY_COUNT];
+		std::atomic<uint32_t> next_entry = { 0 };
+
+		static inline std::atomic<uint32_t> epoch = { 1 };
+
+		bool lookup(const void *p_script, const void *p_native_class, Kind &r_kind, void *&r_target) const;
+		void store(const void *p_script, const void *p_native_class, Kind p_kind, void *p_target);
+	};
+
 	struct StackDebug {
 		int line;
 		int pos;
@@ -452,6 +496,7 @@ public:
 
 private:
 	friend class GDScript;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
@@ -493,6 +538,7 @@ private:
 	Vector<GDScriptUtilityFunctions::FunctionPtr> gds_utilities;
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
+	InlineCache *inline_caches = nullptr;
 
 	int _code_size = 0;
 	int _default_arg_count = 0;
@@ -511,6 +557,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _inline_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -567,6 +614,11 @@ private:
 	String _get_callable_call_error(const String &p_where, const Callable &p_callable, const Variant **p_argptrs, int p_argcount, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	static bool _get_inline_cache_receiver(Object *p_object, GDScriptInstance *&r_instance, const void *&r_script, const void *&r_native_class);
+	static void _call_inline_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+	static Variant _get_named_inline_cached(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, bool &r_valid);
+	static void _set_named_inline_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
@@ -599,6 +651,15 @@ public:
 	Variant get_constant(int p_idx) const;
 	StringName get_global_name(int p_idx) const;
 
+	// Drops every inline cache entry. Must be called whenever script functions
+	// or members may have been freed or changed meaning.
+	static void invalidate_inline_caches() {
+		// Epoch 0 marks entries that are empty or being written, skip it when wrapping around.
+		if (InlineCache::epoch.fetch_add(1, std::memory_order_acq_rel) == UINT32_MAX) {
+			InlineCache::epoch.fetch_add(1, std::memory_order_acq_rel);
+		}
+	}
+
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
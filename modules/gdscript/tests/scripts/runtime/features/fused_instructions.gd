@@ -0,0 +1,55 @@
+# Sequences which are fused into superinstructions by the bytecode generator.
+
+func with_default(a: int, b: int = 2 + 3) -> int:
+	return a * b
+
+func test():
+	# Compare and branch, increment and loop back, `continue`.
+	var i := 0
+	var total := 0
+	while i < 10:
+		i += 1
+		if i % 3 == 0:
+			continue
+		total += i
+	print(total)
+
+	# Short-circuit conditions.
+	var j := 0
+	var hits := 0
+	while j < 20:
+		if j > 5 and j < 15:
+			hits += 1
+		elif j == 0 or j >= 18:
+			hits += 10
+		j += 1
+	print(hits)
+
+	var label := "big" if total > 30 else "small"
+	print(label)
+
+	# Typed member get and operator.
+	var v := Vector2(3.0, 4.0)
+	var length_sq := v.x * v.x + v.y * v.y
+	print(length_sq)
+
+	print(with_default(4))
+	print(with_default(4, 1))
+
+	# Nested loops with `break`.
+	var pairs := 0
+	for x in 5:
+		var y := 0
+		while true:
+			if y >= x:
+				break
+			pairs += 1
+			y += 1
+	print(pairs)
+
+	var f := 0.0
+	var k := 0
+	while k < 8:
+		f += k * 0.5
+		k += 1
+	print(f)
@@ -0,0 +1,72 @@
+# Untyped calls and property accesses go through per call site inline caches.
+# Exercise sites seeing one receiver type, several, and more than a cache holds.
+
+class Base:
+	var value = 1
+	var typed: float = 0.0
+	var with_setter := 0:
+		set(v):
+			with_setter = v * 2
+
+	func describe():
+		return "Base %d" % value
+
+class Derived extends Base:
+	func describe():
+		return "Derived %d" % value
+
+class Other:
+	var value = 3
+
+	func describe():
+		return "Other %d" % value
+
+func twice(x):
+	return x * 2
+
+func describe_all(objects: Array) -> String:
+	var parts := PackedStringArray()
+	for object in objects:
+		parts.append(object.describe())
+	return " | ".join(parts)
+
+func test():
+	var base = Base.new()
+	var derived = Derived.new()
+	var other = Other.new()
+	derived.value = 2
+	for _i in 2:
+		print(describe_all([base, derived, other]))
+
+	var nodes = [Node.new(), Node2D.new(), Control.new(), Sprite2D.new(), Timer.new(), CanvasLayer.new()]
+	var count := 0
+	for _pass in 2:
+		for node in nodes:
+			node.name = "N%d" % count
+			count += 1
+	var names := PackedStringArray()
+	for node in nodes:
+		names.append(str(node.name))
+	print(" ".join(names))
+
+	var timer = Timer.new()
+	for i in 3:
+		timer.wait_time = i + 0.5
+	print(timer.wait_time)
+	nodes.append(timer)
+
+	# Values needing a conversion, and members with a setter.
+	for _i in 2:
+		base.typed = 3
+		base.with_setter = 5
+	print(base.typed)
+	print(base.with_setter)
+
+	var total = 0
+	for i in 4:
+		total += twice(i)
+	print(total)
+
+	for node in nodes:
+		node.free()
+	print(is_instance_valid(nodes[0]))
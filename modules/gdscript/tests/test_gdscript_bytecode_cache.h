@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*  test_gdscript_bytecode_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_analyzer.h"
+#include "../gdscript_bytecode_cache.h"
+#include "../gdscript_compiler.h"
+#include "../gdscript_parser.h"
+
+#include "core/io/marshalls.h"
+#include "scene/main/node.h"
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+static const char *bytecode_cache_source = R"(
+extends RefCounted
+
+signal changed(value: int)
+
+enum Mode { FIRST, SECOND = 5 }
+
+const SCALE := 2.5
+const NAMES: Array[String] = ["a", "bb", "ccc"]
+const TABLE := { "x": 1, "y": [1, 2] }
+
+static var counter := 3
+
+class Accumulator:
+	var total := 0
+
+	func add(value: int) -> int:
+		total += value
+		return total
+
+var offset := Vector2(1, 2):
+	set(value):
+		offset = value * 2.0
+
+func compute(n: int) -> float:
+	var acc := Accumulator.new()
+	var sum := 0.0
+	for i in range(n):
+		sum += acc.add(i) * SCALE
+	var points: Array[Vector2] = []
+	for entry in NAMES:
+		points.push_back(Vector2(entry.length(), len(entry)))
+	sum += points[0].x + points[-1].y
+	var packed := PackedInt32Array([4, 5, 6])
+	packed[1] = 10
+	sum += packed[1] + TABLE["y"][1] + Mode.SECOND + counter
+	var triple := func(x: int) -> int: return x * 3 + n
+	sum += triple.call(2)
+	sum += absf(-1.5) + str(n).length()
+	var node := Node.new()
+	node.name = "Cached"
+	sum += String(node.name).length()
+	node.free()
+	offset = Vector2(0.5, 0.25)
+	sum += offset.x + offset.y
+	return sum
+)";
+
+static Ref<GDScript> compile_for_bytecode_cache(const String &p_source, Vector<uint8_t> *r_data = nullptr) {
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_source_code(p_source);
+
+	GDScriptParser parser;
+	REQUIRE(parser.parse(p_source, "", false) == OK);
+	GDScriptAnalyzer analyzer(&parser);
+	REQUIRE(analyzer.analyze() == OK);
+	GDScriptCompiler compiler;
+	REQUIRE(compiler.compile(&parser, script.ptr(), false) == OK);
+
+	if (r_data) {
+		*r_data = GDScriptBytecodeCache::serialize(script.ptr(), &parser);
+	}
+	return script;
+}
+
+TEST_CASE("[Modules][GDScript] Bytecode cache restores compiled scripts") {
+	GDScriptLanguage::get_singleton()->init();
+
+	Vector<uint8_t> data;
+	Ref<GDScript> compiled = compile_for_bytecode_cache(bytecode_cache_source, &data);
+	REQUIRE_MESSAGE(!data.is_empty(), "The script should be cacheable.");
+
+	Ref<GDScript> cached;
+	cached.instantiate();
+	cached->set_source_code(bytecode_cache_source);
+	REQUIRE(GDScriptBytecodeCache::deserialize(cached.ptr(), data) == OK);
+
+	CHECK(cached->is_valid());
+	CHECK(cached->has_script_signal("changed"));
+	CHECK(cached->get_member_functions().size() == compiled->get_member_functions().size());
+	CHECK(cached->get_constants().size() == compiled->get_constants().size());
+	CHECK(cached->get_subclasses().has("Accumulator"));
+
+	Ref<RefCounted> from_source = memnew(RefCounted);
+	from_source->set_script(compiled);
+	Ref<RefCounted> from_cache = memnew(RefCounted);
+	from_cache->set_script(cached);
+
+	for (int n : { 0, 1, 4, 20 }) {
+		INFO(vformat("compute(%d)", n));
+		CHECK(from_cache->call("compute", n) == from_source->call("compute", n));
+	}
+	CHECK(from_cache->get("offset") == Variant(Vector2(1, 0.5)));
+}
+
+TEST_CASE("[Modules][GDScript] Bytecode cache rejects stale and damaged data") {
+	GDScriptLanguage::get_singleton()->init();
+
+	Vector<uint8_t> data;
+	Ref<GDScript> compiled = compile_for_bytecode_cache(bytecode_cache_source, &data);
+	REQUIRE(!data.is_empty());
+
+	SUBCASE("Changed source") {
+		Ref<GDScript> changed;
+		changed.instantiate();
+		changed->set_source_code(String(bytecode_cache_source) + "\n# Edited.\n");
+		CHECK(GDScriptBytecodeCache::deserialize(changed.ptr(), data) != OK);
+		CHECK_FALSE(changed->is_valid());
+	}
+
+	SUBCASE("Truncated data") {
+		Ref<GDScript> truncated;
+		truncated.instantiate();
+		truncated->set_source_code(bytecode_cache_source);
+		Vector<uint8_t> partial = data;
+		partial.resize(partial.size() / 2);
+		CHECK(GDScriptBytecodeCache::deserialize(truncated.ptr(), partial) != OK);
+		CHECK_FALSE(truncated->is_valid());
+	}
+
+	SUBCASE("Wrong format version") {
+		Ref<GDScript> other;
+		other.instantiate();
+		other->set_source_code(bytecode_cache_source);
+		Vector<uint8_t> wrong = data;
+		wrong.write[4] = wrong[4] + 1;
+		CHECK(GDScriptBytecodeCache::deserialize(other.ptr(), wrong) != OK);
+	}
+
+	SUBCASE("Operand out of range") {
+		// Both scripts compile to the same code except for the member
+		// address returned, so the last differing byte is the low byte of
+		// that operand.
+		const String source_a = "var a = 1\nvar b = 2\nfunc get_value():\n\treturn a\n";
+		const String source_b = "var a = 1\nvar b = 2\nfunc get_value():\n\treturn b\n";
+		Vector<uint8_t> data_a;
+		Vector<uint8_t> data_b;
+		compile_for_bytecode_cache(source_a, &data_a);
+		compile_for_bytecode_cache(source_b, &data_b);
+		REQUIRE(!data_a.is_empty());
+		REQUIRE(data_a.size() == data_b.size());
+
+		int operand = -1;
+		for (int i = 0; i < data_a.size(); i++) {
+			if (data_a[i] != data_b[i]) {
+				operand = i;
+			}
+		}
+		REQUIRE(operand >= 0);
+		REQUIRE(operand + 4 <= data_a.size());
+		REQUIRE(decode_uint32(&data_a[operand]) == (GDScriptFunction::ADDR_TYPE_MEMBER << GDScriptFunction::ADDR_BITS));
+
+		Ref<GDScript> valid;
+		valid.instantiate();
+		valid->set_source_code(source_a);
+		CHECK(GDScriptBytecodeCache::deserialize(valid.ptr(), data_a) == OK);
+
+		Ref<GDScript> damaged;
+		damaged.instantiate();
+		damaged->set_source_code(source_a);
+		Vector<uint8_t> corrupt = data_a;
+		encode_uint32((GDScriptFunction::ADDR_TYPE_MEMBER << GDScriptFunction::ADDR_BITS) | 100, &corrupt.write[operand]);
+		CHECK(GDScriptBytecodeCache::deserialize(damaged.ptr(), corrupt) == ERR_FILE_CORRUPT);
+		CHECK_FALSE(damaged->is_valid());
+
+		encode_uint32(GDScriptFunction::ADDR_TYPE_MAX << GDScriptFunction::ADDR_BITS, &corrupt.write[operand]);
+		CHECK(GDScriptBytecodeCache::deserialize(damaged.ptr(), corrupt) == ERR_FILE_CORRUPT);
+	}
+}
+
+} // namespace GDScriptTests
@@ -0,0 +1,401 @@
+/**************************************************************************/
+/*  test_gdscript_vm_benchmark.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_byte_codegen.h"
+
+#include "core/os/os.h"
+#include "core/string/print_string.h"
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+// Micro-kernels exercising the instruction sequences fused into superinstructions
+// (compare and branch, increment and loop back, typed member get and operator).
+static const char *vm_benchmark_source = R"(
+extends RefCounted
+
+func count_loop(n: int) -> int:
+	var i := 0
+	var total := 0
+	while i < n:
+		total += i
+		i += 1
+	return total
+
+func float_accumulate(n: int) -> float:
+	var x := 0.0
+	var i := 0
+	while i < n:
+		x += i * 0.5
+		if x > 1000.0:
+			x -= 1000.0
+		i += 1
+	return x
+
+func vector_members(n: int) -> float:
+	var v := Vector2(1.5, 2.5)
+	var acc := 0.0
+	for i in n:
+		acc += v.x * 2.0 + v.y * 0.5
+		v.x = acc * 0.001
+	return acc
+
+func branches(n: int) -> int:
+	var count := 0
+	for i in n:
+		if i > 10 and i < n - 10:
+			count += 1
+		elif i == 3 or i >= n - 2:
+			count -= 1
+		count = count + 2 if i < 100 else count
+	return count
+
+func fibonacci(n: int) -> int:
+	var a := 0
+	var b := 1
+	var i := 0
+	while i < n:
+		var next := (a + b) % 1000000007
+		a = b
+		b = next
+		i += 1
+	return a
+)";
+
+static Ref<RefCounted> create_vm_benchmark_instance(bool p_superinstructions) {
+	bool was_enabled = GDScriptByteCodeGenerator::is_superinstructions_enabled();
+	GDScriptByteCodeGenerator::set_superinstructions_enabled(p_superinstructions);
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(vm_benchmark_source);
+	// A spurious `Condition "err" is true` message is printed (despite parsing being successful and returning `OK`).
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+
+	GDScriptByteCodeGenerator::set_superinstructions_enabled(was_enabled);
+	REQUIRE_MESSAGE(error == OK, "The benchmark script should compile.");
+
+	Ref<RefCounted> instance = memnew(RefCounted);
+	instance->set_script(gdscript);
+	return instance;
+}
+
+TEST_CASE("[Modules][GDScript] Superinstructions give the same results as the instructions they fuse") {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<RefCounted> plain = create_vm_benchmark_instance(false);
+	Ref<RefCounted> fused = create_vm_benchmark_instance(true);
+
+	const char *kernels[] = { "count_loop", "float_accumulate", "vector_members", "branches", "fibonacci" };
+	for (const char *kernel : kernels) {
+		for (int n : { 0, 1, 7, 250 }) {
+			INFO(vformat("Kernel: %s(%d)", kernel, n));
+			CHECK(plain->call(kernel, n) == fused->call(kernel, n));
+		}
+	}
+
+	CHECK(int64_t(fused->call("count_loop", 100)) == 4950);
+	CHECK(int64_t(fused->call("fibonacci", 20)) == 6765);
+}
+
+#ifdef DEBUG_ENABLED
+static void disassembly_print_handler(void *p_userdata, const String &p_string, bool p_error, bool p_rich) {
+	*static_cast<String *>(p_userdata) += p_string + "\n";
+}
+
+static String disassemble_vm_benchmark_function(const Ref<RefCounted> &p_instance, const StringName &p_function) {
+	Ref<GDScript> gdscript = p_instance->get_script();
+	GDScriptFunction *const *function = gdscript->get_member_functions().getptr(p_function);
+	REQUIRE(function != nullptr);
+
+	String disassembly;
+	PrintHandlerList print_handler;
+	print_handler.printfunc = disassembly_print_handler;
+	print_handler.userdata = &disassembly;
+
+	const bool print_line_enabled = CoreGlobals::print_line_enabled;
+	CoreGlobals::print_line_enabled = true;
+	add_print_handler(&print_handler);
+	(*function)->disassemble(gdscript->get_source_code().split("\n"));
+	remove_print_handler(&print_handler);
+	CoreGlobals::print_line_enabled = print_line_enabled;
+
+	return disassembly;
+}
+
+TEST_CASE("[Modules][GDScript] Superinstructions are emitted for loops and member operators") {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<RefCounted> plain = create_vm_benchmark_instance(false);
+	Ref<RefCounted> fused = create_vm_benchmark_instance(true);
+
+	// `while i < n:` compares and branches, `i += 1` at the end of the body loops back.
+	const String count_loop = disassemble_vm_benchmark_function(fused, "count_loop");
+	CHECK(count_loop.contains("; jump-if-not "));
+	CHECK(count_loop.contains("; assign "));
+	CHECK(count_loop.contains("; jump "));
+
+	// `v.x * 2.0` gets the member and multiplies it in one instruction.
+	const String vector_members = disassemble_vm_benchmark_function(fused, "vector_members");
+	CHECK(vector_members.contains("; validated operator "));
+
+	const String plain_count_loop = disassemble_vm_benchmark_function(plain, "count_loop");
+	CHECK_FALSE(plain_count_loop.contains("; jump-if-not "));
+	CHECK_FALSE(plain_count_loop.contains("; assign "));
+	CHECK_FALSE(plain_count_loop.contains("; jump "));
+	CHECK_FALSE(disassemble_vm_benchmark_function(plain, "vector_members").contains("; validated operator "));
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Modules][GDScript][Benchmark] Micro-kernels with and without superinstructions" * doctest::skip()) {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<RefCounted> plain = create_vm_benchmark_instance(false);
+	Ref<RefCounted> fused = create_vm_benchmark_instance(true);
+
+	const int iterations = 200000;
+	const char *kernels[] = { "count_loop", "float_accumulate", "vector_members", "branches", "fibonacci" };
+	for (const char *kernel : kernels) {
+		uint64_t plain_begin = OS::get_singleton()->get_ticks_usec();
+		Variant plain_result = plain->call(kernel, iterations);
+		uint64_t plain_usec = OS::get_singleton()->get_ticks_usec() - plain_begin;
+
+		uint64_t fused_begin = OS::get_singleton()->get_ticks_usec();
+		Variant fused_result = fused->call(kernel, iterations);
+		uint64_t fused_usec = OS::get_singleton()->get_ticks_usec() - fused_begin;
+
+		CHECK(plain_result == fused_result);
+		MESSAGE(vformat("%s(%d): %d usec without superinstructions, %d usec with them.", kernel, iterations, plain_usec, fused_usec));
+	}
+}
+
+// Untyped and typed variants of the same member accesses and calls. The untyped
+// ones go through the call site inline caches instead of validated instructions.
+static const char *inline_cache_benchmark_source = R"(
+extends RefCounted
+
+class Point:
+	var x := 0.0
+	var y := 0.0
+
+	func length_squared() -> float:
+		return x * x + y * y
+
+func untyped_script(n):
+	var p = Point.new()
+	var acc = 0.0
+	for i in n:
+		p.x = i * 0.5
+		p.y = p.x + 1.0
+		acc += p.length_squared()
+	return acc
+
+func typed_script(n: int) -> float:
+	var p := Point.new()
+	var acc := 0.0
+	for i in n:
+		p.x = i * 0.5
+		p.y = p.x + 1.0
+		acc += p.length_squared()
+	return acc
+
+func untyped_native(n):
+	var r = Resource.new()
+	var acc = 0
+	for i in n:
+		r.resource_name = "abc" if i % 2 else "de"
+		acc += r.resource_name.length() + r.get_reference_count()
+	return acc
+
+func typed_native(n: int) -> int:
+	var r := Resource.new()
+	var acc := 0
+	for i in n:
+		r.resource_name = "abc" if i % 2 else "de"
+		acc += r.resource_name.length() + r.get_reference_count()
+	return acc
+)";
+
+static Ref<GDScript> create_test_script(const String &p_source) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_source);
+	// A spurious `Condition "err" is true` message is printed (despite parsing being successful and returning `OK`).
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The test script should compile.");
+	return gdscript;
+}
+
+static Ref<RefCounted> create_test_script_instance(const Ref<GDScript> &p_script) {
+	Ref<RefCounted> instance = memnew(RefCounted);
+	instance->set_script(p_script);
+	return instance;
+}
+
+TEST_CASE("[Modules][GDScript] Inline caches follow the receiver type and script reloads") {
+	GDScriptLanguage::get_singleton()->init();
+
+	Ref<RefCounted> caller = create_test_script_instance(create_test_script(R"(
+extends RefCounted
+
+func call_dynamic(o):
+	return o.get_value()
+
+func get_dynamic(o):
+	return o.value
+
+func set_dynamic(o, v):
+	o.value = v
+
+func get_name_dynamic(o):
+	return o.resource_name
+
+func set_name_dynamic(o, v):
+	o.resource_name = v
+)"));
+
+	// More receiver types than a call site keeps entries for, visited repeatedly.
+	LocalVector<Ref<RefCounted>> receivers;
+	for (int i = 0; i < GDScriptFunction::InlineCache::ENTRY_COUNT + 2; i++) {
+		receivers.push_back(create_test_script_instance(create_test_script(vformat(R"(
+extends RefCounted
+
+var value = %d
+
+func get_value():
+	return value * 10
+)",
+				i))));
+	}
+	for (int pass = 0; pass < 3; pass++) {
+		for (uint32_t i = 0; i < receivers.size(); i++) {
+			CHECK(int(caller->call("get_dynamic", receivers[i])) == int(i) + pass);
+			CHECK(int(caller->call("call_dynamic", receivers[i])) == (int(i) + pass) * 10);
+			caller->call("set_dynamic", receivers[i], int(i) + pass + 1);
+		}
+	}
+
+	// Native receivers, resolved through ClassDB.
+	Ref<Resource> resource = memnew(Resource);
+	for (int i = 0; i < 3; i++) {
+		caller->call("set_name_dynamic", resource, vformat("res_%d", i));
+		CHECK(resource->get_name() == vformat("res_%d", i));
+		resource->set_name(vformat("native_%d", i));
+		CHECK(String(caller->call("get_name_dynamic", resource)) == vformat("native_%d", i));
+	}
+
+	// Recompiling a script must drop the entries pointing to its old functions.
+	Ref<GDScript> callee = create_test_script(R"(
+extends RefCounted
+
+func get_value():
+	return 1
+)");
+	Ref<RefCounted> callee_instance = create_test_script_instance(callee);
+	CHECK(int(caller->call("call_dynamic", callee_instance)) == 1);
+	CHECK(int(caller->call("call_dynamic", callee_instance)) == 1);
+	callee_instance.unref();
+
+	callee->set_source_code(R"(
+extends RefCounted
+
+func get_value():
+	return 2
+)");
+	ERR_PRINT_OFF;
+	const Error error = callee->reload();
+	ERR_PRINT_ON;
+	REQUIRE(error == OK);
+	callee_instance = create_test_script_instance(callee);
+	CHECK(int(caller->call("call_dynamic", callee_instance)) == 2);
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Modules][GDScript] Inline cached calls lock the receiver like Object::callp") {
+	GDScriptLanguage::get_singleton()->init();
+
+	Ref<RefCounted> caller = create_test_script_instance(create_test_script(R"(
+extends RefCounted
+
+func call_free_self(o):
+	o.free_self()
+)"));
+	Ref<GDScript> callee = create_test_script(R"(
+extends Object
+
+func free_self():
+	free()
+)");
+
+	// The second call goes through the cache entry filled by the first one.
+	for (int i = 0; i < 2; i++) {
+		Object *object = memnew(Object);
+		object->set_script(callee);
+		const ObjectID object_id = object->get_instance_id();
+		ERR_PRINT_OFF;
+		caller->call("call_free_self", object);
+		ERR_PRINT_ON;
+		REQUIRE_MESSAGE(ObjectDB::get_instance(object_id) == object, "An object must not be freed while one of its methods runs.");
+		memdelete(object);
+	}
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Modules][GDScript] Classes overriding callp bypass inline caches") {
+	// Calls on these must go through their own `callp()`, so it's found from the class itself.
+	CHECK(ClassDB::overrides_callp(GDScript::get_class_static()));
+	CHECK(ClassDB::overrides_callp(GDScriptNativeClass::get_class_static()));
+	CHECK_FALSE(ClassDB::overrides_callp(Script::get_class_static()));
+	CHECK_FALSE(ClassDB::overrides_callp(RefCounted::get_class_static()));
+}
+
+TEST_CASE("[Modules][GDScript][Benchmark] Untyped accesses through inline caches against typed ones" * doctest::skip()) {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<RefCounted> instance = create_test_script_instance(create_test_script(inline_cache_benchmark_source));
+
+	const int iterations = 200000;
+	const char *kernels[][2] = { { "untyped_script", "typed_script" }, { "untyped_native", "typed_native" } };
+	for (const auto &kernel : kernels) {
+		uint64_t untyped_begin = OS::get_singleton()->get_ticks_usec();
+		Variant untyped_result = instance->call(kernel[0], iterations);
+		uint64_t untyped_usec = OS::get_singleton()->get_ticks_usec() - untyped_begin;
+
+		uint64_t typed_begin = OS::get_singleton()->get_ticks_usec();
+		Variant typed_result = instance->call(kernel[1], iterations);
+		uint64_t typed_usec = OS::get_singleton()->get_ticks_usec() - typed_begin;
+
+		CHECK(untyped_result == typed_result);
+		MESSAGE(vformat("%s(%d): %d usec untyped, %d usec typed.", kernel[1], iterations, untyped_usec, typed_usec));
+	}
+}
+
+} // namespace GDScriptTests
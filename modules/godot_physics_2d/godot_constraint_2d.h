@@ -33,6 +33,50 @@
 #include "godot_body_2d.h"
 
 class GodotConstraint2D {
+public:
+	// Ordering key used by the deterministic step. It only depends on RIDs and
+	// shape indices, so it doesn't change with pointer values or with the order
+	// in which pairs were created.
+	struct SortKey {
+		uint64_t object_a = 0;
+		uint64_t object_b = 0;
+		int shape_a = 0;
+		int shape_b = 0;
+
+		_FORCE_INLINE_ bool operator<(const SortKey &p_other) const {
+			if (object_a != p_other.object_a) {
+				return object_a < p_other.object_a;
+			}
+			if (object_b != p_other.object_b) {
+				return object_b < p_other.object_b;
+			}
+			if (shape_a != p_other.shape_a) {
+				return shape_a < p_other.shape_a;
+			}
+			return shape_b < p_other.shape_b;
+		}
+
+		static _FORCE_INLINE_ SortKey make(uint64_t p_object_a, int p_shape_a, uint64_t p_object_b, int p_shape_b) {
+			SortKey key;
+			if (p_object_b < p_object_a) {
+				SWAP(p_object_a, p_object_b);
+				SWAP(p_shape_a, p_shape_b);
+			}
+			key.object_a = p_object_a;
+			key.object_b = p_object_b;
+			key.shape_a = p_shape_a;
+			key.shape_b = p_shape_b;
+			return key;
+		}
+	};
+
+	struct SortKeyComparator {
+		_FORCE_INLINE_ bool operator()(const GodotConstraint2D *p_a, const GodotConstraint2D *p_b) const {
+			return p_a->get_sort_key() < p_b->get_sort_key();
+		}
+	};
+
+private:
 	GodotBody2D **_body_ptr;
 	int _body_count;
 	uint64_t island_step = 0;
@@ -59,6 +103,13 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	// Joints are identified by their own RID, pairs override this with the RIDs of the objects they connect.
+	virtual SortKey get_sort_key() const {
+		SortKey key;
+		key.object_a = self.get_id();
+		return key;
+	}
+
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
@@ -276,6 +276,25 @@ int GodotPhysicsServer2D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+void GodotPhysicsServer2D::space_set_deterministic(RID p_space, bool p_enabled) {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	space->set_deterministic(p_enabled);
+}
+
+bool GodotPhysicsServer2D::space_is_deterministic(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	return space->is_deterministic();
+}
+
+uint64_t GodotPhysicsServer2D::space_get_state_hash(RID p_space) const {
+	const GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, 0);
+	ERR_FAIL_COND_V_MSG(!space->is_deterministic(), 0, "The state hash is only computed for spaces in deterministic mode.");
+	return space->get_state_hash();
+}
+
 PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_space) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
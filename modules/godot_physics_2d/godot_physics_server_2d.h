@@ -115,6 +115,11 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	// Deterministic stepping, see the `physics/2d/solver/deterministic` project setting.
+	virtual void space_set_deterministic(RID p_space, bool p_enabled) override;
+	virtual bool space_is_deterministic(RID p_space) const override;
+	virtual uint64_t space_get_state_hash(RID p_space) const override;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState2D *space_get_direct_state(RID p_space) override;
 
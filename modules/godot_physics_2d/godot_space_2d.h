@@ -99,6 +99,9 @@ private:
 	real_t contact_bias = 0.0;
 	real_t constraint_bias = 0.0;
 
+	bool deterministic = false;
+	uint64_t state_hash = 0;
+
 	enum {
 		INTERSECTION_QUERY_MAX = 2048
 	};
@@ -163,6 +166,14 @@ public:
 	_FORCE_INLINE_ real_t get_body_angular_velocity_sleep_threshold() const { return body_angular_velocity_sleep_threshold; }
 	_FORCE_INLINE_ real_t get_body_time_to_sleep() const { return body_time_to_sleep; }
 
+	// In deterministic mode, bodies and constraints are processed in an order that only depends on
+	// the simulation state, and a hash of that state is computed after every step.
+	void set_deterministic(bool p_enabled) { deterministic = p_enabled; }
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
+
+	void set_state_hash(uint64_t p_hash) { state_hash = p_hash; }
+	uint64_t get_state_hash() const { return state_hash; }
+
 	void update();
 	void setup();
 	void call_queries();
@@ -126,6 +126,42 @@ void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) cons
 	}
 }
 
+static _FORCE_INLINE_ uint64_t _hash_real(real_t p_value, uint64_t p_hash) {
+	// Hash the exact bit pattern, lockstep peers need bit-identical results.
+	uint64_t bits = 0;
+	memcpy(&bits, &p_value, sizeof(real_t));
+	return hash64_murmur3_64(bits, p_hash);
+}
+
+void GodotStep2D::_update_state_hash(GodotSpace2D *p_space) {
+	for (GodotCollisionObject2D *object : p_space->get_objects()) {
+		if (object->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			ordered_bodies.push_back(static_cast<GodotBody2D *>(object));
+		}
+	}
+	ordered_bodies.sort_custom<BodyRIDComparator>();
+
+	// RIDs themselves aren't hashed, they differ between processes, only their relative order is stable.
+	uint64_t hash = HASH_MURMUR3_SEED;
+	for (const GodotBody2D *body : ordered_bodies) {
+		hash = hash64_murmur3_64(body->is_active(), hash);
+
+		const Transform2D &transform = body->get_transform();
+		for (int i = 0; i < 3; i++) {
+			hash = _hash_real(transform.columns[i].x, hash);
+			hash = _hash_real(transform.columns[i].y, hash);
+		}
+
+		const Vector2 linear_velocity = body->get_linear_velocity();
+		hash = _hash_real(linear_velocity.x, hash);
+		hash = _hash_real(linear_velocity.y, hash);
+		hash = _hash_real(body->get_angular_velocity(), hash);
+	}
+	ordered_bodies.clear();
+
+	p_space->set_state_hash(hash);
+}
+
 void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -135,6 +171,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	iterations = p_space->get_solver_iterations();
 	delta = p_delta;
+	deterministic = p_space->is_deterministic();
 
 	const SelfList<GodotBody2D>::List *body_list = &p_space->get_active_body_list();
 
@@ -176,30 +213,43 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 				continue;
 			}
 			constraint->set_island_step(_step);
+			area_constraints.push_back(constraint);
+		}
+		p_space->area_remove_from_moved_list((SelfList<GodotArea2D> *)aml.first()); //faster to remove here
+	}
 
-			// Each constraint can be on a separate island for areas as there's no solving phase.
-			++island_count;
-			if (constraint_islands.size() < island_count) {
-				constraint_islands.resize(island_count);
-			}
-			LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[island_count - 1];
-			constraint_island.clear();
+	if (deterministic) {
+		// Area constraints are kept in pair creation order, sort them so that area callbacks are queued in a stable order.
+		area_constraints.sort_custom<GodotConstraint2D::SortKeyComparator>();
+	}
 
-			all_constraints.push_back(constraint);
-			constraint_island.push_back(constraint);
+	for (GodotConstraint2D *constraint : area_constraints) {
+		// Each constraint can be on a separate island for areas as there's no solving phase.
+		++island_count;
+		if (constraint_islands.size() < island_count) {
+			constraint_islands.resize(island_count);
 		}
-		p_space->area_remove_from_moved_list((SelfList<GodotArea2D> *)aml.first()); //faster to remove here
+		LocalVector<GodotConstraint2D *> &constraint_island = constraint_islands[island_count - 1];
+		constraint_island.clear();
+
+		all_constraints.push_back(constraint);
+		constraint_island.push_back(constraint);
 	}
+	area_constraints.clear();
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	for (b = body_list->first(); b; b = b->next()) {
+		ordered_bodies.push_back(b->self());
+	}
+	if (deterministic) {
+		// The active list order depends on when bodies were woken up, use RIDs instead.
+		ordered_bodies.sort_custom<BodyRIDComparator>();
+	}
 
 	uint32_t body_island_count = 0;
 
-	while (b) {
-		GodotBody2D *body = b->self();
-
+	for (GodotBody2D *body : ordered_bodies) {
 		if (body->get_island_step() != _step) {
 			++body_island_count;
 			if (body_islands.size() < body_island_count) {
@@ -219,6 +269,11 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 			_populate_island(body, body_island, constraint_island);
 
+			if (deterministic) {
+				// Constraints are collected by walking per-body lists, which are in pair creation order.
+				constraint_island.sort_custom<GodotConstraint2D::SortKeyComparator>();
+			}
+
 			if (body_island.is_empty()) {
 				--body_island_count;
 			}
@@ -227,8 +282,8 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 				--island_count;
 			}
 		}
-		b = b->next();
 	}
+	ordered_bodies.clear();
 
 	p_space->set_island_count((int)island_count);
 
@@ -293,6 +348,10 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	all_constraints.clear();
 
+	if (deterministic) {
+		_update_state_hash(p_space);
+	}
+
 	p_space->unlock();
 	_step++;
 }
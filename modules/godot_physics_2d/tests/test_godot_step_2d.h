@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*  test_godot_step_2d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotStep2D {
+
+struct BoxPileResult {
+	LocalVector<uint64_t> state_hashes;
+	LocalVector<Transform2D> transforms;
+};
+
+// Drops a jittered grid of boxes on a floor. Bodies are always created in the
+// same order, but can be added to the space in reverse, which changes the
+// order of the active list and of the pairs reported by the broadphase.
+static BoxPileResult simulate_box_pile(int p_box_count, int p_steps, bool p_deterministic, bool p_reverse_insertion) {
+	GodotPhysicsServer2D *server = memnew(GodotPhysicsServer2D);
+	server->init();
+	server->set_active(true);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+	server->space_set_deterministic(space, p_deterministic);
+	server->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY, 980.0);
+	server->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY_VECTOR, Vector2(0, 1));
+
+	RID floor_shape = server->rectangle_shape_create();
+	server->shape_set_data(floor_shape, Vector2(2000, 10));
+	RID floor = server->body_create();
+	server->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	server->body_add_shape(floor, floor_shape);
+	server->body_set_state(floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0, 10)));
+	server->body_set_space(floor, space);
+
+	RID box_shape = server->rectangle_shape_create();
+	server->shape_set_data(box_shape, Vector2(8, 8));
+
+	const int side = MAX(1, int(Math::ceil(Math::sqrt(double(p_box_count)))));
+	LocalVector<RID> boxes;
+	for (int i = 0; i < p_box_count; i++) {
+		const int row = i / side;
+		const int column = i % side;
+		const real_t jitter = real_t((i * 7919) % 13) * 0.05;
+
+		RID box = server->body_create();
+		server->body_set_mode(box, PhysicsServer2D::BODY_MODE_RIGID);
+		server->body_add_shape(box, box_shape);
+		server->body_set_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(jitter, Vector2(column * 18.0 + jitter * 4.0, -10.0 - row * 20.0)));
+		boxes.push_back(box);
+	}
+	for (uint32_t i = 0; i < boxes.size(); i++) {
+		server->body_set_space(boxes[p_reverse_insertion ? boxes.size() - 1 - i : i], space);
+	}
+
+	BoxPileResult result;
+	for (int i = 0; i < p_steps; i++) {
+		server->step(1.0 / 60.0);
+		if (p_deterministic) {
+			result.state_hashes.push_back(server->space_get_state_hash(space));
+		}
+	}
+
+	for (const RID &box : boxes) {
+		result.transforms.push_back(server->body_get_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM));
+		server->free_rid(box);
+	}
+	server->free_rid(box_shape);
+	server->free_rid(floor);
+	server->free_rid(floor_shape);
+	server->free_rid(space);
+
+	server->finish();
+	memdelete(server);
+
+	return result;
+}
+
+TEST_CASE("[Physics2D][GodotStep2D] Deterministic mode doesn't depend on insertion order") {
+	const BoxPileResult forward = simulate_box_pile(200, 120, true, false);
+	const BoxPileResult reversed = simulate_box_pile(200, 120, true, true);
+
+	REQUIRE(forward.state_hashes.size() == reversed.state_hashes.size());
+	int first_mismatch = -1;
+	for (uint32_t i = 0; i < forward.state_hashes.size(); i++) {
+		if (forward.state_hashes[i] != reversed.state_hashes[i]) {
+			first_mismatch = i;
+			break;
+		}
+	}
+	CHECK_MESSAGE(first_mismatch == -1, vformat("State hashes should match on every step, first mismatch at step %d.", first_mismatch));
+
+	REQUIRE(forward.transforms.size() == reversed.transforms.size());
+	bool identical = true;
+	for (uint32_t i = 0; i < forward.transforms.size(); i++) {
+		identical = identical && forward.transforms[i] == reversed.transforms[i];
+	}
+	CHECK(identical);
+}
+
+TEST_CASE("[Physics2D][GodotStep2D] State hash follows the simulation") {
+	const BoxPileResult result = simulate_box_pile(50, 30, true, false);
+
+	REQUIRE(result.state_hashes.size() == 30);
+	// Boxes are falling during the first steps, so every step must produce a new state.
+	CHECK(result.state_hashes[0] != result.state_hashes[1]);
+	CHECK(result.state_hashes[1] != result.state_hashes[2]);
+
+	GodotPhysicsServer2D *server = memnew(GodotPhysicsServer2D);
+	server->init();
+	RID space = server->space_create();
+	CHECK_FALSE(server->space_is_deterministic(space));
+	server->space_set_deterministic(space, true);
+	CHECK(server->space_is_deterministic(space));
+	server->free_rid(space);
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestGodotStep2D
@@ -475,11 +475,17 @@ bool GodotBody3D::is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const {
 }
 
 void GodotBody3D::integrate_forces(real_t p_step) {
+	if (integrate_forces_local(p_step)) {
+		integrate_forces_commit();
+	}
+}
+
+bool GodotBody3D::integrate_forces_local(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
-		return;
+		return false;
 	}
 
-	ERR_FAIL_NULL(get_space());
+	ERR_FAIL_NULL_V(get_space(), false);
 
 	int ac = areas.size();
 
@@ -567,7 +573,7 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	// Add default gravity and damping from space area.
 	if (!stopped) {
 		GodotArea3D *default_area = get_space()->get_default_area();
-		ERR_FAIL_NULL(default_area);
+		ERR_FAIL_NULL_V(default_area, false);
 
 		if (!gravity_done) {
 			Vector3 default_gravity;
@@ -665,23 +671,31 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		_update_shape_aabbs_with_motion(motion);
 	}
 
 	contact_count = 0;
+
+	return do_motion;
+}
+
+void GodotBody3D::integrate_forces_commit() {
+	_update_broadphase();
 }
 
 void GodotBody3D::integrate_velocities(real_t p_step) {
-	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
-		return;
+	if (integrate_velocities_local(p_step)) {
+		integrate_velocities_commit();
 	}
+}
 
-	ERR_FAIL_NULL(get_space());
-
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+bool GodotBody3D::integrate_velocities_local(real_t p_step) {
+	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
+		return false;
 	}
 
+	ERR_FAIL_NULL_V(get_space(), false);
+
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
@@ -701,11 +715,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
-		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
-		}
-
-		return;
+		return true;
 	}
 
 	Vector3 total_angular_velocity = angular_velocity + biased_angular_velocity;
@@ -731,10 +741,28 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
+	_update_shape_aabbs();
 
 	_update_transform_dependent();
+
+	return true;
+}
+
+void GodotBody3D::integrate_velocities_commit() {
+	if (fi_callback_data || body_state_callback.is_valid()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
+			set_active(false); //stopped moving, deactivate
+		}
+		return;
+	}
+
+	_update_broadphase();
 }
 
 void GodotBody3D::wakeup_neighbours() {
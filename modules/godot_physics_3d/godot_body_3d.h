@@ -319,6 +319,15 @@ public:
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
 
+	// integrate_forces() and integrate_velocities() in two halves. The local
+	// half only touches this body and can run on any thread, it returns true if
+	// the commit half must then be called from the physics thread to update the
+	// broadphase and the space lists.
+	bool integrate_forces_local(real_t p_step);
+	void integrate_forces_commit();
+	bool integrate_velocities_local(real_t p_step);
+	void integrate_velocities_commit();
+
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
 	}
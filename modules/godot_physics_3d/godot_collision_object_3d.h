@@ -82,6 +82,13 @@ private:
 
 protected:
 	void _update_shapes_with_motion(const Vector3 &p_motion);
+
+	// Split versions of the above: the shape AABBs only depend on this object
+	// and can be updated from any thread, but the broadphase must be updated
+	// afterwards from the physics thread.
+	void _update_shape_aabbs();
+	void _update_shape_aabbs_with_motion(const Vector3 &p_motion);
+	void _update_broadphase();
 	void _unregister_shapes();
 
 	_FORCE_INLINE_ void _set_transform(const Transform3D &p_transform, bool p_update_shapes = true) {
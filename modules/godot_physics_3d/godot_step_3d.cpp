@@ -40,6 +40,29 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ACTIVE_BODY_COUNT_RESERVE 1024
+// Below this many elements, running a phase serially is cheaper than dispatching it.
+#define PARALLEL_PHASE_MIN_COUNT 64
+
+void GodotStep3D::_run_phase(void (GodotStep3D::*p_method)(uint32_t, void *), uint32_t p_count, const String &p_description) {
+	if (!parallel_integration || p_count < PARALLEL_PHASE_MIN_COUNT) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			(this->*p_method)(i, nullptr);
+		}
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, nullptr, p_count, -1, true, p_description);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	body_commit_pending[p_body_index] = active_bodies[p_body_index]->integrate_forces_local(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	body_commit_pending[p_body_index] = active_bodies[p_body_index]->integrate_velocities_local(delta);
+}
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -130,6 +153,14 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
+void GodotStep3D::_pre_solve_islands(uint32_t p_island_count) {
+	constraint_setup_endtime = OS::get_singleton()->get_ticks_usec();
+
+	for (uint32_t island_index = 0; island_index < p_island_count; ++island_index) {
+		_pre_solve_island(constraint_islands[island_index]);
+	}
+}
+
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
@@ -158,26 +189,33 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
-void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
+void GodotStep3D::_sleep_test_island(uint32_t p_island_index, void *p_userdata) {
+	const LocalVector<GodotBody3D *> &body_island = body_islands[p_island_index];
+
 	bool can_sleep = true;
 
-	uint32_t body_count = p_body_island.size();
+	uint32_t body_count = body_island.size();
 	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
-		GodotBody3D *body = p_body_island[body_index];
+		GodotBody3D *body = body_island[body_index];
 
 		if (!body->sleep_test(delta)) {
 			can_sleep = false;
 		}
 	}
 
+	island_can_sleep[p_island_index] = can_sleep;
+}
+
+void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island, bool p_can_sleep) const {
 	// Put all to sleep or wake up everyone.
+	uint32_t body_count = p_body_island.size();
 	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
 		GodotBody3D *body = p_body_island[body_index];
 
 		bool active = body->is_active();
 
-		if (active == can_sleep) {
-			body->set_active(!can_sleep);
+		if (active == p_can_sleep) {
+			body->set_active(!p_can_sleep);
 		}
 	}
 }
@@ -201,13 +239,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
-
+	active_bodies.clear();
 	const SelfList<GodotBody3D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
-		active_count++;
+	}
+
+	uint32_t active_body_count = active_bodies.size();
+	int active_count = active_body_count;
+
+	body_commit_pending.resize(active_body_count);
+	_run_phase(&GodotStep3D::_integrate_forces, active_body_count, SNAME("Physics3DIntegrateForces"));
+
+	// Shapes extended by their motion must be moved in the broadphase, which isn't thread-safe.
+	for (uint32_t body_index = 0; body_index < active_body_count; ++body_index) {
+		if (body_commit_pending[body_index]) {
+			active_bodies[body_index]->integrate_forces_commit();
+		}
 	}
 
 	/* UPDATE SOFT BODY MOTION */
@@ -341,51 +390,60 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 		profile_begtime = profile_endtime;
 	}
 
-	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
+	/* SETUP, PRE-SOLVE AND SOLVE CONSTRAINT ISLANDS */
 
+	// Run as a single graph, so the pool moves on to each phase as soon as the
+	// previous one is done instead of this thread waiting in between.
+	WorkerThreadPool::TaskGraph constraint_graph;
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-
-	{ //profile
-		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SETUP_CONSTRAINTS, profile_endtime - profile_begtime);
-		profile_begtime = profile_endtime;
-	}
-
-	/* PRE-SOLVE CONSTRAINT ISLANDS */
-
-	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
-	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
-		_pre_solve_island(constraint_islands[island_index]);
-	}
-
-	/* SOLVE CONSTRAINT ISLANDS */
-
+	WorkerThreadPool::TaskGraph::NodeID setup_node = constraint_graph.add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, SNAME("Physics3DConstraintSetup"));
+	// WARNING: Pre-solving is a single task, because it involves thread-unsafe processing.
+	WorkerThreadPool::TaskGraph::NodeID pre_solve_node = constraint_graph.add_template_task(this, &GodotStep3D::_pre_solve_islands, island_count, SNAME("Physics3DConstraintPreSolveIslands"));
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::TaskGraph::NodeID solve_node = constraint_graph.add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, SNAME("Physics3DConstraintSolveIslands"));
+	constraint_graph.add_dependency(pre_solve_node, setup_node);
+	constraint_graph.add_dependency(solve_node, pre_solve_node);
+
+	WorkerThreadPool::TaskGraphID constraint_graph_run = WorkerThreadPool::get_singleton()->run_task_graph(constraint_graph, true);
+	WorkerThreadPool::get_singleton()->wait_for_task_graph_completion(constraint_graph_run);
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SETUP_CONSTRAINTS, constraint_setup_endtime - profile_begtime);
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - constraint_setup_endtime);
 		profile_begtime = profile_endtime;
 	}
 
 	/* INTEGRATE VELOCITIES */
 
+	// Bodies may have been woken up by new pairs or by pre-solving since
+	// integrating forces, so the active list is gathered again. Committing may
+	// deactivate kinematic bodies, hence the snapshot.
+	active_bodies.clear();
 	b = body_list->first();
 	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	active_body_count = active_bodies.size();
+	body_commit_pending.resize(active_body_count);
+	_run_phase(&GodotStep3D::_integrate_velocities, active_body_count, SNAME("Physics3DIntegrateVelocities"));
+
+	for (uint32_t body_index = 0; body_index < active_body_count; ++body_index) {
+		if (body_commit_pending[body_index]) {
+			active_bodies[body_index]->integrate_velocities_commit();
+		}
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
 
+	island_can_sleep.resize(body_island_count);
+	_run_phase(&GodotStep3D::_sleep_test_island, body_island_count, SNAME("Physics3DSleepTest"));
+
 	for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
-		_check_suspend(body_islands[island_index]);
+		_check_suspend(body_islands[island_index], island_can_sleep[island_index]);
 	}
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
@@ -412,6 +470,8 @@ GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	active_bodies.reserve(ACTIVE_BODY_COUNT_RESERVE);
+	body_commit_pending.reserve(ACTIVE_BODY_COUNT_RESERVE);
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -44,14 +44,34 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
+	LocalVector<GodotBody3D *> active_bodies;
+	LocalVector<uint8_t> body_commit_pending;
+	LocalVector<uint8_t> island_can_sleep;
+
+	uint64_t constraint_setup_endtime = 0;
+
+	static inline bool parallel_integration = true;
+
+	void _run_phase(void (GodotStep3D::*p_method)(uint32_t, void *), uint32_t p_count, const String &p_description);
+
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	void _pre_solve_islands(uint32_t p_island_count);
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
-	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _sleep_test_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island, bool p_can_sleep) const;
 
 public:
+	// Integration of body forces and velocities, and sleep tests, are spread
+	// over the WorkerThreadPool unless this is disabled. Results are the same
+	// either way, since every body is only ever touched by one task.
+	static void set_parallel_integration_enabled(bool p_enabled) { parallel_integration = p_enabled; }
+	static bool is_parallel_integration_enabled() { return parallel_integration; }
+
 	void step(GodotSpace3D *p_space, real_t p_delta);
 	GodotStep3D();
 	~GodotStep3D();
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_godot_step_3d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+#include "../godot_step_3d.h"
+
+#include "core/os/os.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotStep3D {
+
+struct BoxPileResult {
+	LocalVector<Transform3D> transforms;
+	uint64_t step_usec = 0;
+	int active_objects = 0;
+	int island_count = 0;
+};
+
+// Drops a pile of boxes on a floor, arranged as a slightly jittered grid so
+// that they tumble into each other, and steps the simulation headlessly.
+static BoxPileResult simulate_box_pile(int p_box_count, int p_steps, bool p_parallel) {
+	const bool was_parallel = GodotStep3D::is_parallel_integration_enabled();
+	GodotStep3D::set_parallel_integration_enabled(p_parallel);
+
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+	server->set_active(true);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID floor_shape = server->world_boundary_shape_create();
+	server->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+	RID floor = server->body_create();
+	server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_set_space(floor, space);
+	server->body_add_shape(floor, floor_shape);
+
+	RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	const int side = MAX(1, int(Math::ceil(Math::sqrt(double(p_box_count) / 4.0))));
+	LocalVector<RID> boxes;
+	for (int i = 0; i < p_box_count; i++) {
+		const int layer = i / (side * side);
+		const int row = (i / side) % side;
+		const int column = i % side;
+		const real_t jitter = real_t((i * 7919) % 13) * 0.02;
+
+		RID box = server->body_create();
+		server->body_set_mode(box, PhysicsServer3D::BODY_MODE_RIGID);
+		server->body_set_space(box, space);
+		server->body_add_shape(box, box_shape);
+		server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(Vector3(0, 1, 0), jitter), Vector3(column * 1.1 + jitter, 0.6 + layer * 1.2, row * 1.1 - jitter)));
+		boxes.push_back(box);
+	}
+
+	BoxPileResult result;
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_steps; i++) {
+		server->step(1.0 / 60.0);
+	}
+	result.step_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	result.active_objects = server->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS);
+	result.island_count = server->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
+
+	for (const RID &box : boxes) {
+		result.transforms.push_back(server->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM));
+		server->free_rid(box);
+	}
+	server->free_rid(box_shape);
+	server->free_rid(floor);
+	server->free_rid(floor_shape);
+	server->free_rid(space);
+
+	server->finish();
+	memdelete(server);
+
+	GodotStep3D::set_parallel_integration_enabled(was_parallel);
+	return result;
+}
+
+TEST_CASE("[Physics3D][GodotStep3D] Parallel integration matches serial integration") {
+	const BoxPileResult serial = simulate_box_pile(300, 90, false);
+	const BoxPileResult parallel = simulate_box_pile(300, 90, true);
+
+	REQUIRE(serial.transforms.size() == parallel.transforms.size());
+	bool identical = true;
+	for (uint32_t i = 0; i < serial.transforms.size(); i++) {
+		identical = identical && serial.transforms[i] == parallel.transforms[i];
+	}
+	CHECK_MESSAGE(identical, "Every body should end up exactly where the serial step puts it.");
+
+	// Boxes must have settled on the floor rather than falling through it.
+	bool above_floor = true;
+	for (const Transform3D &transform : parallel.transforms) {
+		above_floor = above_floor && transform.origin.y > 0.0;
+	}
+	CHECK(above_floor);
+}
+
+TEST_CASE("[Physics3D][GodotStep3D][Benchmark] Step a large pile of boxes" * doctest::skip()) {
+	const int box_count = 10000;
+	const int steps = 20;
+
+	const BoxPileResult serial = simulate_box_pile(box_count, steps, false);
+	const BoxPileResult parallel = simulate_box_pile(box_count, steps, true);
+
+	CHECK(serial.transforms.size() == parallel.transforms.size());
+	MESSAGE(vformat("%d boxes, %d steps: %d usec with serial integration, %d usec with parallel integration (%d active objects, %d islands).",
+			box_count, steps, serial.step_usec, parallel.step_usec, parallel.active_objects, parallel.island_count));
+}
+
+} // namespace TestGodotStep3D
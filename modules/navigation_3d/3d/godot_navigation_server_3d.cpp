@@ -234,6 +234,48 @@ real_t GodotNavigationServer3D::map_get_link_connection_radius(RID p_map) const
 	return map->get_link_connection_radius();
 }
 
+COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_hierarchical_pathfinding(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_hierarchical_pathfinding(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_hierarchical_pathfinding();
+}
+
+COMMAND_2(map_set_hierarchical_cluster_size, RID, p_map, real_t, p_cluster_size) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_hierarchical_cluster_size(p_cluster_size);
+}
+
+real_t GodotNavigationServer3D::map_get_hierarchical_cluster_size(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_hierarchical_cluster_size();
+}
+
+COMMAND_2(map_set_use_path_cache, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_path_cache(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_path_cache(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_path_cache();
+}
+
 Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector<Vector3>());
@@ -1259,6 +1301,9 @@ COMMAND_1(free_rid, RID, p_object) {
 		if (map_index >= 0) {
 			active_maps.remove_at(map_index);
 		}
+
+		_path_query_batches_release_map(map);
+
 		map_owner.free(p_object);
 
 	} else if (region_owner.owns(p_object)) {
@@ -1369,6 +1414,8 @@ void GodotNavigationServer3D::sync() {
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->sync();
 	}
+
+	_path_query_batches_sync();
 }
 
 void GodotNavigationServer3D::process(double p_delta_time) {
@@ -1403,6 +1450,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	int _new_pm_path_cache_hit_count = 0;
+	int _new_pm_path_cache_miss_count = 0;
+	int _new_pm_path_search_polygon_count = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
@@ -1419,6 +1469,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_path_cache_hit_count += active_maps[i]->get_pm_path_cache_hit_count();
+		_new_pm_path_cache_miss_count += active_maps[i]->get_pm_path_cache_miss_count();
+		_new_pm_path_search_polygon_count += active_maps[i]->get_pm_path_search_polygon_count();
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1430,6 +1483,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_path_cache_hit_count = _new_pm_path_cache_hit_count;
+	pm_path_cache_miss_count = _new_pm_path_cache_miss_count;
+	pm_path_search_polygon_count = _new_pm_path_search_polygon_count;
 }
 
 void GodotNavigationServer3D::init() {
@@ -1440,6 +1496,14 @@ void GodotNavigationServer3D::init() {
 
 void GodotNavigationServer3D::finish() {
 	flush_queries();
+
+	path_query_batches_mutex.lock();
+	for (NavMeshQueries3D::PathQueryBatch3D *batch : path_query_batches) {
+		_path_query_batch_free(batch);
+	}
+	path_query_batches.clear();
+	path_query_batches_mutex.unlock();
+
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->finish();
 		memdelete(navmesh_generator_3d);
@@ -1457,6 +1521,143 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_paths_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_query_parameters.size() != p_query_results.size(), "The number of path query parameters and results must match.");
+
+	const uint32_t query_count = p_query_parameters.size();
+
+	LocalVector<NavMap3D *> query_maps;
+	query_maps.resize(query_count);
+	for (uint32_t i = 0; i < query_count; i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		ERR_FAIL_COND_MSG(query_parameters.is_null(), vformat("Path query parameters at index %d are null.", i));
+		ERR_FAIL_COND_MSG(Ref<NavigationPathQueryResult3D>(p_query_results[i]).is_null(), vformat("Path query result at index %d is null.", i));
+
+		query_maps[i] = map_owner.get_or_null(query_parameters->get_map());
+		ERR_FAIL_NULL_MSG(query_maps[i], vformat("Path query parameters at index %d use an invalid map.", i));
+	}
+
+	NavMeshQueries3D::PathQueryBatch3D *batch = memnew(NavMeshQueries3D::PathQueryBatch3D);
+	batch->callback = p_callback;
+	batch->query_tasks.resize(query_count);
+	batch->query_results.resize(query_count);
+
+	// Pin one iteration per map, and group the queries by map so the workers
+	// can keep their search slot from one query to the next.
+	uint32_t task_index = 0;
+	while (task_index < query_count) {
+		NavMap3D *map = nullptr;
+		for (uint32_t i = 0; i < query_count; i++) {
+			if (query_maps[i] == nullptr) {
+				continue;
+			}
+			if (map == nullptr) {
+				map = query_maps[i];
+				batch->map_iterations.push_back({ map, map->acquire_iteration() });
+			} else if (query_maps[i] != map) {
+				continue;
+			}
+
+			NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = batch->query_tasks[task_index];
+			NavMeshQueries3D::query_task_set_parameters(query_task, p_query_parameters[i]);
+			query_task.map = map;
+			query_task.map_iteration = batch->map_iterations[batch->map_iterations.size() - 1].map_iteration;
+			batch->query_results[task_index] = p_query_results[i];
+
+			query_maps[i] = nullptr;
+			task_index++;
+		}
+	}
+
+	if (query_count > 0) {
+		const uint32_t worker_count = MIN(query_count, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+		batch->group_task_id = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshQueries3D::query_batch_process, batch, worker_count, worker_count, false, SNAME("NavigationServer3DPathQueries"));
+	}
+
+	MutexLock lock(path_query_batches_mutex);
+	batch->sync_count = path_query_batches_sync_count;
+	path_query_batches.push_back(batch);
+}
+
+void GodotNavigationServer3D::_path_query_batches_sync() {
+	LocalVector<NavMeshQueries3D::PathQueryBatch3D *> finished_batches;
+
+	path_query_batches_mutex.lock();
+	for (uint32_t i = 0; i < path_query_batches.size(); i++) {
+		NavMeshQueries3D::PathQueryBatch3D *batch = path_query_batches[i];
+
+		// Batches left over from the previous sync are waited for, so results never come later than one frame.
+		bool finished = batch->sync_count < path_query_batches_sync_count;
+		finished = finished || batch->group_task_id == WorkerThreadPool::INVALID_TASK_ID || WorkerThreadPool::get_singleton()->is_group_task_completed(batch->group_task_id);
+		if (!finished) {
+			continue;
+		}
+
+		if (batch->group_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_task_id);
+			batch->group_task_id = WorkerThreadPool::INVALID_TASK_ID;
+		}
+
+		finished_batches.push_back(batch);
+		path_query_batches.remove_at(i);
+		i--;
+	}
+	path_query_batches_sync_count++;
+	path_query_batches_mutex.unlock();
+
+	// Callbacks run without the lock, so they can submit new batches right away.
+	for (NavMeshQueries3D::PathQueryBatch3D *batch : finished_batches) {
+		for (uint32_t i = 0; i < batch->query_tasks.size(); i++) {
+			NavMeshQueries3D::query_task_set_result(batch->query_tasks[i], batch->query_results[i]);
+		}
+
+		Callable callback = batch->callback;
+		_path_query_batch_free(batch);
+
+		if (callback.is_valid()) {
+			NavMeshQueries3D::emit_callback(callback);
+		}
+	}
+}
+
+void GodotNavigationServer3D::_path_query_batches_release_map(NavMap3D *p_map) {
+	MutexLock lock(path_query_batches_mutex);
+
+	for (NavMeshQueries3D::PathQueryBatch3D *batch : path_query_batches) {
+		for (NavMeshQueries3D::PathQueryBatch3D::MapIteration &map_iteration : batch->map_iterations) {
+			if (map_iteration.map != p_map) {
+				continue;
+			}
+
+			// The results were computed on the pinned iteration, they are still delivered in sync().
+			if (batch->group_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_task_id);
+				batch->group_task_id = WorkerThreadPool::INVALID_TASK_ID;
+			}
+
+			if (map_iteration.map_iteration) {
+				p_map->release_iteration(map_iteration.map_iteration);
+			}
+			map_iteration.map = nullptr;
+			map_iteration.map_iteration = nullptr;
+		}
+	}
+}
+
+void GodotNavigationServer3D::_path_query_batch_free(NavMeshQueries3D::PathQueryBatch3D *p_batch) {
+	if (p_batch->group_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(p_batch->group_task_id);
+	}
+
+	for (const NavMeshQueries3D::PathQueryBatch3D::MapIteration &map_iteration : p_batch->map_iterations) {
+		if (map_iteration.map && map_iteration.map_iteration) {
+			map_iteration.map->release_iteration(map_iteration.map_iteration);
+		}
+	}
+
+	memdelete(p_batch);
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1544,6 +1745,15 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_PATH_CACHE_HIT_COUNT: {
+			return pm_path_cache_hit_count;
+		} break;
+		case INFO_PATH_CACHE_MISS_COUNT: {
+			return pm_path_cache_miss_count;
+		} break;
+		case INFO_PATH_SEARCH_POLYGON_COUNT: {
+			return pm_path_search_polygon_count;
+		} break;
 	}
 
 	return 0;
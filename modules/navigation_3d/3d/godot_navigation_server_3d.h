@@ -82,6 +82,11 @@ class GodotNavigationServer3D : public NavigationServer3D {
 
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 
+	// Path query batches running on the WorkerThreadPool, delivered in sync().
+	Mutex path_query_batches_mutex;
+	LocalVector<NavMeshQueries3D::PathQueryBatch3D *> path_query_batches;
+	uint64_t path_query_batches_sync_count = 0;
+
 	// Performance Monitor
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -92,6 +97,9 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
+	int pm_path_search_polygon_count = 0;
 
 public:
 	GodotNavigationServer3D();
@@ -126,6 +134,15 @@ public:
 	COMMAND_2(map_set_link_connection_radius, RID, p_map, real_t, p_connection_radius);
 	virtual real_t map_get_link_connection_radius(RID p_map) const override;
 
+	COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled);
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const override;
+
+	COMMAND_2(map_set_hierarchical_cluster_size, RID, p_map, real_t, p_cluster_size);
+	virtual real_t map_get_hierarchical_cluster_size(RID p_map) const override;
+
+	COMMAND_2(map_set_use_path_cache, RID, p_map, bool, p_enabled);
+	virtual bool map_get_use_path_cache(RID p_map) const override;
+
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) override;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const override;
@@ -293,12 +310,17 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_paths_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable()) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
+
+	void _path_query_batches_sync();
+	void _path_query_batches_release_map(NavMap3D *p_map);
+	void _path_query_batch_free(NavMeshQueries3D::PathQueryBatch3D *p_batch);
 };
 
 #undef COMMAND_1
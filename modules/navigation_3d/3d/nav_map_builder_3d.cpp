@@ -72,6 +72,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_path_clusters(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -394,6 +396,131 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_path_clusters(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<PathCluster> &path_clusters = map_iteration->path_clusters;
+	LocalVector<uint32_t> &polygon_path_clusters = map_iteration->polygon_path_clusters;
+	path_clusters.clear();
+	polygon_path_clusters.clear();
+
+	if (r_build.path_cluster_size <= 0.0) {
+		return;
+	}
+
+	// Polygons are grouped by the grid cell of their center. Polygon ids follow the
+	// same order as the path query slots, regions first and links last.
+	const Vector3 cluster_cell_size = Vector3(r_build.path_cluster_size, r_build.path_cluster_size, r_build.path_cluster_size);
+	HashMap<const Polygon *, uint32_t> polygon_to_cluster;
+	polygon_to_cluster.reserve(r_build.polygon_count);
+	polygon_path_clusters.reserve(r_build.polygon_count);
+
+	HashMap<uint64_t, uint32_t> cell_to_cluster;
+
+	auto add_polygon = [&](const Polygon &p_polygon) {
+		Vector3 center;
+		for (const Vector3 &vertex : p_polygon.vertices) {
+			center += vertex;
+		}
+		if (!p_polygon.vertices.is_empty()) {
+			center /= p_polygon.vertices.size();
+		}
+
+		const uint64_t cell_key = get_point_key(center, cluster_cell_size).key;
+		HashMap<uint64_t, uint32_t>::Iterator cell = cell_to_cluster.find(cell_key);
+		uint32_t cluster_id;
+		if (cell) {
+			cluster_id = cell->value;
+		} else {
+			cluster_id = path_clusters.size();
+			cell_to_cluster.insert(cell_key, cluster_id);
+			path_clusters.push_back(PathCluster());
+		}
+
+		PathCluster &path_cluster = path_clusters[cluster_id];
+		path_cluster.position += center;
+		path_cluster.polygon_count++;
+
+		polygon_to_cluster.insert(&p_polygon, cluster_id);
+		polygon_path_clusters.push_back(cluster_id);
+	};
+
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		for (const Polygon &polygon : region->navmesh_polygons) {
+			add_polygon(polygon);
+		}
+	}
+	for (const Polygon &polygon : map_iteration->navlink_polygons) {
+		add_polygon(polygon);
+	}
+
+	for (PathCluster &path_cluster : path_clusters) {
+		path_cluster.position /= path_cluster.polygon_count;
+	}
+
+	// Every polygon connection that crosses a cluster border becomes part of a portal.
+	auto add_connection = [&](const Polygon &p_polygon, uint32_t p_cluster_id, const Connection &p_connection) {
+		HashMap<const Polygon *, uint32_t>::ConstIterator other = polygon_to_cluster.find(p_connection.polygon);
+		if (!other || other->value == p_cluster_id) {
+			return;
+		}
+
+		const NavBaseIteration3D *owner = p_polygon.owner;
+		const NavBaseIteration3D *other_owner = p_connection.polygon->owner;
+		if (!owner->get_enabled() || !other_owner->get_enabled()) {
+			return;
+		}
+
+		LocalVector<PathClusterPortal> &portals = path_clusters[p_cluster_id].portals;
+		PathClusterPortal *portal = nullptr;
+		for (PathClusterPortal &cluster_portal : portals) {
+			if (cluster_portal.cluster == other->value) {
+				portal = &cluster_portal;
+				break;
+			}
+		}
+		if (!portal) {
+			portals.push_back(PathClusterPortal());
+			portal = &portals[portals.size() - 1];
+			portal->cluster = other->value;
+		}
+
+		const Vector3 pathway_center = (p_connection.pathway_start + p_connection.pathway_end) * 0.5;
+		portal->connection_count++;
+		portal->position += (pathway_center - portal->position) / portal->connection_count;
+		portal->navigation_layers |= owner->get_navigation_layers() & other_owner->get_navigation_layers();
+	};
+
+	const HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+
+	auto add_polygon_connections = [&](const Polygon &p_polygon) {
+		const uint32_t cluster_id = polygon_to_cluster[&p_polygon];
+
+		const LocalVector<LocalVector<Connection>> &internal_connections = p_polygon.owner->get_internal_connections();
+		if (p_polygon.id < internal_connections.size()) {
+			for (const Connection &connection : internal_connections[p_polygon.id]) {
+				add_connection(p_polygon, cluster_id, connection);
+			}
+		}
+
+		HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>>::ConstIterator external_connections = navbases_polygons_external_connections.find(p_polygon.owner);
+		if (external_connections && p_polygon.id < external_connections->value.size()) {
+			for (const Connection &connection : external_connections->value[p_polygon.id]) {
+				add_connection(p_polygon, cluster_id, connection);
+			}
+		}
+	};
+
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		for (const Polygon &polygon : region->navmesh_polygons) {
+			add_polygon_connections(polygon);
+		}
+	}
+	for (const Polygon &polygon : map_iteration->navlink_polygons) {
+		add_polygon_connections(polygon);
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -427,6 +554,17 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		}
 
 		DEV_ASSERT(p_path_query_slot.path_corridor.size() == p_path_query_slot.poly_to_id.size());
+
+		p_path_query_slot.path_clusters.clear();
+		p_path_query_slot.traversable_clusters.clear();
+		if (!map_iteration->path_clusters.is_empty()) {
+			DEV_ASSERT(map_iteration->polygon_path_clusters.size() == total_polygon_count);
+			for (uint32_t i = 0; i < total_polygon_count; i++) {
+				p_path_query_slot.path_corridor[i].path_cluster = map_iteration->polygon_path_clusters[i];
+			}
+			p_path_query_slot.path_clusters.resize(map_iteration->path_clusters.size());
+			p_path_query_slot.traversable_clusters.reserve(map_iteration->path_clusters.size() * 0.25);
+		}
 	}
 
 	map_iteration->path_query_slots_mutex.unlock();
@@ -36,6 +36,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/os/semaphore.h"
+#include "core/templates/lru.h"
 
 class NavLinkIteration3D;
 class NavRegion3D;
@@ -47,6 +48,7 @@ struct NavMapIterationBuild3D {
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
+	real_t path_cluster_size = 0.0;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
 	int free_edge_count = 0;
@@ -89,6 +91,21 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
+	// Optional cluster graph over all polygons, used by path queries to narrow down long searches.
+	LocalVector<Nav3D::PathCluster> path_clusters;
+	// Cluster of each polygon, in path query polygon id order.
+	LocalVector<uint32_t> polygon_path_clusters;
+
+	// Path corridors found on this iteration. A new iteration starts with an empty cache,
+	// once full the least recently used corridors make room for new ones.
+	bool use_path_cache = false;
+	mutable Mutex path_cache_mutex;
+	mutable LRUCache<Nav3D::PathCacheKey, LocalVector<Nav3D::PathCorridorPoly>, Nav3D::PathCacheKey> path_cache{ NavigationDefaults3D::PATH_CACHE_MAX_ENTRIES };
+	mutable SafeNumeric<uint32_t> path_cache_hit_count;
+	mutable SafeNumeric<uint32_t> path_cache_miss_count;
+	// Polygons visited by the path searches on this iteration.
+	mutable SafeNumeric<uint32_t> path_search_polygon_count;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -103,6 +120,12 @@ struct NavMapIteration3D {
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
 		region_ptr_to_region_iteration.clear();
+		path_clusters.clear();
+		polygon_path_clusters.clear();
+
+		path_cache_mutex.lock();
+		path_cache.clear();
+		path_cache_mutex.unlock();
 	}
 };
 
@@ -63,6 +63,7 @@ static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshB
 	"Converting to native navigation mesh...", // step 10
 	"Baking cleanup...",
 	"Baking finished.",
+	"Baking tiles...",
 };
 
 NavMeshGenerator3D *NavMeshGenerator3D::get_singleton() {
@@ -301,6 +302,598 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 	}
 }
 
+// Owns the intermediate Recast data of one bake, so it is freed on every exit.
+struct NavMeshGeneratorRecastData3D {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+
+	rcPolyMeshDetail *release_detail_mesh() {
+		rcPolyMeshDetail *result = detail_mesh;
+		detail_mesh = nullptr;
+		return result;
+	}
+
+	~NavMeshGeneratorRecastData3D() {
+		rcFreeHeightField(hf);
+		rcFreeCompactHeightfield(chf);
+		rcFreeContourSet(cset);
+		rcFreePolyMesh(poly_mesh);
+		rcFreePolyMeshDetail(detail_mesh);
+	}
+};
+
+// Returns nullptr on errors. Source geometry without any walkable area results in an empty detail mesh.
+static rcPolyMeshDetail *_generator_build_detail_mesh(rcContext &p_ctx, rcConfig &p_cfg, const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshGenerator3D::NavMeshBakeState *r_bake_state) {
+	NavMeshGeneratorRecastData3D recast_data;
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+	rcHeightfield *hf = recast_data.hf = rcAllocHeightfield();
+
+	ERR_FAIL_NULL_V(hf, nullptr);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&p_ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), nullptr);
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
+	{
+		Vector<unsigned char> tri_areas;
+		tri_areas.resize(p_ntris);
+
+		ERR_FAIL_COND_V(tri_areas.is_empty(), nullptr);
+
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&p_ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
+
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&p_ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), nullptr);
+	}
+
+	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
+		rcFilterLowHangingWalkableObstacles(&p_ctx, p_cfg.walkableClimb, *hf);
+	}
+	if (p_navigation_mesh->get_filter_ledge_spans()) {
+		rcFilterLedgeSpans(&p_ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
+	}
+	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
+		rcFilterWalkableLowHeightSpans(&p_ctx, p_cfg.walkableHeight, *hf);
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
+
+	rcCompactHeightfield *chf = recast_data.chf = rcAllocCompactHeightfield();
+
+	ERR_FAIL_NULL_V(chf, nullptr);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&p_ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), nullptr);
+
+	rcFreeHeightField(hf);
+	recast_data.hf = nullptr;
+
+	recast_data.detail_mesh = rcAllocPolyMeshDetail();
+	ERR_FAIL_NULL_V(recast_data.detail_mesh, nullptr);
+	if (chf->spanCount == 0) {
+		// Nothing walkable, e.g. a tile that only has walls or steep slopes.
+		return recast_data.release_detail_mesh();
+	}
+
+	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
+			if (projected_obstruction.carve) {
+				continue;
+			}
+			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+				continue;
+			}
+
+			const float *projected_obstruction_verts = projected_obstruction.vertices.ptr();
+			const int projected_obstruction_nverts = projected_obstruction.vertices.size() / 3;
+
+			rcMarkConvexPolyArea(&p_ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
+		}
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
+
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&p_ctx, p_cfg.walkableRadius, *chf), nullptr);
+
+	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
+			if (!projected_obstruction.carve) {
+				continue;
+			}
+			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+				continue;
+			}
+
+			const float *projected_obstruction_verts = projected_obstruction.vertices.ptr();
+			const int projected_obstruction_nverts = projected_obstruction.vertices.size() / 3;
+
+			rcMarkConvexPolyArea(&p_ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
+		}
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
+
+	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&p_ctx, *chf), nullptr);
+		ERR_FAIL_COND_V(!rcBuildRegions(&p_ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), nullptr);
+	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&p_ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), nullptr);
+	} else {
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&p_ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), nullptr);
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
+
+	rcContourSet *cset = recast_data.cset = rcAllocContourSet();
+
+	ERR_FAIL_NULL_V(cset, nullptr);
+	ERR_FAIL_COND_V(!rcBuildContours(&p_ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), nullptr);
+	if (cset->nconts == 0) {
+		// Everything walkable was eroded or carved away.
+		return recast_data.release_detail_mesh();
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
+
+	rcPolyMesh *poly_mesh = recast_data.poly_mesh = rcAllocPolyMesh();
+	ERR_FAIL_NULL_V(poly_mesh, nullptr);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&p_ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), nullptr);
+
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&p_ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *recast_data.detail_mesh), nullptr);
+
+	return recast_data.release_detail_mesh();
+}
+
+static void _generator_convert_detail_mesh(const rcPolyMeshDetail &p_detail_mesh, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	HashMap<Vector3, int> recast_vertex_to_native_index;
+	LocalVector<int> recast_index_to_native_index;
+	recast_index_to_native_index.resize(p_detail_mesh.nverts);
+
+	for (int i = 0; i < p_detail_mesh.nverts; i++) {
+		const float *v = &p_detail_mesh.verts[i * 3];
+		const Vector3 vertex = Vector3(v[0], v[1], v[2]);
+		int *existing_index_ptr = recast_vertex_to_native_index.getptr(vertex);
+		if (!existing_index_ptr) {
+			int new_index = recast_vertex_to_native_index.size();
+			recast_index_to_native_index[i] = new_index;
+			recast_vertex_to_native_index[vertex] = new_index;
+			r_vertices.push_back(vertex);
+		} else {
+			recast_index_to_native_index[i] = *existing_index_ptr;
+		}
+	}
+
+	for (int i = 0; i < p_detail_mesh.nmeshes; i++) {
+		const unsigned int *detail_mesh_m = &p_detail_mesh.meshes[i * 4];
+		const unsigned int detail_mesh_bverts = detail_mesh_m[0];
+		const unsigned int detail_mesh_m_btris = detail_mesh_m[2];
+		const unsigned int detail_mesh_ntris = detail_mesh_m[3];
+		const unsigned char *detail_mesh_tris = &p_detail_mesh.tris[detail_mesh_m_btris * 4];
+		for (unsigned int j = 0; j < detail_mesh_ntris; j++) {
+			Vector<int> nav_indices;
+			nav_indices.resize(3);
+			// Polygon order in recast is opposite than godot's
+			int index1 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 0]));
+			int index2 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 2]));
+			int index3 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 1]));
+
+			nav_indices.write[0] = recast_index_to_native_index[index1];
+			nav_indices.write[1] = recast_index_to_native_index[index2];
+			nav_indices.write[2] = recast_index_to_native_index[index3];
+
+			r_polygons.push_back(nav_indices);
+		}
+	}
+}
+
+struct NavMeshGeneratorBakeTile3D {
+	Vector2i coords;
+	rcConfig cfg;
+	Ref<NavigationMesh> navigation_mesh;
+	LocalVector<float> verts;
+	LocalVector<int> tris;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+	float min_y = FLT_MAX;
+	float max_y = -FLT_MAX;
+	uint64_t source_hash = 0;
+	bool baked = false;
+	Vector<Vector3> vertices;
+	Vector<Vector<int>> polygons;
+};
+
+struct NavMeshGeneratorSeamVertex3D {
+	real_t along = 0.0;
+	int index = -1;
+
+	bool operator<(const NavMeshGeneratorSeamVertex3D &p_other) const { return along < p_other.along; }
+};
+
+static void _generator_bake_tile(void *p_arg) {
+	NavMeshGeneratorBakeTile3D *tile = static_cast<NavMeshGeneratorBakeTile3D *>(p_arg);
+
+	rcContext ctx;
+	NavMeshGenerator3D::NavMeshBakeState tile_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_NONE;
+	rcPolyMeshDetail *detail_mesh = _generator_build_detail_mesh(ctx, tile->cfg, tile->navigation_mesh, tile->verts.ptr(), (int)tile->verts.size() / 3, tile->tris.ptr(), (int)tile->tris.size() / 3, tile->projected_obstructions, &tile_bake_state);
+	if (detail_mesh == nullptr) {
+		return;
+	}
+
+	_generator_convert_detail_mesh(*detail_mesh, tile->vertices, tile->polygons);
+	rcFreePolyMeshDetail(detail_mesh);
+
+	tile->baked = true;
+}
+
+static void _generator_hash_tile_buffer(const void *p_data, int p_length, uint32_t &r_hash_lo, uint32_t &r_hash_hi) {
+	r_hash_lo = hash_murmur3_buffer(p_data, p_length, r_hash_lo);
+	r_hash_hi = hash_murmur3_buffer(p_data, p_length, r_hash_hi);
+}
+
+static void _generator_bake_tiles(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const Vector<float> &p_source_geometry_vertices, const Vector<int> &p_source_geometry_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, bool p_use_threads, bool p_high_priority, NavMeshGenerator3D::NavMeshBakeState *r_bake_state) {
+	const bool has_baking_aabb = p_navigation_mesh->get_filter_baking_aabb().has_volume();
+
+	// Tiles and their borders are whole cells on a grid anchored at the world origin,
+	// so that a tile keeps the same bounds (and source hash) between bakes while geometry elsewhere changes.
+	const int tile_cells = MAX(1, (int)Math::ceil(p_navigation_mesh->get_tile_size() / p_cfg.cs));
+	const int border_cells = p_cfg.walkableRadius + 3;
+	const float tile_width = tile_cells * p_cfg.cs;
+	const float border_width = border_cells * p_cfg.cs;
+
+	if (!Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_tile_size(), p_navigation_mesh->get_cell_size()))) {
+		WARN_PRINT("Property tile_size is ceiled to cell_size voxel units and loses precision.");
+	}
+
+	float bake_min[3] = { p_cfg.bmin[0], p_cfg.bmin[1], p_cfg.bmin[2] };
+	float bake_max[3] = { p_cfg.bmax[0], p_cfg.bmax[1], p_cfg.bmax[2] };
+	if (has_baking_aabb) {
+		bake_min[0] = Math::floor(bake_min[0] / p_cfg.cs) * p_cfg.cs;
+		bake_min[2] = Math::floor(bake_min[2] / p_cfg.cs) * p_cfg.cs;
+		bake_max[0] = Math::ceil(bake_max[0] / p_cfg.cs) * p_cfg.cs;
+		bake_max[2] = Math::ceil(bake_max[2] / p_cfg.cs) * p_cfg.cs;
+	}
+
+	const int tile_min_x = (int)Math::floor(bake_min[0] / tile_width);
+	const int tile_min_z = (int)Math::floor(bake_min[2] / tile_width);
+	const int tile_max_x = (int)Math::floor(bake_max[0] / tile_width);
+	const int tile_max_z = (int)Math::floor(bake_max[2] / tile_width);
+	const int64_t tiles_x = (int64_t)tile_max_x - tile_min_x + 1;
+	const int64_t tiles_z = (int64_t)tile_max_z - tile_min_z + 1;
+
+	ERR_FAIL_COND_MSG(tiles_x * tiles_z > (1 << 16), "Baking interrupted. NavigationMesh tile_size is too small for the size of the source geometry and would create more than 65536 tiles.");
+
+	LocalVector<NavMeshGeneratorBakeTile3D> tiles;
+	tiles.resize(tiles_x * tiles_z);
+	for (int z = 0; z < tiles_z; z++) {
+		for (int x = 0; x < tiles_x; x++) {
+			NavMeshGeneratorBakeTile3D &tile = tiles[z * tiles_x + x];
+			tile.coords = Vector2i(tile_min_x + x, tile_min_z + z);
+			tile.navigation_mesh = p_navigation_mesh;
+		}
+	}
+
+	// Buckets the source triangles into every tile whose bordered bounds they touch.
+	const float *verts = p_source_geometry_vertices.ptr();
+	const int *tris = p_source_geometry_indices.ptr();
+	const int ntris = p_source_geometry_indices.size() / 3;
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[tris[i * 3 + 0] * 3];
+		const float *v1 = &verts[tris[i * 3 + 1] * 3];
+		const float *v2 = &verts[tris[i * 3 + 2] * 3];
+
+		const float tri_min_x = MIN(v0[0], MIN(v1[0], v2[0]));
+		const float tri_max_x = MAX(v0[0], MAX(v1[0], v2[0]));
+		const float tri_min_z = MIN(v0[2], MIN(v1[2], v2[2]));
+		const float tri_max_z = MAX(v0[2], MAX(v1[2], v2[2]));
+		const float tri_min_y = MIN(v0[1], MIN(v1[1], v2[1]));
+		const float tri_max_y = MAX(v0[1], MAX(v1[1], v2[1]));
+
+		const int from_x = MAX(tile_min_x, (int)Math::floor((tri_min_x - border_width) / tile_width));
+		const int to_x = MIN(tile_max_x, (int)Math::floor((tri_max_x + border_width) / tile_width));
+		const int from_z = MAX(tile_min_z, (int)Math::floor((tri_min_z - border_width) / tile_width));
+		const int to_z = MIN(tile_max_z, (int)Math::floor((tri_max_z + border_width) / tile_width));
+
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				NavMeshGeneratorBakeTile3D &tile = tiles[(z - tile_min_z) * tiles_x + (x - tile_min_x)];
+				const int base_index = tile.verts.size() / 3;
+				for (int j = 0; j < 3; j++) {
+					tile.verts.push_back(v0[j]);
+				}
+				for (int j = 0; j < 3; j++) {
+					tile.verts.push_back(v1[j]);
+				}
+				for (int j = 0; j < 3; j++) {
+					tile.verts.push_back(v2[j]);
+				}
+				tile.tris.push_back(base_index);
+				tile.tris.push_back(base_index + 1);
+				tile.tris.push_back(base_index + 2);
+				tile.min_y = MIN(tile.min_y, tri_min_y);
+				tile.max_y = MAX(tile.max_y, tri_max_y);
+			}
+		}
+	}
+
+	for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
+		if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+			continue;
+		}
+
+		float obstruction_min_x = FLT_MAX;
+		float obstruction_max_x = -FLT_MAX;
+		float obstruction_min_z = FLT_MAX;
+		float obstruction_max_z = -FLT_MAX;
+		for (int i = 0; i < projected_obstruction.vertices.size(); i += 3) {
+			obstruction_min_x = MIN(obstruction_min_x, projected_obstruction.vertices[i]);
+			obstruction_max_x = MAX(obstruction_max_x, projected_obstruction.vertices[i]);
+			obstruction_min_z = MIN(obstruction_min_z, projected_obstruction.vertices[i + 2]);
+			obstruction_max_z = MAX(obstruction_max_z, projected_obstruction.vertices[i + 2]);
+		}
+
+		const int from_x = MAX(tile_min_x, (int)Math::floor((obstruction_min_x - border_width) / tile_width));
+		const int to_x = MIN(tile_max_x, (int)Math::floor((obstruction_max_x + border_width) / tile_width));
+		const int from_z = MAX(tile_min_z, (int)Math::floor((obstruction_min_z - border_width) / tile_width));
+		const int to_z = MIN(tile_max_z, (int)Math::floor((obstruction_max_z + border_width) / tile_width));
+
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				tiles[(z - tile_min_z) * tiles_x + (x - tile_min_x)].projected_obstructions.push_back(projected_obstruction);
+			}
+		}
+	}
+
+	// Settings that affect the bake but are not part of the rcConfig.
+	uint32_t settings_hash_lo = HASH_MURMUR3_SEED;
+	settings_hash_lo = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash_lo);
+	settings_hash_lo = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), settings_hash_lo);
+	settings_hash_lo = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash_lo);
+	settings_hash_lo = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), settings_hash_lo);
+	const uint32_t settings_hash_hi = hash_fmix32(settings_hash_lo ^ 0x9E3779B9);
+
+	const HashMap<Vector2i, NavigationMesh::BakeTile> cached_tiles = p_navigation_mesh->get_bake_tiles();
+	LocalVector<NavMeshGeneratorBakeTile3D *> dirty_tiles;
+
+	for (NavMeshGeneratorBakeTile3D &tile : tiles) {
+		if (tile.tris.is_empty()) {
+			continue;
+		}
+
+		rcConfig &cfg = tile.cfg;
+		memcpy(&cfg, &p_cfg, sizeof(rcConfig));
+		cfg.borderSize = border_cells;
+
+		float inner_min_x = tile.coords.x * tile_width;
+		float inner_min_z = tile.coords.y * tile_width;
+		float inner_max_x = inner_min_x + tile_width;
+		float inner_max_z = inner_min_z + tile_width;
+		if (has_baking_aabb) {
+			inner_min_x = MAX(inner_min_x, bake_min[0]);
+			inner_min_z = MAX(inner_min_z, bake_min[2]);
+			inner_max_x = MIN(inner_max_x, bake_max[0]);
+			inner_max_z = MIN(inner_max_z, bake_max[2]);
+			cfg.bmin[1] = bake_min[1];
+			cfg.bmax[1] = bake_max[1];
+		} else {
+			cfg.bmin[1] = Math::floor(tile.min_y / cfg.ch) * cfg.ch;
+			cfg.bmax[1] = (Math::floor(tile.max_y / cfg.ch) + 1.0f) * cfg.ch;
+		}
+		if (inner_min_x >= inner_max_x || inner_min_z >= inner_max_z) {
+			continue;
+		}
+		cfg.bmin[0] = inner_min_x - border_width;
+		cfg.bmin[2] = inner_min_z - border_width;
+		cfg.bmax[0] = inner_max_x + border_width;
+		cfg.bmax[2] = inner_max_z + border_width;
+		rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+		uint32_t hash_lo = settings_hash_lo;
+		uint32_t hash_hi = settings_hash_hi;
+		_generator_hash_tile_buffer(&cfg, sizeof(rcConfig), hash_lo, hash_hi);
+		_generator_hash_tile_buffer(tile.verts.ptr(), tile.verts.size() * sizeof(float), hash_lo, hash_hi);
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : tile.projected_obstructions) {
+			_generator_hash_tile_buffer(projected_obstruction.vertices.ptr(), projected_obstruction.vertices.size() * sizeof(float), hash_lo, hash_hi);
+			_generator_hash_tile_buffer(&projected_obstruction.elevation, sizeof(float), hash_lo, hash_hi);
+			_generator_hash_tile_buffer(&projected_obstruction.height, sizeof(float), hash_lo, hash_hi);
+			hash_lo = hash_murmur3_one_32(projected_obstruction.carve, hash_lo);
+			hash_hi = hash_murmur3_one_32(projected_obstruction.carve, hash_hi);
+		}
+		tile.source_hash = ((uint64_t)hash_hi << 32) | hash_lo;
+
+		const NavigationMesh::BakeTile *cached_tile = cached_tiles.getptr(tile.coords);
+		if (cached_tile && cached_tile->source_hash == tile.source_hash) {
+			tile.vertices = cached_tile->vertices;
+			tile.polygons = cached_tile->polygons;
+			tile.baked = true;
+		} else {
+			dirty_tiles.push_back(&tile);
+		}
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_BAKING_TILES;
+
+	if (p_use_threads && dirty_tiles.size() > 1) {
+		LocalVector<WorkerThreadPool::TaskID> tile_task_ids;
+		tile_task_ids.resize(dirty_tiles.size());
+		for (uint32_t i = 0; i < dirty_tiles.size(); i++) {
+			tile_task_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(&_generator_bake_tile, dirty_tiles[i], p_high_priority, SNAME("NavMeshGeneratorBakeTile3D"));
+		}
+		for (const WorkerThreadPool::TaskID &tile_task_id : tile_task_ids) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tile_task_id);
+		}
+	} else {
+		for (NavMeshGeneratorBakeTile3D *tile : dirty_tiles) {
+			_generator_bake_tile(tile);
+		}
+	}
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	// Welds the shared border vertices of neighboring tiles back into one mesh.
+	// Vertices only weld within climbing height of each other, so that stacked floors stay apart.
+	const float weld_quantum = p_cfg.cs * 0.01f;
+	const float weld_height = (p_cfg.walkableClimb + 1) * p_cfg.ch;
+	HashMap<Vector2i, LocalVector<int>> weld_columns;
+	HashMap<Vector2i, NavigationMesh::BakeTile> bake_tiles;
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	for (const NavMeshGeneratorBakeTile3D &tile : tiles) {
+		if (!tile.baked) {
+			continue;
+		}
+
+		NavigationMesh::BakeTile &bake_tile = bake_tiles[tile.coords];
+		bake_tile.source_hash = tile.source_hash;
+		bake_tile.vertices = tile.vertices;
+		bake_tile.polygons = tile.polygons;
+		bake_tile.polygon_begin = nav_polygons.size();
+
+		LocalVector<int> tile_index_to_native_index;
+		tile_index_to_native_index.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			const Vector3 &vertex = tile.vertices[i];
+			LocalVector<int> &weld_column = weld_columns[Vector2i(Math::round(vertex.x / weld_quantum), Math::round(vertex.z / weld_quantum))];
+			int native_index = -1;
+			for (int column_index : weld_column) {
+				if (Math::abs(nav_vertices[column_index].y - vertex.y) <= weld_height) {
+					native_index = column_index;
+					break;
+				}
+			}
+			if (native_index == -1) {
+				native_index = nav_vertices.size();
+				weld_column.push_back(native_index);
+				nav_vertices.push_back(vertex);
+			}
+			tile_index_to_native_index[i] = native_index;
+		}
+
+		for (const Vector<int> &polygon : tile.polygons) {
+			Vector<int> nav_polygon;
+			for (int i = 0; i < polygon.size(); i++) {
+				const int native_index = tile_index_to_native_index[polygon[i]];
+				if (nav_polygon.is_empty() || nav_polygon[nav_polygon.size() - 1] != native_index) {
+					nav_polygon.push_back(native_index);
+				}
+			}
+			if (nav_polygon.size() > 1 && nav_polygon[0] == nav_polygon[nav_polygon.size() - 1]) {
+				nav_polygon.resize(nav_polygon.size() - 1);
+			}
+			if (nav_polygon.size() < 3) {
+				continue;
+			}
+			nav_polygons.push_back(nav_polygon);
+		}
+
+		bake_tile.polygon_count = nav_polygons.size() - bake_tile.polygon_begin;
+	}
+
+	// Neighboring tiles do not subdivide a shared seam the same way, so an edge on a seam line
+	// is split at every vertex of the other side that lies on it. Without this, the T-junctions
+	// leave the edges unmatched and the tiles disconnected in the navigation region.
+	const float seam_tolerance = p_cfg.cs * 0.1f;
+	HashMap<Vector2i, LocalVector<NavMeshGeneratorSeamVertex3D>> seam_lines;
+	LocalVector<Vector2i> vertex_seam_lines;
+	vertex_seam_lines.resize(nav_vertices.size());
+	for (int i = 0; i < nav_vertices.size(); i++) {
+		const Vector3 &vertex = nav_vertices[i];
+		const int seam_x = (int)Math::round(vertex.x / tile_width);
+		const int seam_z = (int)Math::round(vertex.z / tile_width);
+		vertex_seam_lines[i] = Vector2i(INT32_MIN, INT32_MIN);
+		if (Math::abs(vertex.x - seam_x * tile_width) <= seam_tolerance) {
+			vertex_seam_lines[i].x = seam_x;
+			seam_lines[Vector2i(0, seam_x)].push_back({ vertex.z, i });
+		}
+		if (Math::abs(vertex.z - seam_z * tile_width) <= seam_tolerance) {
+			vertex_seam_lines[i].y = seam_z;
+			seam_lines[Vector2i(1, seam_z)].push_back({ vertex.x, i });
+		}
+	}
+	for (KeyValue<Vector2i, LocalVector<NavMeshGeneratorSeamVertex3D>> &seam_line : seam_lines) {
+		seam_line.value.sort();
+	}
+
+	for (Vector<int> &nav_polygon : nav_polygons) {
+		Vector<int> split_polygon;
+		bool split = false;
+		for (int i = 0; i < nav_polygon.size(); i++) {
+			const int index_a = nav_polygon[i];
+			const int index_b = nav_polygon[(i + 1) % nav_polygon.size()];
+			split_polygon.push_back(index_a);
+
+			for (int axis = 0; axis < 2; axis++) {
+				const int seam = vertex_seam_lines[index_a][axis];
+				if (seam == INT32_MIN || seam != vertex_seam_lines[index_b][axis]) {
+					continue;
+				}
+				const LocalVector<NavMeshGeneratorSeamVertex3D> &seam_line = seam_lines[Vector2i(axis, seam)];
+				const Vector3 &vertex_a = nav_vertices[index_a];
+				const Vector3 &vertex_b = nav_vertices[index_b];
+				const real_t along_a = axis == 0 ? vertex_a.z : vertex_a.x;
+				const real_t along_b = axis == 0 ? vertex_b.z : vertex_b.x;
+				const real_t along_min = MIN(along_a, along_b) + weld_quantum;
+				const real_t along_max = MAX(along_a, along_b) - weld_quantum;
+
+				// Seam vertices between the edge end points, in the walking direction of the edge.
+				uint32_t first = 0;
+				uint32_t last = seam_line.size();
+				while (first < last) {
+					const uint32_t middle = (first + last) / 2;
+					if (seam_line[middle].along < along_min) {
+						first = middle + 1;
+					} else {
+						last = middle;
+					}
+				}
+				LocalVector<int> between;
+				for (uint32_t j = first; j < seam_line.size() && seam_line[j].along <= along_max; j++) {
+					const Vector3 &vertex = nav_vertices[seam_line[j].index];
+					const real_t weight = (seam_line[j].along - along_a) / (along_b - along_a);
+					if (Math::abs(vertex.y - Math::lerp(vertex_a.y, vertex_b.y, weight)) <= weld_height) {
+						between.push_back(seam_line[j].index);
+					}
+				}
+				if (along_a > along_b) {
+					between.reverse();
+				}
+				for (int index : between) {
+					split_polygon.push_back(index);
+				}
+				split = split || !between.is_empty();
+				break;
+			}
+		}
+		if (split) {
+			nav_polygon = split_polygon;
+		}
+	}
+
+	// The final polygons of a tile also depend on its neighbors, so regions compare this hash to reuse their tile build.
+	for (KeyValue<Vector2i, NavigationMesh::BakeTile> &bake_tile : bake_tiles) {
+		uint32_t hash_lo = HASH_MURMUR3_SEED;
+		uint32_t hash_hi = hash_fmix32(HASH_MURMUR3_SEED ^ 0x9E3779B9);
+		for (int i = 0; i < bake_tile.value.polygon_count; i++) {
+			const Vector<int> &nav_polygon = nav_polygons[bake_tile.value.polygon_begin + i];
+			for (int index : nav_polygon) {
+				_generator_hash_tile_buffer(&nav_vertices[index], sizeof(Vector3), hash_lo, hash_hi);
+			}
+			hash_lo = hash_murmur3_one_32(nav_polygon.size(), hash_lo);
+			hash_hi = hash_murmur3_one_32(nav_polygon.size(), hash_hi);
+		}
+		bake_tile.value.mesh_hash = ((uint64_t)hash_hi << 32) | hash_lo;
+	}
+
+	p_navigation_mesh->set_tiled_data(nav_vertices, nav_polygons, bake_tiles);
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+
+	tiles.clear();
+
+	*r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
 void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task) {
 	Ref<NavigationMesh> p_navigation_mesh = p_generator_task->navigation_mesh;
 	const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data = p_generator_task->source_geometry_data;
@@ -322,11 +915,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
 	rcContext ctx;
 
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
@@ -405,6 +993,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
 	}
 
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		_generator_bake_tiles(p_navigation_mesh, cfg, source_geometry_vertices, source_geometry_indices, projected_obstructions, use_threads, baking_use_high_priority_threads, &p_generator_task->bake_state);
+		return;
+	}
+
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
 	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
 
@@ -419,167 +1012,21 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
-	hf = rcAllocHeightfield();
-
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
-	{
-		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
-
-		ERR_FAIL_COND(tri_areas.is_empty());
-
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
-
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
-	}
-
-	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
-	}
-	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
-	}
-	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
-	}
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
-
-	chf = rcAllocCompactHeightfield();
-
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
-
-	rcFreeHeightField(hf);
-	hf = nullptr;
-
-	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
-			if (projected_obstruction.carve) {
-				continue;
-			}
-			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
-				continue;
-			}
-
-			const float *projected_obstruction_verts = projected_obstruction.vertices.ptr();
-			const int projected_obstruction_nverts = projected_obstruction.vertices.size() / 3;
-
-			rcMarkConvexPolyArea(&ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
-		}
-	}
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
-
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
-
-	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
-			if (!projected_obstruction.carve) {
-				continue;
-			}
-			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
-				continue;
-			}
-
-			const float *projected_obstruction_verts = projected_obstruction.vertices.ptr();
-			const int projected_obstruction_nverts = projected_obstruction.vertices.size() / 3;
-
-			rcMarkConvexPolyArea(&ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
-		}
-	}
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
-
-	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
-	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
-	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+	rcPolyMeshDetail *detail_mesh = _generator_build_detail_mesh(ctx, cfg, p_navigation_mesh, verts, nverts, tris, ntris, projected_obstructions, &p_generator_task->bake_state);
+	if (detail_mesh == nullptr) {
+		return;
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
-
-	cset = rcAllocContourSet();
-
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
-
-	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
-
-	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
-
-	rcFreeCompactHeightfield(chf);
-	chf = nullptr;
-	rcFreeContourSet(cset);
-	cset = nullptr;
-
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
 
 	Vector<Vector3> nav_vertices;
 	Vector<Vector<int>> nav_polygons;
-
-	HashMap<Vector3, int> recast_vertex_to_native_index;
-	LocalVector<int> recast_index_to_native_index;
-	recast_index_to_native_index.resize(detail_mesh->nverts);
-
-	for (int i = 0; i < detail_mesh->nverts; i++) {
-		const float *v = &detail_mesh->verts[i * 3];
-		const Vector3 vertex = Vector3(v[0], v[1], v[2]);
-		int *existing_index_ptr = recast_vertex_to_native_index.getptr(vertex);
-		if (!existing_index_ptr) {
-			int new_index = recast_vertex_to_native_index.size();
-			recast_index_to_native_index[i] = new_index;
-			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
-		} else {
-			recast_index_to_native_index[i] = *existing_index_ptr;
-		}
-	}
-
-	for (int i = 0; i < detail_mesh->nmeshes; i++) {
-		const unsigned int *detail_mesh_m = &detail_mesh->meshes[i * 4];
-		const unsigned int detail_mesh_bverts = detail_mesh_m[0];
-		const unsigned int detail_mesh_m_btris = detail_mesh_m[2];
-		const unsigned int detail_mesh_ntris = detail_mesh_m[3];
-		const unsigned char *detail_mesh_tris = &detail_mesh->tris[detail_mesh_m_btris * 4];
-		for (unsigned int j = 0; j < detail_mesh_ntris; j++) {
-			Vector<int> nav_indices;
-			nav_indices.resize(3);
-			// Polygon order in recast is opposite than godot's
-			int index1 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 0]));
-			int index2 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 2]));
-			int index3 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 1]));
-
-			nav_indices.write[0] = recast_index_to_native_index[index1];
-			nav_indices.write[1] = recast_index_to_native_index[index2];
-			nav_indices.write[2] = recast_index_to_native_index[index3];
-
-			nav_polygons.push_back(nav_indices);
-		}
-	}
+	_generator_convert_detail_mesh(*detail_mesh, nav_vertices, nav_polygons);
 
 	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
 
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
 
-	rcFreePolyMesh(poly_mesh);
-	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
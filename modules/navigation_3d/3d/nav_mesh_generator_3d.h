@@ -69,6 +69,7 @@ public:
 		BAKE_STATE_CONVERTING_NATIVE_NAVMESH,
 		BAKE_STATE_BAKE_CLEANUP,
 		BAKE_STATE_BAKE_FINISHED,
+		BAKE_STATE_BAKING_TILES,
 		BAKE_STATE_MAX,
 	};
 
@@ -150,14 +150,70 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	ERR_FAIL_COND(p_query_parameters.is_null());
 	ERR_FAIL_COND(p_query_result.is_null());
 
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_task_set_parameters(query_task, p_query_parameters);
+	query_task.callback = p_callback;
+
+	map->query_path(query_task);
+
+	query_task_set_result(query_task, p_query_result);
+
+	if (query_task.callback.is_valid()) {
+		if (emit_callback(query_task.callback)) {
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
+		} else {
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
+		}
+	}
+}
+
+void NavMeshQueries3D::query_batch_process(void *p_arg, uint32_t p_worker_index) {
+	PathQueryBatch3D *batch = static_cast<PathQueryBatch3D *>(p_arg);
+
+	// Each worker keeps its search slot, and the memory in it, for as long as
+	// the queries it picks use the same map iteration.
+	NavMapIteration3D *slot_map_iteration = nullptr;
+	PathQuerySlot *path_query_slot = nullptr;
+
+	for (uint32_t i = batch->next_query_task.postincrement(); i < batch->query_tasks.size(); i = batch->next_query_task.postincrement()) {
+		NavMeshPathQueryTask3D &query_task = batch->query_tasks[i];
+		if (!query_task.map_iteration) {
+			// The map has no iteration yet, the path stays empty like with map_query_path().
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED;
+			continue;
+		}
+
+		if (query_task.map_iteration != slot_map_iteration) {
+			if (path_query_slot) {
+				NavMap3D::release_path_query_slot(*slot_map_iteration, path_query_slot);
+			}
+			slot_map_iteration = query_task.map_iteration;
+			path_query_slot = NavMap3D::acquire_path_query_slot(*slot_map_iteration);
+			if (!path_query_slot) {
+				slot_map_iteration = nullptr;
+				query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED;
+				continue;
+			}
+		}
+
+		query_task.path_query_slot = path_query_slot;
+		query_task.map_up = slot_map_iteration->map_up;
+		query_task_map_iteration_get_path(query_task, *slot_map_iteration);
+		query_task.path_query_slot = nullptr;
+	}
+
+	if (path_query_slot) {
+		NavMap3D::release_path_query_slot(*slot_map_iteration, path_query_slot);
+	}
+}
+
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
 	using namespace NavigationDefaults3D;
 
-	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	NavMeshPathQueryTask3D &query_task = p_query_task;
 	query_task.start_position = p_query_parameters->get_start_position();
 	query_task.target_position = p_query_parameters->get_target_position();
 	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
-
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
 
@@ -215,23 +271,15 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
 	query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
 	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+}
 
-	map->query_path(query_task);
-
+void NavMeshQueries3D::query_task_set_result(const NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result) {
 	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
-	p_query_result->set_path_length(query_task.path_length);
-
-	if (query_task.callback.is_valid()) {
-		if (emit_callback(query_task.callback)) {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
-		} else {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
-		}
-	}
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
+	p_query_result->set_path_length(p_query_task.path_length);
 }
 
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
@@ -295,6 +343,9 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 
 	// Check if the neighbor polygon has already been processed.
 	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
+	if (p_query_task.use_path_clusters && !p_query_task.path_query_slot->path_clusters[neighbor_poly.path_cluster].in_corridor) {
+		return;
+	}
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
@@ -369,6 +420,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		const NavBaseIteration3D *least_cost_navbase = least_cost_poly.poly->owner;
 
 		processed_polygon_count += 1;
+		p_query_task.path_search_polygon_count += 1;
 
 		const uint32_t navbase_local_polygon_id = least_cost_poly.poly->id;
 		const LocalVector<LocalVector<Connection>> &navbase_polygons_to_connections = least_cost_poly.poly->owner->get_internal_connections();
@@ -400,6 +452,14 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.use_path_clusters) {
+				// Clusters are not always connected inside, so the cluster corridor can miss
+				// the route. Search the whole map before giving up on the end polygon.
+				p_query_task.use_path_clusters = false;
+				_query_task_build_path_corridor(p_query_task, p_map_iteration);
+				return;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -511,8 +571,176 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	}
 }
 
+bool NavMeshQueries3D::_query_task_build_path_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const LocalVector<PathCluster> &map_path_clusters = p_map_iteration.path_clusters;
+	if (map_path_clusters.is_empty() || p_query_task.exclude_regions || p_query_task.include_regions) {
+		return false;
+	}
+
+	PathQuerySlot *path_query_slot = p_query_task.path_query_slot;
+	const LocalVector<NavigationPoly> &navigation_polys = path_query_slot->path_corridor;
+	const uint32_t begin_cluster_id = navigation_polys[path_query_slot->poly_to_id[p_query_task.begin_polygon]].path_cluster;
+	const uint32_t end_cluster_id = navigation_polys[path_query_slot->poly_to_id[p_query_task.end_polygon]].path_cluster;
+	if (begin_cluster_id == end_cluster_id || begin_cluster_id >= map_path_clusters.size() || end_cluster_id >= map_path_clusters.size()) {
+		// Nothing to narrow down, the polygon search stays local anyway.
+		return false;
+	}
+
+	LocalVector<NavigationPathCluster> &path_clusters = path_query_slot->path_clusters;
+	Heap<NavigationPathCluster *, NavPathClusterTravelCostGreaterThan, NavPathClusterHeapIndexer> &traversable_clusters = path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+	for (NavigationPathCluster &path_cluster : path_clusters) {
+		path_cluster.reset();
+	}
+
+	const Vector3 end_point = p_query_task.end_position;
+
+	NavigationPathCluster &begin_cluster = path_clusters[begin_cluster_id];
+	begin_cluster.entry = p_query_task.begin_position;
+	begin_cluster.traveled_distance = 0.0;
+	begin_cluster.distance_to_destination = begin_cluster.entry.distance_to(end_point);
+	traversable_clusters.push(&begin_cluster);
+
+	// A* over the cluster graph, entering each cluster through the portal it was reached by.
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const NavigationPathCluster *least_cost_cluster = traversable_clusters.pop();
+		const uint32_t least_cost_id = least_cost_cluster - path_clusters.ptr();
+		if (least_cost_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		for (const PathClusterPortal &portal : map_path_clusters[least_cost_id].portals) {
+			if ((portal.navigation_layers & p_query_task.navigation_layers) == 0) {
+				continue;
+			}
+
+			NavigationPathCluster &neighbor_cluster = path_clusters[portal.cluster];
+			const real_t new_traveled_distance = least_cost_cluster->traveled_distance + least_cost_cluster->entry.distance_to(portal.position);
+			if (new_traveled_distance >= neighbor_cluster.traveled_distance) {
+				continue;
+			}
+
+			neighbor_cluster.back_cluster = least_cost_id;
+			neighbor_cluster.entry = portal.position;
+			neighbor_cluster.traveled_distance = new_traveled_distance;
+			neighbor_cluster.distance_to_destination = portal.position.distance_to(end_point);
+
+			if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+				traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+			} else {
+				traversable_clusters.push(&neighbor_cluster);
+			}
+		}
+	}
+	traversable_clusters.clear();
+
+	if (!found_route) {
+		return false;
+	}
+
+	// Open the clusters on the route and their direct neighbors, so the polygon search
+	// has room to cut corners between portals.
+	for (uint32_t cluster_id = end_cluster_id; cluster_id != UINT32_MAX; cluster_id = path_clusters[cluster_id].back_cluster) {
+		path_clusters[cluster_id].in_corridor = true;
+		for (const PathClusterPortal &portal : map_path_clusters[cluster_id].portals) {
+			if ((portal.navigation_layers & p_query_task.navigation_layers) != 0) {
+				path_clusters[portal.cluster].in_corridor = true;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool NavMeshQueries3D::_query_task_get_path_cache_key(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, PathCacheKey &r_key) {
+	// The search distance limit depends on the start position, not only on the polygons.
+	if (!p_map_iteration.use_path_cache || p_query_task.path_search_max_distance > 0.0) {
+		return false;
+	}
+
+	r_key.begin_polygon = p_query_task.begin_polygon;
+	r_key.end_polygon = p_query_task.end_polygon;
+	r_key.navigation_layers = p_query_task.navigation_layers;
+	r_key.path_search_max_polygons = p_query_task.path_search_max_polygons;
+	if (p_query_task.exclude_regions) {
+		r_key.excluded_regions = p_query_task.excluded_regions;
+	}
+	if (p_query_task.include_regions) {
+		r_key.included_regions = p_query_task.included_regions;
+	}
+	r_key.update_hash();
+	return true;
+}
+
+bool NavMeshQueries3D::_query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const PathCacheKey &p_key) {
+	MutexLock lock(p_map_iteration.path_cache_mutex);
+
+	const LocalVector<PathCorridorPoly> *cached = p_map_iteration.path_cache.getptr(p_key);
+	if (!cached) {
+		p_map_iteration.path_cache_miss_count.increment();
+		return false;
+	}
+	p_map_iteration.path_cache_hit_count.increment();
+
+	// Rebuild the back links the post-processing walks, with entries for this query's begin position.
+	// The corridor itself was found from another position in the begin polygon, so the path can
+	// differ slightly from the one a full search would find from this position.
+	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+	int back_navigation_poly_id = -1;
+	Vector3 entry = p_query_task.begin_position;
+	for (const PathCorridorPoly &corridor_poly : *cached) {
+		NavigationPoly &navigation_poly = navigation_polys[corridor_poly.poly_id];
+		navigation_poly.poly = corridor_poly.poly;
+		navigation_poly.back_navigation_poly_id = back_navigation_poly_id;
+		navigation_poly.back_navigation_edge = corridor_poly.back_navigation_edge;
+		if (back_navigation_poly_id == -1) {
+			navigation_poly.back_navigation_edge_pathway_start = entry;
+			navigation_poly.back_navigation_edge_pathway_end = entry;
+		} else {
+			navigation_poly.back_navigation_edge_pathway_start = corridor_poly.back_navigation_edge_pathway_start;
+			navigation_poly.back_navigation_edge_pathway_end = corridor_poly.back_navigation_edge_pathway_end;
+			entry = Geometry3D::get_closest_point_to_segment(entry, corridor_poly.back_navigation_edge_pathway_start, corridor_poly.back_navigation_edge_pathway_end);
+		}
+		navigation_poly.entry = entry;
+		back_navigation_poly_id = corridor_poly.poly_id;
+	}
+	p_query_task.least_cost_id = back_navigation_poly_id;
+
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_cache_path_corridor(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const PathCacheKey &p_key) {
+	// Only complete routes are worth keeping, a fallback to the closest reachable
+	// polygon depends on the exact target position.
+	if (p_query_task.status != NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED || p_query_task.end_polygon != p_key.end_polygon) {
+		return;
+	}
+
+	const LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	LocalVector<PathCorridorPoly> corridor;
+	for (int navigation_poly_id = p_query_task.least_cost_id; navigation_poly_id != -1; navigation_poly_id = navigation_polys[navigation_poly_id].back_navigation_poly_id) {
+		const NavigationPoly &navigation_poly = navigation_polys[navigation_poly_id];
+
+		PathCorridorPoly corridor_poly;
+		corridor_poly.poly = navigation_poly.poly;
+		corridor_poly.poly_id = navigation_poly_id;
+		corridor_poly.back_navigation_edge = navigation_poly.back_navigation_edge;
+		corridor_poly.back_navigation_edge_pathway_start = navigation_poly.back_navigation_edge_pathway_start;
+		corridor_poly.back_navigation_edge_pathway_end = navigation_poly.back_navigation_edge_pathway_end;
+		corridor.push_back(corridor_poly);
+	}
+	corridor.reverse();
+
+	MutexLock lock(p_map_iteration.path_cache_mutex);
+	p_map_iteration.path_cache.insert(p_key, corridor);
+}
+
 void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	p_query_task.path_clear();
+	p_query_task.path_search_polygon_count = 0;
 
 	_query_task_find_start_end_positions(p_query_task, p_map_iteration);
 
@@ -530,7 +758,18 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task, p_map_iteration);
+	PathCacheKey path_cache_key;
+	const bool use_path_cache = _query_task_get_path_cache_key(p_query_task, p_map_iteration, path_cache_key);
+	if (!use_path_cache || !_query_task_restore_cached_path_corridor(p_query_task, p_map_iteration, path_cache_key)) {
+		p_query_task.use_path_clusters = _query_task_build_path_cluster_corridor(p_query_task, p_map_iteration);
+		_query_task_build_path_corridor(p_query_task, p_map_iteration);
+		p_query_task.use_path_clusters = false;
+		p_map_iteration.path_search_polygon_count.add(p_query_task.path_search_polygon_count);
+
+		if (use_path_cache) {
+			_query_task_cache_path_corridor(p_query_task, p_map_iteration, path_cache_key);
+		}
+	}
 
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		_query_task_process_path_result_limits(p_query_task);
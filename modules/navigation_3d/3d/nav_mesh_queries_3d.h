@@ -32,6 +32,7 @@
 
 #include "../nav_utils_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/a_hash_map.h"
 
 #include "servers/nav_heap.h"
@@ -53,6 +54,9 @@ public:
 		bool in_use = false;
 		uint32_t slot_index = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
+
+		LocalVector<Nav3D::NavigationPathCluster> path_clusters;
+		Heap<Nav3D::NavigationPathCluster *, Nav3D::NavPathClusterTravelCostGreaterThan, Nav3D::NavPathClusterHeapIndexer> traversable_clusters;
 	};
 
 	struct NavMeshPathQueryTask3D {
@@ -90,10 +94,13 @@ public:
 		const Nav3D::Polygon *begin_polygon = nullptr;
 		const Nav3D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		bool use_path_clusters = false;
+		uint32_t path_search_polygon_count = 0;
 
 		// Map.
 		Vector3 map_up;
 		NavMap3D *map = nullptr;
+		NavMapIteration3D *map_iteration = nullptr;
 		PathQuerySlot *path_query_slot = nullptr;
 
 		// Path points.
@@ -123,6 +130,26 @@ public:
 		}
 	};
 
+	// Many path queries run together on the WorkerThreadPool. Each map's
+	// iteration is kept alive for the whole batch, so all its queries see
+	// the same navigation data.
+	struct PathQueryBatch3D {
+		struct MapIteration {
+			NavMap3D *map = nullptr;
+			NavMapIteration3D *map_iteration = nullptr;
+		};
+
+		// Sorted by map iteration, so the workers rarely switch search slots.
+		LocalVector<NavMeshPathQueryTask3D> query_tasks;
+		LocalVector<Ref<NavigationPathQueryResult3D>> query_results;
+		LocalVector<MapIteration> map_iterations;
+		SafeNumeric<uint32_t> next_query_task;
+
+		Callable callback;
+		WorkerThreadPool::GroupID group_task_id = WorkerThreadPool::INVALID_TASK_ID;
+		uint64_t sync_count = 0;
+	};
+
 	static bool emit_callback(const Callable &p_callback);
 
 	static Vector3 polygons_get_random_point(const LocalVector<Nav3D::Polygon> &p_polygons, uint32_t p_navigation_layers, bool p_uniformly);
@@ -141,11 +168,19 @@ public:
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static void query_batch_process(void *p_arg, uint32_t p_worker_index);
+
+	static void query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
+	static void query_task_set_result(const NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_build_path_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_get_path_cache_key(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, Nav3D::PathCacheKey &r_key);
+	static bool _query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCacheKey &p_key);
+	static void _query_task_cache_path_corridor(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCacheKey &p_key);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
@@ -47,15 +47,52 @@ void NavRegionBuilder3D::build_iteration(NavRegionIterationBuild3D &r_build) {
 	performance_data.pm_edge_connection_count = 0;
 	performance_data.pm_edge_free_count = 0;
 
-	_build_step_process_navmesh_data(r_build);
+	if (!_build_step_process_navmesh_tiles(r_build)) {
+		_build_step_process_navmesh_data(r_build);
 
-	_build_step_find_edge_connection_pairs(r_build);
+		_build_step_find_edge_connection_pairs(r_build);
+	}
 
 	_build_step_merge_edge_connection_pairs(r_build);
 
 	_build_update_iteration(r_build);
 }
 
+bool NavRegionBuilder3D::_build_polygon(const Vector<Vector3> &p_vertices, const Vector<int> &p_indices, const Transform3D &p_transform, Polygon &r_polygon) {
+	r_polygon.surface_area = 0.0;
+	r_polygon.vertices.clear();
+
+	const int polygon_size = p_indices.size();
+	if (polygon_size < 3) {
+		return true;
+	}
+
+	const int vertex_count = p_vertices.size();
+	const int *indices_ptr = p_indices.ptr();
+
+	for (int j(0); j < polygon_size; j++) {
+		if (indices_ptr[j] < 0 || indices_ptr[j] >= vertex_count) {
+			return false;
+		}
+	}
+
+	const Vector3 *vertices_ptr = p_vertices.ptr();
+
+	r_polygon.vertices.resize(polygon_size);
+	for (int j(0); j < polygon_size; j++) {
+		r_polygon.vertices[j] = p_transform.xform(vertices_ptr[indices_ptr[j]]);
+	}
+
+	real_t _new_polygon_surface_area = 0.0;
+	for (int j(2); j < polygon_size; j++) {
+		const Face3 face = Face3(r_polygon.vertices[0], r_polygon.vertices[j - 1], r_polygon.vertices[j]);
+		_new_polygon_surface_area += face.get_area();
+	}
+	r_polygon.surface_area = _new_polygon_surface_area;
+
+	return true;
+}
+
 void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuild3D &r_build) {
 	Vector<Vector3> _navmesh_vertices = r_build.navmesh_data.vertices;
 	Vector<Vector<int>> _navmesh_polygons = r_build.navmesh_data.polygons;
@@ -70,9 +107,6 @@ void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuil
 	const Transform3D &region_transform = region_iteration->transform;
 	LocalVector<Nav3D::Polygon> &navmesh_polygons = region_iteration->navmesh_polygons;
 
-	const int vertex_count = _navmesh_vertices.size();
-
-	const Vector3 *vertices_ptr = _navmesh_vertices.ptr();
 	const Vector<int> *polygons_ptr = _navmesh_polygons.ptr();
 
 	navmesh_polygons.resize(_navmesh_polygons.size());
@@ -86,66 +120,224 @@ void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuil
 		Polygon &polygon = navmesh_polygons[i];
 		polygon.id = i;
 		polygon.owner = region_iteration.ptr();
-		polygon.surface_area = 0.0;
 
-		Vector<int> polygon_indices = polygons_ptr[i];
+		if (!_build_polygon(_navmesh_vertices, polygons_ptr[i], region_transform, polygon)) {
+			ERR_FAIL_MSG("Corrupted navigation mesh set on region. The indices of a polygon are out of range.");
+		}
+
+		_new_region_surface_area += polygon.surface_area;
+
+		for (const Vector3 &point_position : polygon.vertices) {
+			if (first_vertex) {
+				first_vertex = false;
+				_new_region_bounds.position = point_position;
+			} else {
+				_new_region_bounds.expand_to(point_position);
+			}
+		}
+	}
+
+	region_iteration->surface_area = _new_region_surface_area;
+	region_iteration->bounds = _new_region_bounds;
+
+	performance_data.pm_polygon_count = navmesh_polygons.size();
+}
+
+bool NavRegionBuilder3D::_build_tile(NavRegionIterationBuild3D &r_build, const Vector2i &p_tile_coords, int &r_edge_merge_error_count) {
+	const NavigationMesh::BakeTile &bake_tile = r_build.navmesh_data.bake_tiles.get(p_tile_coords);
+	NavRegionIterationBuild3D::TileBuild &tile_build = r_build.tile_builds[p_tile_coords];
+	tile_build = NavRegionIterationBuild3D::TileBuild();
+	tile_build.mesh_hash = bake_tile.mesh_hash;
+
+	const Transform3D &region_transform = r_build.region_iteration->transform;
+	const Vector<int> *polygons_ptr = r_build.navmesh_data.polygons.ptr() + bake_tile.polygon_begin;
 
-		int polygon_size = polygon_indices.size();
-		if (polygon_size < 3) {
-			continue;
+	tile_build.polygons.resize(bake_tile.polygon_count);
+	tile_build.internal_connections.resize(bake_tile.polygon_count);
+
+	for (uint32_t i = 0; i < tile_build.polygons.size(); i++) {
+		Polygon &polygon = tile_build.polygons[i];
+		polygon.id = i;
+		polygon.owner = nullptr;
+
+		if (!_build_polygon(r_build.navmesh_data.vertices, polygons_ptr[i], region_transform, polygon)) {
+			return false;
 		}
 
-		const int *indices_ptr = polygon_indices.ptr();
+		tile_build.surface_area += polygon.surface_area;
 
-		bool polygon_valid = true;
+		for (const Vector3 &point_position : polygon.vertices) {
+			if (!tile_build.has_bounds) {
+				tile_build.has_bounds = true;
+				tile_build.bounds.position = point_position;
+			} else {
+				tile_build.bounds.expand_to(point_position);
+			}
+		}
+	}
 
-		polygon.vertices.resize(polygon_size);
+	// Pairs the edges inside the tile. Unpaired edges are kept to be paired with the other tiles.
+	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> tile_connection_pairs_map;
+	int edge_count = 0;
+	int free_edges_count = 0;
 
-		{
-			real_t _new_polygon_surface_area = 0.0;
+	for (Polygon &polygon : tile_build.polygons) {
+		for (uint32_t p = 0; p < polygon.vertices.size(); p++) {
+			const int next_point = (p + 1) % polygon.vertices.size();
+			const EdgeKey ek = get_edge_key(polygon.vertices[p], polygon.vertices[next_point], r_build.map_cell_size);
+			_build_add_edge(tile_connection_pairs_map, ek, polygon, p, edge_count, free_edges_count, r_edge_merge_error_count);
+		}
+	}
+
+	for (const KeyValue<EdgeKey, EdgeConnectionPair> &pair_it : tile_connection_pairs_map) {
+		const EdgeConnectionPair &pair = pair_it.value;
+		if (pair.size == 2) {
+			const Connection &c1 = pair.connections[0];
+			const Connection &c2 = pair.connections[1];
+			tile_build.internal_connections[c1.polygon->id].push_back({ c2.polygon->id, c2.edge });
+			tile_build.internal_connections[c2.polygon->id].push_back({ c1.polygon->id, c1.edge });
+			tile_build.edge_merge_count += 1;
+		} else {
+			const Connection &connection = pair.connections[0];
+			tile_build.boundary_edges.push_back({ pair_it.key, { connection.polygon->id, connection.edge } });
+		}
+	}
 
-			for (int j(2); j < polygon_size; j++) {
-				const Face3 face = Face3(
-						region_transform.xform(vertices_ptr[indices_ptr[0]]),
-						region_transform.xform(vertices_ptr[indices_ptr[j - 1]]),
-						region_transform.xform(vertices_ptr[indices_ptr[j]]));
+	return true;
+}
+
+bool NavRegionBuilder3D::_build_step_process_navmesh_tiles(NavRegionIterationBuild3D &r_build) {
+	const HashMap<Vector2i, NavigationMesh::BakeTile> &bake_tiles = r_build.navmesh_data.bake_tiles;
+	HashMap<Vector2i, NavRegionIterationBuild3D::TileBuild> &tile_builds = r_build.tile_builds;
+
+	Ref<NavRegionIteration3D> region_iteration = r_build.region_iteration;
+	const Transform3D &region_transform = region_iteration->transform;
+	const Vector3 &map_cell_size = r_build.map_cell_size;
 
-				_new_polygon_surface_area += face.get_area();
+	if (bake_tiles.is_empty() || region_transform != r_build.tile_builds_transform || map_cell_size != r_build.tile_builds_cell_size) {
+		tile_builds.clear();
+	}
+	if (bake_tiles.is_empty()) {
+		return false;
+	}
+	r_build.tile_builds_transform = region_transform;
+	r_build.tile_builds_cell_size = map_cell_size;
+
+	// The tiles need to cover every polygon exactly once, otherwise the navigation mesh does not come from a tiled bake.
+	const int polygon_count = r_build.navmesh_data.polygons.size();
+	LocalVector<uint8_t> polygon_in_tile;
+	polygon_in_tile.resize_initialized(polygon_count);
+	for (const KeyValue<Vector2i, NavigationMesh::BakeTile> &E : bake_tiles) {
+		const NavigationMesh::BakeTile &bake_tile = E.value;
+		if (bake_tile.polygon_begin < 0 || bake_tile.polygon_count < 0 || bake_tile.polygon_begin + bake_tile.polygon_count > polygon_count) {
+			tile_builds.clear();
+			return false;
+		}
+		for (int i = bake_tile.polygon_begin; i < bake_tile.polygon_begin + bake_tile.polygon_count; i++) {
+			if (polygon_in_tile[i]) {
+				tile_builds.clear();
+				return false;
 			}
+			polygon_in_tile[i] = 1;
+		}
+	}
+	for (uint8_t in_tile : polygon_in_tile) {
+		if (!in_tile) {
+			tile_builds.clear();
+			return false;
+		}
+	}
 
-			polygon.surface_area = _new_polygon_surface_area;
-			_new_region_surface_area += _new_polygon_surface_area;
+	LocalVector<Vector2i> removed_tiles;
+	for (const KeyValue<Vector2i, NavRegionIterationBuild3D::TileBuild> &E : tile_builds) {
+		if (!bake_tiles.has(E.key)) {
+			removed_tiles.push_back(E.key);
 		}
+	}
+	for (const Vector2i &tile_coords : removed_tiles) {
+		tile_builds.erase(tile_coords);
+	}
 
-		for (int j(0); j < polygon_size; j++) {
-			int vertex_index = indices_ptr[j];
-			if (vertex_index < 0 || vertex_index >= vertex_count) {
-				polygon_valid = false;
-				break;
+	PerformanceData &performance_data = r_build.performance_data;
+	LocalVector<Nav3D::Polygon> &navmesh_polygons = region_iteration->navmesh_polygons;
+
+	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
+	connection_pairs_map.clear();
+
+	navmesh_polygons.resize(polygon_count);
+	region_iteration->internal_connections.clear();
+	region_iteration->internal_connections.resize(polygon_count);
+	region_iteration->external_edges.clear();
+
+	real_t _new_region_surface_area = 0.0;
+	AABB _new_region_bounds;
+	bool has_bounds = false;
+
+	int free_edges_count = 0;
+	int edge_merge_error_count = 0;
+
+	for (const KeyValue<Vector2i, NavigationMesh::BakeTile> &E : bake_tiles) {
+		const NavRegionIterationBuild3D::TileBuild *tile_build = tile_builds.getptr(E.key);
+		if (!tile_build || tile_build->mesh_hash != E.value.mesh_hash) {
+			if (!_build_tile(r_build, E.key, edge_merge_error_count)) {
+				tile_builds.clear();
+				ERR_FAIL_V_MSG(true, "Corrupted navigation mesh set on region. The indices of a polygon are out of range.");
 			}
+			tile_build = tile_builds.getptr(E.key);
+		}
 
-			const Vector3 point_position = region_transform.xform(vertices_ptr[vertex_index]);
-			polygon.vertices[j] = point_position;
+		// Stitches the tile into the region polygons.
+		const uint32_t polygon_begin = E.value.polygon_begin;
+		for (uint32_t i = 0; i < tile_build->polygons.size(); i++) {
+			Polygon &polygon = navmesh_polygons[polygon_begin + i];
+			polygon = tile_build->polygons[i];
+			polygon.id = polygon_begin + i;
+			polygon.owner = region_iteration.ptr();
+		}
 
-			if (first_vertex) {
-				first_vertex = false;
-				_new_region_bounds.position = point_position;
-			} else {
-				_new_region_bounds.expand_to(point_position);
+		for (uint32_t i = 0; i < tile_build->internal_connections.size(); i++) {
+			for (const NavRegionIterationBuild3D::TileBuild::TileConnection &tile_connection : tile_build->internal_connections[i]) {
+				Polygon &polygon = navmesh_polygons[polygon_begin + tile_connection.polygon_index];
+
+				Connection connection;
+				connection.polygon = &polygon;
+				connection.edge = tile_connection.edge;
+				connection.pathway_start = polygon.vertices[tile_connection.edge];
+				connection.pathway_end = polygon.vertices[(tile_connection.edge + 1) % polygon.vertices.size()];
+				region_iteration->internal_connections[polygon_begin + i].push_back(connection);
 			}
 		}
 
-		if (!polygon_valid) {
-			polygon.surface_area = 0.0;
-			polygon.vertices.clear();
-			ERR_FAIL_COND_MSG(!polygon_valid, "Corrupted navigation mesh set on region. The indices of a polygon are out of range.");
+		int tile_edge_count = 0;
+		for (const NavRegionIterationBuild3D::TileBuild::TileEdge &tile_edge : tile_build->boundary_edges) {
+			Polygon &polygon = navmesh_polygons[polygon_begin + tile_edge.connection.polygon_index];
+			_build_add_edge(connection_pairs_map, tile_edge.ek, polygon, tile_edge.connection.edge, tile_edge_count, free_edges_count, edge_merge_error_count);
+		}
+
+		performance_data.pm_edge_count += tile_build->edge_merge_count;
+		performance_data.pm_edge_merge_count += tile_build->edge_merge_count;
+
+		_new_region_surface_area += tile_build->surface_area;
+		if (tile_build->has_bounds) {
+			if (!has_bounds) {
+				has_bounds = true;
+				_new_region_bounds = tile_build->bounds;
+			} else {
+				_new_region_bounds.merge_with(tile_build->bounds);
+			}
 		}
 	}
 
+	_build_warn_edge_merge_errors(edge_merge_error_count);
+
 	region_iteration->surface_area = _new_region_surface_area;
 	region_iteration->bounds = _new_region_bounds;
 
 	performance_data.pm_polygon_count = navmesh_polygons.size();
+	performance_data.pm_edge_count += connection_pairs_map.size();
+	performance_data.pm_edge_free_count = free_edges_count;
+
+	return true;
 }
 
 Nav3D::PointKey NavRegionBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size) {
@@ -166,6 +358,42 @@ Nav3D::EdgeKey NavRegionBuilder3D::get_edge_key(const Vector3 &p_vertex1, const
 	return ek;
 }
 
+void NavRegionBuilder3D::_build_add_edge(HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &r_connection_pairs_map, const EdgeKey &p_ek, Polygon &p_polygon, int p_edge, int &r_edge_count, int &r_free_edges_count, int &r_edge_merge_error_count) {
+	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = r_connection_pairs_map.find(p_ek);
+	if (!pair_it) {
+		pair_it = r_connection_pairs_map.insert(p_ek, EdgeConnectionPair());
+		r_edge_count += 1;
+		++r_free_edges_count;
+	}
+	EdgeConnectionPair &pair = pair_it->value;
+	if (pair.size < 2) {
+		// Add the polygon/edge tuple to this key.
+		const int next_point = (p_edge + 1) % p_polygon.vertices.size();
+
+		Connection new_connection;
+		new_connection.polygon = &p_polygon;
+		new_connection.edge = p_edge;
+		new_connection.pathway_start = p_polygon.vertices[p_edge];
+		new_connection.pathway_end = p_polygon.vertices[next_point];
+
+		pair.connections[pair.size] = new_connection;
+		++pair.size;
+		if (pair.size == 2) {
+			--r_free_edges_count;
+		}
+
+	} else {
+		// The edge is already connected with another edge, skip.
+		r_edge_merge_error_count++;
+	}
+}
+
+void NavRegionBuilder3D::_build_warn_edge_merge_errors(int p_edge_merge_error_count) {
+	if (p_edge_merge_error_count > 0 && GLOBAL_GET_CACHED(bool, "navigation/3d/warnings/navmesh_edge_merge_errors")) {
+		WARN_PRINT("Navigation region synchronization had " + itos(p_edge_merge_error_count) + " edge error(s).\nMore than 2 edges tried to occupy the same map rasterization space.\nThis causes a logical error in the navigation mesh geometry and is commonly caused by overlap or too densely placed edges.\nConsider baking with a higher 'cell_size', greater geometry margin, and less detailed bake objects to cause fewer edges.\nConsider lowering the 'navigation/3d/merge_rasterizer_cell_scale' in the project settings.\nThis warning can be toggled under 'navigation/3d/warnings/navmesh_edge_merge_errors' in the project settings.");
+	}
+}
+
 void NavRegionBuilder3D::_build_step_find_edge_connection_pairs(NavRegionIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
 
@@ -181,6 +409,7 @@ void NavRegionBuilder3D::_build_step_find_edge_connection_pairs(NavRegionIterati
 
 	region_iteration->external_edges.clear();
 
+	int edge_count = 0;
 	int free_edges_count = 0;
 	int edge_merge_error_count = 0;
 
@@ -188,39 +417,13 @@ void NavRegionBuilder3D::_build_step_find_edge_connection_pairs(NavRegionIterati
 		for (uint32_t p = 0; p < poly.vertices.size(); p++) {
 			const int next_point = (p + 1) % poly.vertices.size();
 			const EdgeKey ek = get_edge_key(poly.vertices[p], poly.vertices[next_point], map_cell_size);
-
-			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
-			if (!pair_it) {
-				pair_it = connection_pairs_map.insert(ek, EdgeConnectionPair());
-				performance_data.pm_edge_count += 1;
-				++free_edges_count;
-			}
-			EdgeConnectionPair &pair = pair_it->value;
-			if (pair.size < 2) {
-				// Add the polygon/edge tuple to this key.
-				Connection new_connection;
-				new_connection.polygon = &poly;
-				new_connection.edge = p;
-				new_connection.pathway_start = poly.vertices[p];
-				new_connection.pathway_end = poly.vertices[next_point];
-
-				pair.connections[pair.size] = new_connection;
-				++pair.size;
-				if (pair.size == 2) {
-					--free_edges_count;
-				}
-
-			} else {
-				// The edge is already connected with another edge, skip.
-				edge_merge_error_count++;
-			}
+			_build_add_edge(connection_pairs_map, ek, poly, p, edge_count, free_edges_count, edge_merge_error_count);
 		}
 	}
 
-	if (edge_merge_error_count > 0 && GLOBAL_GET_CACHED(bool, "navigation/3d/warnings/navmesh_edge_merge_errors")) {
-		WARN_PRINT("Navigation region synchronization had " + itos(edge_merge_error_count) + " edge error(s).\nMore than 2 edges tried to occupy the same map rasterization space.\nThis causes a logical error in the navigation mesh geometry and is commonly caused by overlap or too densely placed edges.\nConsider baking with a higher 'cell_size', greater geometry margin, and less detailed bake objects to cause fewer edges.\nConsider lowering the 'navigation/3d/merge_rasterizer_cell_scale' in the project settings.\nThis warning can be toggled under 'navigation/3d/warnings/navmesh_edge_merge_errors' in the project settings.");
-	}
+	_build_warn_edge_merge_errors(edge_merge_error_count);
 
+	performance_data.pm_edge_count += edge_count;
 	performance_data.pm_edge_free_count = free_edges_count;
 }
 
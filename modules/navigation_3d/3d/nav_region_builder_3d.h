@@ -35,7 +35,13 @@
 struct NavRegionIterationBuild3D;
 
 class NavRegionBuilder3D {
+	static bool _build_polygon(const Vector<Vector3> &p_vertices, const Vector<int> &p_indices, const Transform3D &p_transform, Nav3D::Polygon &r_polygon);
+	static void _build_add_edge(HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> &r_connection_pairs_map, const Nav3D::EdgeKey &p_ek, Nav3D::Polygon &p_polygon, int p_edge, int &r_edge_count, int &r_free_edges_count, int &r_edge_merge_error_count);
+	static void _build_warn_edge_merge_errors(int p_edge_merge_error_count);
+	static bool _build_tile(NavRegionIterationBuild3D &r_build, const Vector2i &p_tile_coords, int &r_edge_merge_error_count);
+
 	static void _build_step_process_navmesh_data(NavRegionIterationBuild3D &r_build);
+	static bool _build_step_process_navmesh_tiles(NavRegionIterationBuild3D &r_build);
 	static void _build_step_find_edge_connection_pairs(NavRegionIterationBuild3D &r_build);
 	static void _build_step_merge_edge_connection_pairs(NavRegionIterationBuild3D &r_build);
 	static void _build_update_iteration(NavRegionIterationBuild3D &r_build);
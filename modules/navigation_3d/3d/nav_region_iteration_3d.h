@@ -50,10 +50,12 @@ struct NavRegionIterationBuild3D {
 	struct NavMeshData {
 		Vector<Vector3> vertices;
 		Vector<Vector<int>> polygons;
+		HashMap<Vector2i, NavigationMesh::BakeTile> bake_tiles;
 
 		void clear() {
 			vertices.clear();
 			polygons.clear();
+			bake_tiles.clear();
 		}
 	} navmesh_data;
 
@@ -61,6 +63,33 @@ struct NavRegionIterationBuild3D {
 
 	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
 
+	// Build of one tile of a tiled navigation mesh. Polygon indices are local to the tile.
+	struct TileBuild {
+		struct TileConnection {
+			uint32_t polygon_index = 0;
+			int edge = -1;
+		};
+
+		struct TileEdge {
+			Nav3D::EdgeKey ek;
+			TileConnection connection;
+		};
+
+		uint64_t mesh_hash = 0;
+		LocalVector<Nav3D::Polygon> polygons;
+		LocalVector<LocalVector<TileConnection>> internal_connections;
+		LocalVector<TileEdge> boundary_edges;
+		real_t surface_area = 0.0;
+		AABB bounds;
+		bool has_bounds = false;
+		int edge_merge_count = 0;
+	};
+
+	// Kept between builds (not cleared by reset()) so that only the changed tiles are processed again.
+	HashMap<Vector2i, TileBuild> tile_builds;
+	Transform3D tile_builds_transform;
+	Vector3 tile_builds_cell_size;
+
 	void reset() {
 		performance_data.reset();
 
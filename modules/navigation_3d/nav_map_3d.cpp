@@ -126,6 +126,33 @@ void NavMap3D::set_link_connection_radius(real_t p_link_connection_radius) {
 	iteration_dirty = true;
 }
 
+void NavMap3D::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	iteration_dirty = true;
+}
+
+void NavMap3D::set_hierarchical_cluster_size(real_t p_cluster_size) {
+	ERR_FAIL_COND_MSG(p_cluster_size <= 0.0, "Hierarchical cluster size must be greater than zero.");
+	if (hierarchical_cluster_size == p_cluster_size) {
+		return;
+	}
+	hierarchical_cluster_size = p_cluster_size;
+	if (use_hierarchical_pathfinding) {
+		iteration_dirty = true;
+	}
+}
+
+void NavMap3D::set_use_path_cache(bool p_enabled) {
+	if (use_path_cache == p_enabled) {
+		return;
+	}
+	use_path_cache = p_enabled;
+	iteration_dirty = true;
+}
+
 const Vector3 &NavMap3D::get_merge_rasterizer_cell_size() const {
 	return merge_rasterizer_cell_size;
 }
@@ -150,34 +177,64 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 
 	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	p_query_task.path_query_slot = acquire_path_query_slot(map_iteration);
+	ERR_FAIL_NULL(p_query_task.path_query_slot);
+
+	p_query_task.map_up = map_iteration.map_up;
+
+	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+
+	release_path_query_slot(map_iteration, p_query_task.path_query_slot);
+	p_query_task.path_query_slot = nullptr;
+}
+
+NavMapIteration3D *NavMap3D::acquire_iteration() {
+	if (iteration_id == 0) {
+		return nullptr;
+	}
+
+	iteration_slot_rwlock.read_lock();
+	NavMapIteration3D *map_iteration = &iteration_slots[iteration_slot_index];
+	map_iteration->users.increment();
+	iteration_slot_rwlock.read_unlock();
+
+	return map_iteration;
+}
+
+void NavMap3D::release_iteration(NavMapIteration3D *p_map_iteration) {
+	ERR_FAIL_NULL(p_map_iteration);
+	p_map_iteration->users.decrement();
+}
+
+NavMeshQueries3D::PathQuerySlot *NavMap3D::acquire_path_query_slot(NavMapIteration3D &p_map_iteration) {
+	p_map_iteration.path_query_slots_semaphore.wait();
+
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+			path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	p_map_iteration.path_query_slots_mutex.unlock();
 
-	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+	if (path_query_slot == nullptr) {
+		p_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_V_MSG(nullptr, "No unused NavMap3D path query slot found! This should never happen :(.");
 	}
 
-	p_query_task.map_up = map_iteration.map_up;
-
-	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	return path_query_slot;
+}
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
-	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+void NavMap3D::release_path_query_slot(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	p_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	p_map_iteration.path_query_slots_mutex.unlock();
 
-	map_iteration.path_query_slots_semaphore.post();
+	p_map_iteration.path_query_slots_semaphore.post();
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -286,13 +343,13 @@ void NavMap3D::add_obstacle(NavObstacle3D *obstacle) {
 
 	if (!has_obstacle(obstacle)) {
 		obstacles.push_back(obstacle);
-		obstacles_dirty = true;
+		_set_rvo_obstacle_changed(obstacle);
 	}
 }
 
 void NavMap3D::remove_obstacle(NavObstacle3D *obstacle) {
 	if (obstacles.erase_unordered(obstacle)) {
-		obstacles_dirty = true;
+		_set_rvo_obstacle_changed(obstacle);
 	}
 }
 
@@ -368,6 +425,7 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.path_cluster_size = use_hierarchical_pathfinding ? hierarchical_cluster_size : 0.0;
 
 	next_map_iteration.clear();
 
@@ -388,6 +446,7 @@ void NavMap3D::_build_iteration() {
 	}
 
 	next_map_iteration.map_up = get_up();
+	next_map_iteration.use_path_cache = use_path_cache;
 
 	iteration_build.map_iteration = &next_map_iteration;
 
@@ -433,6 +492,24 @@ void NavMap3D::sync() {
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
 
+	// Path query counters since the last sync, from both iteration slots since queries may still run on the old one.
+	performance_data.pm_path_cache_hit_count = 0;
+	performance_data.pm_path_cache_miss_count = 0;
+	performance_data.pm_path_search_polygon_count = 0;
+	for (NavMapIteration3D &iteration_slot : iteration_slots) {
+		const uint32_t hit_count = iteration_slot.path_cache_hit_count.get();
+		iteration_slot.path_cache_hit_count.sub(hit_count);
+		performance_data.pm_path_cache_hit_count += hit_count;
+
+		const uint32_t miss_count = iteration_slot.path_cache_miss_count.get();
+		iteration_slot.path_cache_miss_count.sub(miss_count);
+		performance_data.pm_path_cache_miss_count += miss_count;
+
+		const uint32_t search_polygon_count = iteration_slot.path_search_polygon_count.get();
+		iteration_slot.path_search_polygon_count.sub(search_polygon_count);
+		performance_data.pm_path_search_polygon_count += search_polygon_count;
+	}
+
 	_sync_async_tasks();
 
 	_sync_dirty_map_update_requests();
@@ -473,32 +550,56 @@ void NavMap3D::sync() {
 void NavMap3D::_sync_avoidance() {
 	_sync_dirty_avoidance_update_requests();
 
-	if (obstacles_dirty || agents_dirty) {
+	if (static_obstacles_dirty || dynamic_obstacles_dirty || agents_dirty || agents_moved) {
 		_update_rvo_simulation();
 	}
 
-	obstacles_dirty = false;
+	static_obstacles_dirty = false;
+	dynamic_obstacles_dirty = false;
 	agents_dirty = false;
+	agents_moved = false;
 }
 
-void NavMap3D::_update_rvo_obstacles_tree_2d() {
-	int obstacle_vertex_count = 0;
-	for (NavObstacle3D *obstacle : obstacles) {
-		obstacle_vertex_count += obstacle->get_vertices().size();
+void NavMap3D::_set_rvo_obstacle_changed(NavObstacle3D *p_obstacle) {
+	// Changed obstacles leave the tree they were built into and start over in the dynamic tree.
+	if (p_obstacle->is_avoidance_in_tree()) {
+		if (p_obstacle->get_avoidance_unchanged_sync_count() >= NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT) {
+			static_obstacles_dirty = true;
+		} else {
+			dynamic_obstacles_dirty = true;
+		}
+		p_obstacle->set_avoidance_in_tree(false);
+	}
+	p_obstacle->set_avoidance_unchanged_sync_count(0);
+
+	if (p_obstacle->is_avoidance_enabled() && p_obstacle->get_vertices().size() >= 2) {
+		dynamic_obstacles_dirty = true;
 	}
+}
 
-	// Cleaning old obstacles.
-	for (size_t i = 0; i < rvo_simulation_2d.obstacles_.size(); ++i) {
-		delete rvo_simulation_2d.obstacles_[i];
+void NavMap3D::_update_rvo_obstacles_tree_2d() {
+	RVO2D::KdTree2D *kd_tree = rvo_simulation_2d.kdTree_;
+
+	// Obstacles are kept in two trees so moving obstacles only rebuild the small dynamic one.
+	// Old obstacles are released to the tree for reuse instead of being deleted.
+	if (static_obstacles_dirty) {
+		kd_tree->releaseObstacles(rvo_simulation_2d.obstacles_);
+		_build_rvo_obstacles_2d(true, rvo_simulation_2d.obstacles_);
+		kd_tree->buildObstacleTree(rvo_simulation_2d.obstacles_);
 	}
-	rvo_simulation_2d.obstacles_.clear();
 
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree
-	std::vector<RVO2D::Obstacle2D *> &raw_obstacles = rvo_simulation_2d.obstacles_;
-	raw_obstacles.reserve(obstacle_vertex_count);
+	if (dynamic_obstacles_dirty) {
+		kd_tree->releaseObstacles(kd_tree->dynamicObstacles_);
+		_build_rvo_obstacles_2d(false, kd_tree->dynamicObstacles_);
+		kd_tree->buildDynamicObstacleTree();
+	}
+}
 
+void NavMap3D::_build_rvo_obstacles_2d(bool p_static, std::vector<RVO2D::Obstacle2D *> &r_obstacles) {
 	// The following block is modified copy from RVO2D::AddObstacle()
 	// Obstacles are linked and depend on all other obstacles.
+	std::vector<RVO2D::Vector2> rvo_2d_vertices;
+
 	for (NavObstacle3D *obstacle : obstacles) {
 		if (!obstacle->is_avoidance_enabled()) {
 			continue;
@@ -510,8 +611,13 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 			continue;
 		}
 
-		std::vector<RVO2D::Vector2> rvo_2d_vertices;
-		rvo_2d_vertices.reserve(_obstacle_vertices.size());
+		bool is_static = obstacle->get_avoidance_unchanged_sync_count() >= NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT;
+		if (is_static != p_static) {
+			continue;
+		}
+		obstacle->set_avoidance_in_tree(true);
+
+		rvo_2d_vertices.clear();
 
 		uint32_t _obstacle_avoidance_layers = obstacle->get_avoidance_layers();
 		real_t _obstacle_height = obstacle->get_height();
@@ -525,10 +631,10 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 			rvo_2d_vertices.push_back(RVO2D::Vector2(_obstacle_vertex.x + _obstacle_position.x, _obstacle_vertex.z + _obstacle_position.z));
 		}
 
-		const size_t obstacleNo = raw_obstacles.size();
+		const size_t obstacleNo = r_obstacles.size();
 
 		for (size_t i = 0; i < rvo_2d_vertices.size(); i++) {
-			RVO2D::Obstacle2D *rvo_2d_obstacle = new RVO2D::Obstacle2D();
+			RVO2D::Obstacle2D *rvo_2d_obstacle = rvo_simulation_2d.kdTree_->allocateObstacle();
 			rvo_2d_obstacle->point_ = rvo_2d_vertices[i];
 			rvo_2d_obstacle->height_ = _obstacle_height;
 			rvo_2d_obstacle->elevation_ = _obstacle_position.y;
@@ -536,12 +642,12 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 			rvo_2d_obstacle->avoidance_layers_ = _obstacle_avoidance_layers;
 
 			if (i != 0) {
-				rvo_2d_obstacle->prevObstacle_ = raw_obstacles.back();
+				rvo_2d_obstacle->prevObstacle_ = r_obstacles.back();
 				rvo_2d_obstacle->prevObstacle_->nextObstacle_ = rvo_2d_obstacle;
 			}
 
 			if (i == rvo_2d_vertices.size() - 1) {
-				rvo_2d_obstacle->nextObstacle_ = raw_obstacles[obstacleNo];
+				rvo_2d_obstacle->nextObstacle_ = r_obstacles[obstacleNo];
 				rvo_2d_obstacle->nextObstacle_->prevObstacle_ = rvo_2d_obstacle;
 			}
 
@@ -553,13 +659,11 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 				rvo_2d_obstacle->isConvex_ = (leftOf(rvo_2d_vertices[(i == 0 ? rvo_2d_vertices.size() - 1 : i - 1)], rvo_2d_vertices[i], rvo_2d_vertices[(i == rvo_2d_vertices.size() - 1 ? 0 : i + 1)]) >= 0.0f);
 			}
 
-			rvo_2d_obstacle->id_ = raw_obstacles.size();
+			rvo_2d_obstacle->id_ = r_obstacles.size();
 
-			raw_obstacles.push_back(rvo_2d_obstacle);
+			r_obstacles.push_back(rvo_2d_obstacle);
 		}
 	}
-
-	rvo_simulation_2d.kdTree_->buildObstacleTree(raw_obstacles);
 }
 
 void NavMap3D::_update_rvo_agents_tree_2d() {
@@ -583,12 +687,18 @@ void NavMap3D::_update_rvo_agents_tree_3d() {
 }
 
 void NavMap3D::_update_rvo_simulation() {
-	if (obstacles_dirty) {
+	if (static_obstacles_dirty || dynamic_obstacles_dirty) {
 		_update_rvo_obstacles_tree_2d();
 	}
-	if (agents_dirty) {
+	if (agents_dirty || agents_tree_refit_count >= NavigationDefaults3D::AVOIDANCE_AGENT_TREE_MAX_REFITS) {
 		_update_rvo_agents_tree_2d();
 		_update_rvo_agents_tree_3d();
+		agents_tree_refit_count = 0;
+	} else if (agents_moved) {
+		// Same agents at new positions, update the tree bounds without repartitioning.
+		rvo_simulation_2d.kdTree_->refitAgentTree();
+		rvo_simulation_3d.kdTree_->refitAgentTree();
+		agents_tree_refit_count++;
 	}
 }
 
@@ -797,22 +907,31 @@ void NavMap3D::_sync_dirty_map_update_requests() {
 
 void NavMap3D::_sync_dirty_avoidance_update_requests() {
 	// Sync NavAgents.
-	if (!agents_dirty) {
-		agents_dirty = sync_dirty_requests.agents.list.first();
-	}
+	agents_moved = sync_dirty_requests.agents.list.first() != nullptr;
 	for (SelfList<NavAgent3D> *element = sync_dirty_requests.agents.list.first(); element; element = element->next()) {
 		element->self()->sync();
 	}
 	sync_dirty_requests.agents.list.clear();
 
 	// Sync NavObstacles.
-	if (!obstacles_dirty) {
-		obstacles_dirty = sync_dirty_requests.obstacles.list.first();
-	}
 	for (SelfList<NavObstacle3D> *element = sync_dirty_requests.obstacles.list.first(); element; element = element->next()) {
 		element->self()->sync();
+		_set_rvo_obstacle_changed(element->self());
 	}
 	sync_dirty_requests.obstacles.list.clear();
+
+	// Obstacles that stopped changing move to the static obstacle tree.
+	for (NavObstacle3D *obstacle : obstacles) {
+		uint32_t unchanged_sync_count = obstacle->get_avoidance_unchanged_sync_count();
+		if (unchanged_sync_count >= NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT) {
+			continue;
+		}
+		obstacle->set_avoidance_unchanged_sync_count(++unchanged_sync_count);
+		if (unchanged_sync_count == NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT && obstacle->is_avoidance_in_tree()) {
+			static_obstacles_dirty = true;
+			dynamic_obstacles_dirty = true;
+		}
+	}
 }
 
 void NavMap3D::add_region_async_thread_join_request(SelfList<NavRegion3D> *p_async_request) {
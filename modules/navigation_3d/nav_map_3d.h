@@ -71,6 +71,13 @@ class NavMap3D : public NavRid3D {
 	/// This value is used to limit how far links search to find polygons to connect to.
 	real_t link_connection_radius = NavigationDefaults3D::LINK_CONNECTION_RADIUS;
 
+	/// Builds a cluster graph with each iteration so long path queries search it first.
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchical_cluster_size = NavigationDefaults3D::HIERARCHICAL_CLUSTER_SIZE;
+
+	/// Reuses path corridors between the same polygons until the next iteration.
+	bool use_path_cache = false;
+
 	bool map_settings_dirty = true;
 
 	/// Map regions
@@ -90,14 +97,19 @@ class NavMap3D : public NavRid3D {
 	/// dirty flag when one of the agent's arrays are modified
 	bool agents_dirty = true;
 
+	/// Agents changed without changing the arrays, the agent trees only need a refit.
+	bool agents_moved = false;
+	uint32_t agents_tree_refit_count = 0;
+
 	/// All the Agents (even the controlled one)
 	LocalVector<NavAgent3D *> agents;
 
 	/// All the avoidance obstacles (both static and dynamic)
 	LocalVector<NavObstacle3D *> obstacles;
 
-	/// Are rvo obstacles modified?
-	bool obstacles_dirty = true;
+	/// Are rvo obstacles of the static or dynamic obstacle tree modified?
+	bool static_obstacles_dirty = true;
+	bool dynamic_obstacles_dirty = true;
 
 	/// Change the id each time the map is updated.
 	uint32_t iteration_id = 0;
@@ -193,11 +205,33 @@ public:
 		return link_connection_radius;
 	}
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const {
+		return use_hierarchical_pathfinding;
+	}
+
+	void set_hierarchical_cluster_size(real_t p_cluster_size);
+	real_t get_hierarchical_cluster_size() const {
+		return hierarchical_cluster_size;
+	}
+
+	void set_use_path_cache(bool p_enabled);
+	bool get_use_path_cache() const {
+		return use_path_cache;
+	}
+
 	Nav3D::PointKey get_point_key(const Vector3 &p_pos) const;
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
 
+	// Keeps the current iteration from being rebuilt until it is released.
+	NavMapIteration3D *acquire_iteration();
+	void release_iteration(NavMapIteration3D *p_map_iteration);
+
+	static NavMeshQueries3D::PathQuerySlot *acquire_path_query_slot(NavMapIteration3D &p_map_iteration);
+	static void release_path_query_slot(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot);
+
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
 	Vector3 get_closest_point_normal(const Vector3 &p_point) const;
@@ -249,6 +283,9 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	int get_pm_path_cache_hit_count() const { return performance_data.pm_path_cache_hit_count; }
+	int get_pm_path_cache_miss_count() const { return performance_data.pm_path_cache_miss_count; }
+	int get_pm_path_search_polygon_count() const { return performance_data.pm_path_search_polygon_count; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -283,6 +320,8 @@ private:
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
+	void _build_rvo_obstacles_2d(bool p_static, std::vector<RVO2D::Obstacle2D *> &r_obstacles);
+	void _set_rvo_obstacle_changed(NavObstacle3D *p_obstacle);
 	void _update_rvo_agents_tree_2d();
 	void _update_rvo_agents_tree_3d();
 
@@ -57,6 +57,10 @@ class NavObstacle3D : public NavRid3D {
 	uint32_t last_map_iteration_id = 0;
 	bool paused = false;
 
+	// Bookkeeping of the map for its static and dynamic avoidance obstacle trees.
+	uint32_t avoidance_unchanged_sync_count = 0;
+	bool avoidance_in_tree = false;
+
 	SelfList<NavObstacle3D> sync_dirty_request_list_element;
 
 public:
@@ -98,6 +102,12 @@ public:
 	void set_paused(bool p_paused);
 	bool get_paused() const;
 
+	void set_avoidance_unchanged_sync_count(uint32_t p_count) { avoidance_unchanged_sync_count = p_count; }
+	uint32_t get_avoidance_unchanged_sync_count() const { return avoidance_unchanged_sync_count; }
+
+	void set_avoidance_in_tree(bool p_in_tree) { avoidance_in_tree = p_in_tree; }
+	bool is_avoidance_in_tree() const { return avoidance_in_tree; }
+
 	bool is_dirty() const;
 	void sync();
 	void request_sync();
@@ -35,6 +35,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hashfuncs.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/rid.h"
 #include "servers/navigation_3d/navigation_constants_3d.h"
 
 class NavBaseIteration3D;
@@ -119,6 +120,9 @@ struct NavigationPoly {
 	Vector3 back_navigation_edge_pathway_start;
 	Vector3 back_navigation_edge_pathway_end;
 
+	/// Cluster of this poly in the map's cluster graph, if the map builds one.
+	uint32_t path_cluster = UINT32_MAX;
+
 	/// The entry position of this poly.
 	Vector3 entry;
 	/// The distance traveled until now (g cost).
@@ -171,6 +175,120 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct PathClusterPortal {
+	/// Cluster on the other side of the portal.
+	uint32_t cluster = UINT32_MAX;
+
+	/// Average point of the polygon connections crossing into the other cluster.
+	Vector3 position;
+
+	/// Navigation layers that can cross at least one of the polygon connections.
+	uint32_t navigation_layers = 0;
+
+	uint32_t connection_count = 0;
+};
+
+/// A spatial group of polygons in the abstract graph used to narrow down long path searches.
+struct PathCluster {
+	Vector3 position;
+	uint32_t polygon_count = 0;
+	LocalVector<PathClusterPortal> portals;
+};
+
+struct NavigationPathCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	uint32_t back_cluster = UINT32_MAX;
+	Vector3 entry;
+	real_t traveled_distance = FLT_MAX;
+	real_t distance_to_destination = 0.0;
+
+	/// True if the polygon search may enter this cluster.
+	bool in_corridor = false;
+
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_cluster = UINT32_MAX;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_corridor = false;
+	}
+};
+
+struct NavPathClusterTravelCostGreaterThan {
+	bool operator()(const NavigationPathCluster *p_cluster_a, const NavigationPathCluster *p_cluster_b) const {
+		return p_cluster_a->total_travel_cost() > p_cluster_b->total_travel_cost();
+	}
+};
+
+struct NavPathClusterHeapIndexer {
+	void operator()(NavigationPathCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
+/// Everything besides the positions that decides which polygon corridor a path search finds.
+struct PathCacheKey {
+	const Polygon *begin_polygon = nullptr;
+	const Polygon *end_polygon = nullptr;
+	uint32_t navigation_layers = 0;
+	int path_search_max_polygons = 0;
+	LocalVector<RID> excluded_regions;
+	LocalVector<RID> included_regions;
+	// Computed once by `update_hash()` after the fields are set, so lookups don't walk the region lists again.
+	uint32_t key_hash = 0;
+
+	void update_hash() {
+		uint32_t h = hash_murmur3_one_64((uint64_t)begin_polygon);
+		h = hash_murmur3_one_64((uint64_t)end_polygon, h);
+		h = hash_murmur3_one_32(navigation_layers, h);
+		h = hash_murmur3_one_32(path_search_max_polygons, h);
+		h = hash_murmur3_one_32(excluded_regions.size(), h);
+		for (const RID &region : excluded_regions) {
+			h = hash_murmur3_one_64(region.get_id(), h);
+		}
+		h = hash_murmur3_one_32(included_regions.size(), h);
+		for (const RID &region : included_regions) {
+			h = hash_murmur3_one_64(region.get_id(), h);
+		}
+		key_hash = hash_fmix32(h);
+	}
+
+	static uint32_t hash(const PathCacheKey &p_key) {
+		return p_key.key_hash;
+	}
+
+	static bool regions_equal(const LocalVector<RID> &p_regions_a, const LocalVector<RID> &p_regions_b) {
+		if (p_regions_a.size() != p_regions_b.size()) {
+			return false;
+		}
+		for (uint32_t i = 0; i < p_regions_a.size(); i++) {
+			if (p_regions_a[i] != p_regions_b[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool operator==(const PathCacheKey &p_key) const {
+		return key_hash == p_key.key_hash && begin_polygon == p_key.begin_polygon && end_polygon == p_key.end_polygon && navigation_layers == p_key.navigation_layers && path_search_max_polygons == p_key.path_search_max_polygons && regions_equal(excluded_regions, p_key.excluded_regions) && regions_equal(included_regions, p_key.included_regions);
+	}
+};
+
+/// One polygon of a cached path corridor, listed from the begin polygon to the end polygon.
+struct PathCorridorPoly {
+	const Polygon *poly = nullptr;
+	uint32_t poly_id = 0;
+	int back_navigation_edge = -1;
+	Vector3 back_navigation_edge_pathway_start;
+	Vector3 back_navigation_edge_pathway_end;
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -192,6 +310,9 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
+	int pm_path_search_polygon_count = 0;
 
 	void reset() {
 		pm_region_count = 0;
@@ -203,6 +324,9 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_path_cache_hit_count = 0;
+		pm_path_cache_miss_count = 0;
+		pm_path_search_polygon_count = 0;
 	}
 };
 
@@ -1137,7 +1137,11 @@ void CPUParticles2D::_particles_process(double p_delta) {
 	}
 	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
 		active = false;
-		emit_signal(SceneStringName(finished));
+		if (defer_finished_signal) {
+			finished_signal_pending = true;
+		} else {
+			emit_signal(SceneStringName(finished));
+		}
 	}
 }
 
@@ -1239,6 +1243,36 @@ void CPUParticles2D::_update_render_thread() {
 	RS::get_singleton()->multimesh_set_buffer(multimesh, particle_data);
 }
 
+void CPUParticles2D::process_batch(Node *const *p_nodes, uint32_t p_count, int p_notification) {
+	if (p_notification != NOTIFICATION_INTERNAL_PROCESS) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_nodes[i]->notification(p_notification);
+		}
+		return;
+	}
+
+	// Skip the notification dispatch through the whole class hierarchy, only this class handles it.
+	// Handlers of `finished` may free or remove other nodes of the batch, so the signal waits until all are updated.
+	LocalVector<ObjectID> finished_nodes;
+	for (uint32_t i = 0; i < p_count; i++) {
+		CPUParticles2D *particles = static_cast<CPUParticles2D *>(p_nodes[i]);
+		particles->defer_finished_signal = true;
+		particles->_update_internal();
+		particles->defer_finished_signal = false;
+		if (particles->finished_signal_pending) {
+			particles->finished_signal_pending = false;
+			finished_nodes.push_back(particles->get_instance_id());
+		}
+	}
+
+	for (const ObjectID &id : finished_nodes) {
+		CPUParticles2D *particles = ObjectDB::get_instance<CPUParticles2D>(id);
+		if (particles) {
+			particles->emit_signal(SceneStringName(finished));
+		}
+	}
+}
+
 void CPUParticles2D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
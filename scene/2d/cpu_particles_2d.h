@@ -82,6 +82,8 @@ public:
 private:
 	bool emitting = false;
 	bool active = false;
+	bool defer_finished_signal = false; // Set while updated by process_batch().
+	bool finished_signal_pending = false;
 
 	struct Particle {
 		Transform2D transform;
@@ -221,6 +223,8 @@ protected:
 #endif
 
 public:
+	static void process_batch(Node *const *p_nodes, uint32_t p_count, int p_notification);
+
 	void set_emitting(bool p_emitting);
 	void set_amount(int p_amount);
 	void set_lifetime(double p_lifetime);
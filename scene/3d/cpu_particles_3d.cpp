@@ -1207,7 +1207,11 @@ void CPUParticles3D::_particles_process(double p_delta) {
 	}
 	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
 		active = false;
-		emit_signal(SceneStringName(finished));
+		if (defer_finished_signal) {
+			finished_signal_pending = true;
+		} else {
+			emit_signal(SceneStringName(finished));
+		}
 	}
 }
 
@@ -1332,6 +1336,36 @@ void CPUParticles3D::_update_render_thread() {
 	}
 }
 
+void CPUParticles3D::process_batch(Node *const *p_nodes, uint32_t p_count, int p_notification) {
+	if (p_notification != NOTIFICATION_INTERNAL_PROCESS) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_nodes[i]->notification(p_notification);
+		}
+		return;
+	}
+
+	// Skip the notification dispatch through the whole class hierarchy, only this class handles it.
+	// Handlers of `finished` may free or remove other nodes of the batch, so the signal waits until all are updated.
+	LocalVector<ObjectID> finished_nodes;
+	for (uint32_t i = 0; i < p_count; i++) {
+		CPUParticles3D *particles = static_cast<CPUParticles3D *>(p_nodes[i]);
+		particles->defer_finished_signal = true;
+		particles->_update_internal();
+		particles->defer_finished_signal = false;
+		if (particles->finished_signal_pending) {
+			particles->finished_signal_pending = false;
+			finished_nodes.push_back(particles->get_instance_id());
+		}
+	}
+
+	for (const ObjectID &id : finished_nodes) {
+		CPUParticles3D *particles = ObjectDB::get_instance<CPUParticles3D>(id);
+		if (particles) {
+			particles->emit_signal(SceneStringName(finished));
+		}
+	}
+}
+
 void CPUParticles3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -84,6 +84,8 @@ public:
 private:
 	bool emitting = false;
 	bool active = false;
+	bool defer_finished_signal = false; // Set while updated by process_batch().
+	bool finished_signal_pending = false;
 
 	struct Particle {
 		Transform3D transform;
@@ -215,6 +217,8 @@ protected:
 #endif
 
 public:
+	static void process_batch(Node *const *p_nodes, uint32_t p_count, int p_notification);
+
 	AABB get_aabb() const override;
 
 	void set_emitting(bool p_emitting);
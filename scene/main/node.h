@@ -230,6 +230,7 @@ private:
 		int process_thread_group_order = 0;
 		BitField<ProcessThreadMessages> process_thread_messages = {};
 		void *process_group = nullptr; // to avoid cyclic dependency
+		SceneTree::ProcessBatchFunc process_batch_func = nullptr; // Cached by SceneTree when the node starts processing.
 
 		int multiplayer_authority = 1; // Server by default.
 		Variant rpc_config;
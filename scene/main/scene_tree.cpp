@@ -43,6 +43,7 @@
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
 #include "scene/main/multiplayer_api.h"
+#include "scene/main/timer.h"
 #include "scene/main/viewport.h"
 #include "scene/main/window.h"
 #include "scene/resources/environment.h"
@@ -76,14 +77,23 @@ void SceneTreeTimer::_bind_methods() {
 
 void SceneTreeTimer::set_time_left(double p_time) {
 	time_left = p_time;
+	ERR_FAIL_NULL(SceneTree::get_singleton());
+	SceneTree::get_singleton()->_reschedule_timer(this, p_time);
 }
 
 double SceneTreeTimer::get_time_left() const {
-	return MAX(time_left, 0.0);
+	ERR_FAIL_NULL_V(SceneTree::get_singleton(), MAX(time_left, 0.0));
+	return SceneTree::get_singleton()->_get_timer_time_left(this);
+}
+
+void SceneTreeTimer::_update_clock() {
+	ERR_FAIL_NULL(SceneTree::get_singleton());
+	SceneTree::get_singleton()->_move_timer_to_clock(this);
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
 	process_always = p_process_always;
+	_update_clock();
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -92,6 +102,7 @@ bool SceneTreeTimer::is_process_always() {
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
 	process_in_physics = p_process_in_physics;
+	_update_clock();
 }
 
 bool SceneTreeTimer::is_process_in_physics() {
@@ -100,6 +111,7 @@ bool SceneTreeTimer::is_process_in_physics() {
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
 	ignore_time_scale = p_ignore;
+	_update_clock();
 }
 
 bool SceneTreeTimer::is_ignoring_time_scale() {
@@ -779,35 +791,143 @@ bool SceneTree::process(double p_time) {
 	return _quit;
 }
 
+void SceneTree::_schedule_timer(SceneTreeTimer *p_timer) {
+	_THREAD_SAFE_METHOD_
+	TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (entry.wheel) {
+		entry.wheel->cancel(&entry);
+	} else {
+		// Keep the timer alive until it times out, even if nothing else references it.
+		p_timer->reference();
+	}
+
+	uint32_t clock = 0;
+	if (p_timer->is_process_in_physics()) {
+		clock |= TIMER_CLOCK_PHYSICS;
+	}
+	if (p_timer->is_ignoring_time_scale()) {
+		clock |= TIMER_CLOCK_IGNORE_TIME_SCALE;
+	}
+	if (!p_timer->is_process_always()) {
+		clock |= TIMER_CLOCK_PAUSABLE;
+	}
+	TimerWheel &wheel = timer_wheels[clock];
+	wheel.schedule(&entry, wheel.get_time() + p_timer->time_left);
+}
+
+void SceneTree::_reschedule_timer(SceneTreeTimer *p_timer, double p_time_left) {
+	_THREAD_SAFE_METHOD_
+	p_timer->time_left = p_time_left;
+	if (p_timer->wheel_entry.wheel) {
+		_schedule_timer(p_timer);
+	}
+}
+
+void SceneTree::_move_timer_to_clock(SceneTreeTimer *p_timer) {
+	_THREAD_SAFE_METHOD_
+	TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (entry.wheel) {
+		// Carry the time left over to the wheel of the new clock.
+		p_timer->time_left = entry.deadline - entry.wheel->get_time();
+		_schedule_timer(p_timer);
+	}
+}
+
+double SceneTree::_get_timer_time_left(const SceneTreeTimer *p_timer) const {
+	_THREAD_SAFE_METHOD_
+	const TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (entry.wheel) {
+		return MAX(entry.deadline - entry.wheel->get_time(), 0.0);
+	}
+	return MAX(p_timer->time_left, 0.0);
+}
+
+TimerWheel &SceneTree::_get_node_timer_wheel(const Timer *p_timer) {
+	return node_timer_wheels[(p_timer->timer_process_callback == Timer::TIMER_PROCESS_PHYSICS ? TIMER_CLOCK_PHYSICS : 0) | (p_timer->ignore_time_scale ? TIMER_CLOCK_IGNORE_TIME_SCALE : 0)];
+}
+
+// Timer nodes of process thread groups can be started and stopped from their group's thread,
+// so every access to the node timer wheels goes through these locked methods.
+
+void SceneTree::_schedule_node_timer(Timer *p_timer, double p_time_left) {
+	_THREAD_SAFE_METHOD_
+	TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (entry.wheel) {
+		entry.wheel->cancel(&entry);
+	}
+	TimerWheel &wheel = _get_node_timer_wheel(p_timer);
+	wheel.schedule(&entry, wheel.get_time() + p_time_left);
+}
+
+void SceneTree::_reschedule_node_timer(Timer *p_timer, double p_interval) {
+	_THREAD_SAFE_METHOD_
+	TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (entry.wheel) {
+		entry.wheel->cancel(&entry);
+	}
+	_get_node_timer_wheel(p_timer).schedule(&entry, entry.deadline + p_interval);
+}
+
+bool SceneTree::_unschedule_node_timer(Timer *p_timer, double &r_time_left) {
+	_THREAD_SAFE_METHOD_
+	TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (!entry.wheel) {
+		return false;
+	}
+	r_time_left = entry.deadline - entry.wheel->get_time();
+	entry.wheel->cancel(&entry);
+	return true;
+}
+
+bool SceneTree::_get_node_timer_time_left(const Timer *p_timer, double &r_time_left) const {
+	_THREAD_SAFE_METHOD_
+	const TimerWheel::Entry &entry = p_timer->wheel_entry;
+	if (!entry.wheel) {
+		return false;
+	}
+	r_time_left = MAX(entry.deadline - entry.wheel->get_time(), 0.0);
+	return true;
+}
+
 void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 	_THREAD_SAFE_METHOD_
-	const List<Ref<SceneTreeTimer>>::Element *L = timers.back(); // Last element.
 	const double unscaled_delta = Engine::get_singleton()->get_process_step();
+	const uint32_t frame_clock = p_physics_frame ? TIMER_CLOCK_PHYSICS : 0;
+	const uint32_t clocks[] = {
+		frame_clock,
+		frame_clock | TIMER_CLOCK_IGNORE_TIME_SCALE,
+		frame_clock | TIMER_CLOCK_PAUSABLE,
+		frame_clock | TIMER_CLOCK_IGNORE_TIME_SCALE | TIMER_CLOCK_PAUSABLE,
+	};
 
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		Ref<SceneTreeTimer> timer = E->get();
-
-		if ((paused && !timer->is_process_always()) || (timer->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; // Break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
+	// Advance all the clocks before emitting, so timers started from a timeout
+	// only count down from the next frame.
+	for (uint32_t clock : clocks) {
+		if ((clock & TIMER_CLOCK_PAUSABLE) && paused) {
 			continue;
 		}
+		const double delta = (clock & TIMER_CLOCK_IGNORE_TIME_SCALE) ? unscaled_delta : p_delta;
+		timer_wheels[clock].advance(delta);
+		if (!(clock & TIMER_CLOCK_PAUSABLE)) {
+			node_timer_wheels[clock].advance(delta);
+		}
+	}
 
-		double time_left = timer->get_time_left();
-		time_left -= timer->is_ignoring_time_scale() ? unscaled_delta : p_delta;
-		timer->set_time_left(time_left);
-
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+	for (uint32_t clock : clocks) {
+		if (!(clock & TIMER_CLOCK_PAUSABLE)) {
+			TimerWheel &wheel = node_timer_wheels[clock];
+			while (TimerWheel::Entry *entry = wheel.pop_expired()) {
+				static_cast<Timer *>(entry->owner)->_timeout();
+			}
 		}
-		if (E == L) {
-			break; // Break on last, so if new timers were added during list traversal, ignore them.
+
+		TimerWheel &wheel = timer_wheels[clock];
+		while (TimerWheel::Entry *entry = wheel.pop_expired()) {
+			Ref<SceneTreeTimer> timer = static_cast<SceneTreeTimer *>(entry->owner);
+			timer->unreference(); // Taken when it was scheduled, the local reference keeps it alive while emitting.
+			timer->time_left = 0.0;
+			timer->emit_signal(SNAME("timeout"));
 		}
-		E = N;
 	}
 }
 
@@ -860,10 +980,16 @@ void SceneTree::finalize() {
 	MainLoop::finalize();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
-		timer->release_connections();
+	for (TimerWheel &wheel : timer_wheels) {
+		LocalVector<TimerWheel::Entry *> entries;
+		wheel.get_entries(entries);
+		for (TimerWheel::Entry *entry : entries) {
+			Ref<SceneTreeTimer> timer = static_cast<SceneTreeTimer *>(entry->owner);
+			wheel.cancel(entry);
+			timer->unreference();
+			timer->release_connections();
+		}
 	}
-	timers.clear();
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
@@ -1148,6 +1274,66 @@ bool SceneTree::is_suspended() const {
 	return suspended;
 }
 
+void SceneTree::register_process_batch_func(const StringName &p_class, ProcessBatchFunc p_func) {
+	ERR_FAIL_NULL(p_func);
+	process_batch_funcs[p_class] = p_func;
+}
+
+void SceneTree::unregister_process_batch_func(const StringName &p_class) {
+	process_batch_funcs.erase(p_class);
+}
+
+void SceneTree::clear_process_batch_funcs() {
+	process_batch_funcs.clear();
+}
+
+SceneTree::ProcessBatchFunc SceneTree::_get_process_batch_func(const Node *p_node) const {
+	const ObjectGDExtension *extension = p_node->_get_extension();
+	if (extension) {
+		// Batch functions of native parent classes are not inherited, the extension may handle processing itself.
+		return extension->process_batch ? &SceneTree::_process_extension_batch : nullptr;
+	}
+
+	const ProcessBatchFunc *func = process_batch_funcs.getptr(p_node->get_class_name());
+	return func ? *func : nullptr;
+}
+
+void SceneTree::_process_extension_batch(Node *const *p_nodes, uint32_t p_count, int p_notification) {
+	const ObjectGDExtension *extension = p_nodes[0]->_get_extension();
+
+	// Internal notifications are handled by the native parent classes. The batch function may also
+	// be gone if the extension is being reloaded.
+	if (!extension->process_batch || p_notification == Node::NOTIFICATION_INTERNAL_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS) {
+		// Native parent classes may emit signals, whose handlers can free or remove later nodes of the batch.
+		LocalVector<ObjectID> node_ids;
+		node_ids.resize(p_count);
+		for (uint32_t i = 0; i < p_count; i++) {
+			node_ids[i] = p_nodes[i]->get_instance_id();
+		}
+		for (uint32_t i = 0; i < p_count; i++) {
+			Node *n = ObjectDB::get_instance<Node>(node_ids[i]);
+			if (n && n->is_inside_tree()) {
+				n->notification(p_notification);
+			}
+		}
+		return;
+	}
+
+	LocalVector<GDExtensionClassInstancePtr> instances;
+	instances.resize(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		instances[i] = p_nodes[i]->_get_extension_instance();
+	}
+	extension->process_batch(instances.ptr(), p_count, p_notification);
+}
+
+void SceneTree::_flush_process_batch(ProcessGroup *p_group, ProcessBatchFunc p_func, int p_notification) {
+	if (!p_group->batch_nodes.is_empty()) {
+		p_func(p_group->batch_nodes.ptr(), p_group->batch_nodes.size(), p_notification);
+		p_group->batch_nodes.clear();
+	}
+}
+
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
@@ -1177,6 +1363,12 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	uint32_t node_count = nodes_copy.size();
 	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
 
+	// Consecutive nodes sharing a batch function and a notification are collected and notified
+	// together, which keeps the processing order intact.
+	ProcessBatchFunc batch_func = nullptr;
+	const ObjectGDExtension *batch_extension = nullptr;
+	int batch_notification = 0;
+
 	for (uint32_t i = 0; i < node_count; i++) {
 		Node *n = nodes_ptr[i];
 		if (nodes_removed_on_group_call.has(n)) {
@@ -1189,6 +1381,38 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			continue;
 		}
 
+		ProcessBatchFunc func = n->get_script_instance() ? nullptr : n->data.process_batch_func;
+		int notification = 0;
+		if (func) {
+			const bool internal = p_physics ? n->is_physics_processing_internal() : n->is_processing_internal();
+			const bool regular = p_physics ? n->is_physics_processing() : n->is_processing();
+			if (internal && regular) {
+				// Batching would move the regular notification of this node behind the internal ones of
+				// the following nodes, so it is notified on its own.
+				func = nullptr;
+			} else if (internal) {
+				notification = p_physics ? Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS : Node::NOTIFICATION_INTERNAL_PROCESS;
+			} else if (regular) {
+				notification = p_physics ? Node::NOTIFICATION_PHYSICS_PROCESS : Node::NOTIFICATION_PROCESS;
+			} else {
+				continue;
+			}
+		}
+
+		if (func != batch_func || (func && (n->_get_extension() != batch_extension || notification != batch_notification))) {
+			if (batch_func) {
+				_flush_process_batch(p_group, batch_func, batch_notification);
+			}
+			batch_func = func;
+			batch_extension = n->_get_extension();
+			batch_notification = notification;
+		}
+
+		if (func) {
+			p_group->batch_nodes.push_back(n);
+			continue;
+		}
+
 		if (p_physics) {
 			if (n->is_physics_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
@@ -1205,6 +1429,9 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			}
 		}
 	}
+	if (batch_func) {
+		_flush_process_batch(p_group, batch_func, batch_notification);
+	}
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
@@ -1390,6 +1617,8 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	p_node->data.process_batch_func = _get_process_batch_func(p_node);
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
 		pg->nodes.push_back(p_node);
 		pg->node_order_dirty = true;
@@ -1747,7 +1976,7 @@ RequiredResult<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool
 	stt->set_time_left(p_delay_sec);
 	stt->set_process_in_physics(p_process_in_physics);
 	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	_schedule_timer(stt.ptr());
 	return stt;
 }
 
@@ -1972,6 +2201,7 @@ SceneTree *SceneTree::singleton = nullptr;
 
 SceneTree::IdleCallback SceneTree::idle_callbacks[SceneTree::MAX_IDLE_CALLBACKS];
 int SceneTree::idle_callback_count = 0;
+HashMap<StringName, SceneTree::ProcessBatchFunc> SceneTree::process_batch_funcs;
 
 void SceneTree::_call_idle_callbacks() {
 	for (int i = 0; i < idle_callback_count; i++) {
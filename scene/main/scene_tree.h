@@ -35,6 +35,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
 #include "scene/main/scene_tree_fti.h"
+#include "scene/main/timer_wheel.h"
 
 #include <cstdlib>
 
@@ -52,17 +53,25 @@ class Material;
 class Mesh;
 class MultiplayerAPI;
 class SceneDebugger;
+class Timer;
 class Tween;
 class Viewport;
 
 class SceneTreeTimer : public RefCounted {
 	GDCLASS(SceneTreeTimer, RefCounted);
 
+	friend class SceneTree;
+
 	double time_left = 0.0;
 	bool process_always = true;
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	// Scheduled on one of the tree's timer wheels until it times out.
+	TimerWheel::Entry wheel_entry{ this };
+
+	void _update_clock();
+
 protected:
 	static void _bind_methods();
 
@@ -89,6 +98,8 @@ class SceneTree : public MainLoop {
 
 public:
 	typedef void (*IdleCallback)();
+	// Sends one of the (internal) (physics) process notifications to many nodes of the same class at once.
+	typedef void (*ProcessBatchFunc)(Node *const *p_nodes, uint32_t p_count, int p_notification);
 
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
@@ -102,6 +113,9 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+
+		// Nodes waiting to be sent to a process batch function, only used while processing.
+		LocalVector<Node *> batch_nodes;
 	};
 
 	struct ProcessGroupSort {
@@ -216,7 +230,32 @@ private:
 
 	void _flush_scene_change();
 
-	List<Ref<SceneTreeTimer>> timers;
+	// SceneTreeTimers and Timer nodes count down on timer wheels, one for
+	// each combination of clock settings. Timer nodes take themselves off
+	// their wheel when they can't process, so they don't need pausable ones.
+	enum TimerClock {
+		TIMER_CLOCK_PHYSICS = 1,
+		TIMER_CLOCK_IGNORE_TIME_SCALE = 2,
+		TIMER_CLOCK_PAUSABLE = 4,
+		TIMER_CLOCK_MAX = 8,
+	};
+
+	TimerWheel timer_wheels[TIMER_CLOCK_MAX];
+	TimerWheel node_timer_wheels[TIMER_CLOCK_PAUSABLE];
+
+	friend class SceneTreeTimer;
+	friend class Timer;
+
+	void _schedule_timer(SceneTreeTimer *p_timer);
+	void _reschedule_timer(SceneTreeTimer *p_timer, double p_time_left);
+	void _move_timer_to_clock(SceneTreeTimer *p_timer);
+	double _get_timer_time_left(const SceneTreeTimer *p_timer) const;
+	TimerWheel &_get_node_timer_wheel(const Timer *p_timer);
+	void _schedule_node_timer(Timer *p_timer, double p_time_left);
+	void _reschedule_node_timer(Timer *p_timer, double p_interval);
+	bool _unschedule_node_timer(Timer *p_timer, double &r_time_left);
+	bool _get_node_timer_time_left(const Timer *p_timer, double &r_time_left) const;
+
 	List<Ref<Tween>> tweens;
 
 	///network///
@@ -238,6 +277,9 @@ private:
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 
+	static void _process_extension_batch(Node *const *p_nodes, uint32_t p_count, int p_notification);
+	ProcessBatchFunc _get_process_batch_func(const Node *p_node) const;
+	void _flush_process_batch(ProcessGroup *p_group, ProcessBatchFunc p_func, int p_notification);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
@@ -268,6 +310,8 @@ private:
 
 	static IdleCallback idle_callbacks[MAX_IDLE_CALLBACKS];
 	static int idle_callback_count;
+
+	static HashMap<StringName, ProcessBatchFunc> process_batch_funcs;
 	void _call_idle_callbacks();
 
 	void _main_window_focus_in();
@@ -453,6 +497,13 @@ public:
 
 	static void add_idle_callback(IdleCallback p_callback);
 
+	// Lets nodes of exactly `p_class`, without a script, be processed in batches of consecutive nodes.
+	// The function must not free or remove other nodes from the tree, so signals that can run user code
+	// have to be emitted after the whole batch is processed.
+	static void register_process_batch_func(const StringName &p_class, ProcessBatchFunc p_func);
+	static void unregister_process_batch_func(const StringName &p_class);
+	static void clear_process_batch_funcs();
+
 	void set_disable_node_threading(bool p_disable);
 	//default texture settings
 
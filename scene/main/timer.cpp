@@ -34,6 +34,14 @@
 
 void Timer::_notification(int p_what) {
 	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE:
+		case NOTIFICATION_PAUSED:
+		case NOTIFICATION_UNPAUSED:
+		case NOTIFICATION_SUSPENDED:
+		case NOTIFICATION_UNSUSPENDED: {
+			_update_scheduling();
+		} break;
+
 		case NOTIFICATION_READY: {
 			if (autostart) {
 #ifdef TOOLS_ENABLED
@@ -46,49 +54,37 @@ void Timer::_notification(int p_what) {
 			}
 		} break;
 
-		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (!processing || timer_process_callback == TIMER_PROCESS_PHYSICS || !is_processing_internal()) {
-				return;
-			}
-			if (ignore_time_scale) {
-				time_left -= Engine::get_singleton()->get_process_step();
-			} else {
-				time_left -= get_process_delta_time();
-			}
-
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-
-				emit_signal(SNAME("timeout"));
-			}
+		case NOTIFICATION_EXIT_TREE: {
+			_unschedule();
 		} break;
+	}
+}
 
-		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (!processing || timer_process_callback == TIMER_PROCESS_IDLE || !is_physics_processing_internal()) {
-				return;
-			}
-			if (ignore_time_scale) {
-				time_left -= Engine::get_singleton()->get_process_step();
-			} else {
-				time_left -= get_physics_process_delta_time();
-			}
+void Timer::_unschedule() {
+	if (is_inside_tree()) {
+		get_tree()->_unschedule_node_timer(this, time_left);
+	}
+}
 
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-				emit_signal(SNAME("timeout"));
-			}
-		} break;
+void Timer::_update_scheduling() {
+	// Also called when settings change, to move to the matching wheel.
+	_unschedule();
+	if (processing && !paused && is_inside_tree() && can_process()) {
+		get_tree()->_schedule_node_timer(this, time_left);
 	}
 }
 
+void Timer::_timeout() {
+	if (!one_shot) {
+		// Keep counting from the deadline rather than from now, so the timer doesn't drift.
+		get_tree()->_reschedule_node_timer(this, wait_time);
+	} else {
+		stop();
+	}
+
+	emit_signal(SNAME("timeout"));
+}
+
 void Timer::set_wait_time(double p_time) {
 	ERR_FAIL_COND_MSG(p_time <= 0, "Time should be greater than zero.");
 	wait_time = p_time;
@@ -121,11 +117,13 @@ void Timer::start(double p_time) {
 	if (p_time > 0) {
 		set_wait_time(p_time);
 	}
+	_unschedule();
 	time_left = wait_time;
 	_set_process(true);
 }
 
 void Timer::stop() {
+	_unschedule();
 	time_left = -1;
 	_set_process(false);
 	autostart = false;
@@ -146,6 +144,7 @@ bool Timer::is_paused() const {
 
 void Timer::set_ignore_time_scale(bool p_ignore) {
 	ignore_time_scale = p_ignore;
+	_update_scheduling();
 }
 
 bool Timer::is_ignoring_time_scale() {
@@ -157,6 +156,10 @@ bool Timer::is_stopped() const {
 }
 
 double Timer::get_time_left() const {
+	double wheel_time_left = 0.0;
+	if (is_inside_tree() && get_tree()->_get_node_timer_time_left(this, wheel_time_left)) {
+		return wheel_time_left;
+	}
 	return time_left > 0 ? time_left : 0;
 }
 
@@ -165,21 +168,8 @@ void Timer::set_timer_process_callback(TimerProcessCallback p_callback) {
 		return;
 	}
 
-	switch (timer_process_callback) {
-		case TIMER_PROCESS_PHYSICS:
-			if (is_physics_processing_internal()) {
-				set_physics_process_internal(false);
-				set_process_internal(true);
-			}
-			break;
-		case TIMER_PROCESS_IDLE:
-			if (is_processing_internal()) {
-				set_process_internal(false);
-				set_physics_process_internal(true);
-			}
-			break;
-	}
 	timer_process_callback = p_callback;
+	_update_scheduling();
 }
 
 Timer::TimerProcessCallback Timer::get_timer_process_callback() const {
@@ -187,15 +177,8 @@ Timer::TimerProcessCallback Timer::get_timer_process_callback() const {
 }
 
 void Timer::_set_process(bool p_process, bool p_force) {
-	switch (timer_process_callback) {
-		case TIMER_PROCESS_PHYSICS:
-			set_physics_process_internal(p_process && !paused);
-			break;
-		case TIMER_PROCESS_IDLE:
-			set_process_internal(p_process && !paused);
-			break;
-	}
 	processing = p_process;
+	_update_scheduling();
 }
 
 PackedStringArray Timer::get_configuration_warnings() const {
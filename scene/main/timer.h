@@ -31,6 +31,7 @@
 #pragma once
 
 #include "scene/main/node.h"
+#include "scene/main/timer_wheel.h"
 
 class Timer : public Node {
 	GDCLASS(Timer, Node);
@@ -44,6 +45,15 @@ class Timer : public Node {
 
 	double time_left = -1.0;
 
+	// Scheduled on one of the tree's timer wheels while counting down.
+	TimerWheel::Entry wheel_entry{ this };
+
+	friend class SceneTree;
+
+	void _unschedule();
+	void _update_scheduling();
+	void _timeout();
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
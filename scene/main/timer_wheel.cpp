@@ -0,0 +1,185 @@
+/**************************************************************************/
+/*  timer_wheel.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "timer_wheel.h"
+
+uint64_t TimerWheel::_get_tick(double p_time) const {
+	const double ticks = p_time * TICKS_PER_SECOND;
+	if (ticks >= double(tick + MAX_TICKS)) {
+		// Beyond the last level, park it as far as possible. It's placed again
+		// when it cascades down.
+		return tick + MAX_TICKS;
+	}
+	return ticks > 0.0 ? uint64_t(ticks) : 0;
+}
+
+void TimerWheel::_place(Entry *p_entry) {
+	const uint64_t entry_tick = _get_tick(p_entry->deadline);
+
+	uint32_t level = 0;
+	uint32_t slot = tick & SLOT_MASK;
+	if (entry_tick > tick) {
+		const uint64_t delta = entry_tick - tick;
+		while (level < LEVEL_COUNT - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+			level++;
+		}
+		slot = (entry_tick >> (SLOT_BITS * level)) & SLOT_MASK;
+	}
+
+	p_entry->level = level;
+	slots[level][slot].add_last(&p_entry->element);
+	level_counts[level]++;
+	count++;
+}
+
+void TimerWheel::_unlink(Entry *p_entry) {
+	if (p_entry->level == LEVEL_EXPIRED) {
+		expired.remove(&p_entry->element);
+		return;
+	}
+	p_entry->element.remove_from_list();
+	level_counts[p_entry->level]--;
+	count--;
+}
+
+void TimerWheel::_collect(uint32_t p_slot) {
+	SelfList<Entry> *E = slots[0][p_slot].first();
+	while (E) {
+		SelfList<Entry> *N = E->next();
+		Entry *entry = E->self();
+		if (entry->deadline <= time) {
+			_unlink(entry);
+			entry->level = LEVEL_EXPIRED;
+			expired.add_last(E);
+		} else if (_get_tick(entry->deadline) > tick) {
+			// Was parked, put it where it belongs now.
+			_unlink(entry);
+			_place(entry);
+		}
+		// Otherwise, it's due later within this tick.
+		E = N;
+	}
+}
+
+void TimerWheel::_cascade() {
+	// Called when the lowest level wraps around. Each level that wraps
+	// around in turn moves its next slot down.
+	for (uint32_t level = 1; level < LEVEL_COUNT; level++) {
+		const uint32_t slot = (tick >> (SLOT_BITS * level)) & SLOT_MASK;
+		SelfList<Entry>::List &list = slots[level][slot];
+		while (list.first()) {
+			Entry *entry = list.first()->self();
+			_unlink(entry);
+			_place(entry);
+		}
+		if (slot != 0) {
+			break;
+		}
+	}
+}
+
+void TimerWheel::schedule(Entry *p_entry, double p_deadline) {
+	ERR_FAIL_COND_MSG(p_entry->wheel, "Timer is already scheduled.");
+	p_entry->wheel = this;
+	p_entry->deadline = p_deadline;
+	_place(p_entry);
+}
+
+void TimerWheel::cancel(Entry *p_entry) {
+	ERR_FAIL_COND_MSG(p_entry->wheel != this, "Timer is not scheduled in this wheel.");
+	_unlink(p_entry);
+	p_entry->wheel = nullptr;
+}
+
+void TimerWheel::advance(double p_delta) {
+	time += p_delta;
+	const uint64_t target = MAX(_get_tick(time), tick);
+
+	// Timers due later within the current tick, or scheduled in the past.
+	_collect(tick & SLOT_MASK);
+
+	while (tick < target) {
+		if (count == 0) {
+			tick = target;
+			break;
+		}
+		if (level_counts[0] == 0) {
+			// Nothing in the lowest level, skip to its last slot.
+			const uint64_t lap_end = tick | SLOT_MASK;
+			if (lap_end >= target) {
+				tick = target;
+				break;
+			}
+			tick = lap_end;
+		}
+
+		tick++;
+		if ((tick & SLOT_MASK) == 0) {
+			_cascade();
+		}
+		_collect(tick & SLOT_MASK);
+	}
+}
+
+TimerWheel::Entry *TimerWheel::pop_expired() {
+	SelfList<Entry> *E = expired.first();
+	if (!E) {
+		return nullptr;
+	}
+	Entry *entry = E->self();
+	expired.remove(E);
+	entry->wheel = nullptr;
+	return entry;
+}
+
+void TimerWheel::get_entries(LocalVector<Entry *> &r_entries) {
+	for (uint32_t level = 0; level < LEVEL_COUNT; level++) {
+		for (SelfList<Entry>::List &list : slots[level]) {
+			for (SelfList<Entry> *E = list.first(); E; E = E->next()) {
+				r_entries.push_back(E->self());
+			}
+		}
+	}
+	for (SelfList<Entry> *E = expired.first(); E; E = E->next()) {
+		r_entries.push_back(E->self());
+	}
+}
+
+void TimerWheel::clear() {
+	LocalVector<Entry *> entries;
+	get_entries(entries);
+	for (Entry *entry : entries) {
+		cancel(entry);
+	}
+}
+
+TimerWheel::~TimerWheel() {
+	clear();
+}
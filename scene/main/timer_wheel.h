@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  timer_wheel.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+#include "core/templates/self_list.h"
+
+class Object;
+
+// Hierarchical timing wheel. Schedules timers on a clock that only moves
+// forward, in slots of 1/1024th of a second. Each level has 64 slots, each
+// slot 64 times wider than those of the level below; timers are placed in the
+// level matching how far away they are, and cascade down as the clock gets
+// closer. Scheduling and canceling are O(1), and advancing the clock only
+// looks at the slots it goes through, not at every timer.
+class TimerWheel {
+public:
+	struct Entry {
+		SelfList<Entry> element;
+		TimerWheel *wheel = nullptr;
+		Object *owner = nullptr;
+		double deadline = 0.0;
+		uint32_t level = 0;
+
+		Entry(Object *p_owner = nullptr) :
+				element(this), owner(p_owner) {}
+		~Entry() {
+			if (wheel) {
+				wheel->cancel(this);
+			}
+		}
+	};
+
+private:
+	static constexpr uint32_t SLOT_BITS = 6;
+	static constexpr uint32_t SLOT_COUNT = 1 << SLOT_BITS;
+	static constexpr uint32_t SLOT_MASK = SLOT_COUNT - 1;
+	static constexpr uint32_t LEVEL_COUNT = 6;
+	static constexpr uint32_t LEVEL_EXPIRED = LEVEL_COUNT;
+	static constexpr uint64_t MAX_TICKS = (uint64_t(1) << (SLOT_BITS * LEVEL_COUNT)) - 1;
+	static constexpr double TICKS_PER_SECOND = 1024.0;
+
+	SelfList<Entry>::List slots[LEVEL_COUNT][SLOT_COUNT];
+	SelfList<Entry>::List expired;
+	uint32_t level_counts[LEVEL_COUNT] = {};
+	uint32_t count = 0;
+
+	double time = 0.0;
+	uint64_t tick = 0;
+
+	uint64_t _get_tick(double p_time) const;
+	void _place(Entry *p_entry);
+	void _unlink(Entry *p_entry);
+	void _collect(uint32_t p_slot);
+	void _cascade();
+
+public:
+	// Deadlines are in the wheel's time, see get_time().
+	void schedule(Entry *p_entry, double p_deadline);
+	void cancel(Entry *p_entry);
+
+	// Moves the clock forward. Timers whose deadline is reached are set
+	// aside until retrieved with pop_expired().
+	void advance(double p_delta);
+	Entry *pop_expired();
+
+	double get_time() const { return time; }
+	// Timers still waiting for their deadline.
+	uint32_t get_count() const { return count; }
+	void get_entries(LocalVector<Entry *> &r_entries);
+	void clear();
+
+	TimerWheel() {}
+	~TimerWheel();
+};
@@ -660,6 +660,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(GPUParticlesAttractorSphere3D);
 	GDREGISTER_CLASS(GPUParticlesAttractorVectorField3D);
 	GDREGISTER_CLASS(CPUParticles3D);
+	SceneTree::register_process_batch_func(CPUParticles3D::get_class_static(), &CPUParticles3D::process_batch);
 	GDREGISTER_CLASS(Marker3D);
 	GDREGISTER_CLASS(RootMotionView);
 	GDREGISTER_VIRTUAL_CLASS(SkeletonModifier3D);
@@ -894,6 +895,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Node2D);
 	GDREGISTER_CLASS(CanvasGroup);
 	GDREGISTER_CLASS(CPUParticles2D);
+	SceneTree::register_process_batch_func(CPUParticles2D::get_class_static(), &CPUParticles2D::process_batch);
 	GDREGISTER_CLASS(GPUParticles2D);
 	GDREGISTER_CLASS(Sprite2D);
 	GDREGISTER_CLASS(SpriteFrames);
@@ -1186,6 +1188,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_ABSTRACT_CLASS(SceneInstantiation);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
@@ -1473,6 +1476,7 @@ void unregister_scene_types() {
 	CanvasItemMaterial::finish_shaders();
 	ColorPickerShape::finish_shaders();
 	GraphEdit::finish_shaders();
+	SceneTree::clear_process_batch_funcs();
 	SceneStringNames::free();
 
 	OS::get_singleton()->benchmark_end_measure("Scene", "Unregister Types");
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/os/rw_lock.h"
+#include "core/templates/hash_map.h"
 #include "scene/resources/mesh.h"
 #include "servers/navigation_3d/navigation_constants_3d.h"
 
@@ -76,10 +77,23 @@ public:
 		SOURCE_GEOMETRY_MAX
 	};
 
+	// Result of one tile of a tiled bake, reused by the next bake if the tile source did not change.
+	// The polygon range locates the tile in the assembled mesh, and the mesh hash identifies those
+	// assembled polygons so that navigation regions can reuse the tile while its neighbors rebake.
+	struct BakeTile {
+		uint64_t source_hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+		int polygon_begin = 0;
+		int polygon_count = 0;
+		uint64_t mesh_hash = 0;
+	};
+
 protected:
 	float cell_size = NavigationDefaults3D::NAV_MESH_CELL_SIZE;
 	float cell_height = NavigationDefaults3D::NAV_MESH_CELL_HEIGHT;
 	float border_size = 0.0f;
+	float tile_size = 0.0f;
 	float agent_height = 1.5f;
 	float agent_radius = 0.5f;
 	float agent_max_climb = 0.25f;
@@ -105,6 +119,8 @@ protected:
 	AABB filter_baking_aabb;
 	Vector3 filter_baking_aabb_offset;
 
+	HashMap<Vector2i, BakeTile> bake_tiles;
+
 public:
 	// Recast settings
 	void set_sample_partition_type(SamplePartitionType p_value);
@@ -134,6 +150,9 @@ public:
 	void set_border_size(float p_value);
 	float get_border_size() const;
 
+	void set_tile_size(float p_value);
+	float get_tile_size() const;
+
 	void set_agent_height(float p_value);
 	float get_agent_height() const;
 
@@ -199,6 +218,10 @@ public:
 	void set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons);
 	void get_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
+	void set_tiled_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons, const HashMap<Vector2i, BakeTile> &p_bake_tiles);
+	void get_tiled_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons, HashMap<Vector2i, BakeTile> &r_bake_tiles);
+	HashMap<Vector2i, BakeTile> get_bake_tiles();
+
 #ifdef DEBUG_ENABLED
 	Ref<ArrayMesh> get_debug_mesh();
 #endif // DEBUG_ENABLED
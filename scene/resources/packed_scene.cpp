@@ -35,6 +35,7 @@
 #include "core/io/missing_resource.h"
 #include "core/io/resource_loader.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 #include "core/templates/local_vector.h"
 #include "core/variant/callable_bind.h"
 #include "scene/2d/node_2d.h"
@@ -150,10 +151,6 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
-Node *SceneState::instantiate(GenEditState p_edit_state) const {
-	// Nodes where instantiation failed (because something is missing.)
-	List<Node *> stray_instances;
-
 #define NODE_FROM_ID(p_name, p_id)                                             \
 	Node *p_name;                                                              \
 	if (p_id & FLAG_ID_IS_PATH) {                                              \
@@ -163,12 +160,81 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			p_name = _recover_node_path_index(ret_nodes[0], p_id & FLAG_MASK); \
 		}                                                                      \
 	} else {                                                                   \
-		ERR_FAIL_INDEX_V(p_id & FLAG_MASK, nc, nullptr);                       \
+		ERR_FAIL_INDEX_V(p_id & FLAG_MASK, nc, false);                         \
 		p_name = ret_nodes[p_id & FLAG_MASK];                                  \
 	}
 
+void SceneState::InstantiationState::discard() {
+	while (stray_instances.size()) {
+		memdelete(stray_instances.front()->get());
+		stray_instances.pop_front();
+	}
+	if (!ret_nodes.is_empty() && ret_nodes[0]) {
+		memdelete(ret_nodes[0]);
+	}
+	ret_nodes.clear();
+	stage = STAGE_DONE;
+}
+
+bool SceneState::_instantiate_begin(InstantiationState &r_state, GenEditState p_edit_state) const {
+	int nc = nodes.size();
+	ERR_FAIL_COND_V_MSG(nc == 0, false, vformat("Failed to instantiate scene state of \"%s\", node count is 0. Make sure the PackedScene resource is valid.", path));
+
+	r_state.edit_state = p_edit_state;
+	r_state.stage = InstantiationState::STAGE_NODES;
+	r_state.next = 0;
+	r_state.ret_nodes.resize(nc);
+	for (Node *&node : r_state.ret_nodes) {
+		node = nullptr;
+	}
+	r_state.gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
+	return true;
+}
+
+bool SceneState::_instantiate_step(InstantiationState &r_state) const {
+	switch (r_state.stage) {
+		case InstantiationState::STAGE_NODES: {
+			if (!_instantiate_next_node(r_state)) {
+				return false;
+			}
+			r_state.next++;
+			if (r_state.next == nodes.size()) {
+				r_state.stage = InstantiationState::STAGE_NODE_PATHS;
+				r_state.next = 0;
+			}
+		} break;
+		case InstantiationState::STAGE_NODE_PATHS: {
+			_instantiate_node_paths(r_state);
+			r_state.stage = connections.is_empty() ? InstantiationState::STAGE_FINISH : InstantiationState::STAGE_CONNECTIONS;
+		} break;
+		case InstantiationState::STAGE_CONNECTIONS: {
+			if (!_instantiate_next_connection(r_state)) {
+				return false;
+			}
+			r_state.next++;
+			if (r_state.next == connections.size()) {
+				r_state.stage = InstantiationState::STAGE_FINISH;
+				r_state.next = 0;
+			}
+		} break;
+		case InstantiationState::STAGE_FINISH: {
+			_instantiate_finish(r_state);
+			r_state.stage = InstantiationState::STAGE_DONE;
+		} break;
+		case InstantiationState::STAGE_DONE: {
+		} break;
+	}
+	return true;
+}
+
+int SceneState::_get_instantiation_step_count() const {
+	// One step per node and per connection, plus node paths and finishing.
+	return nodes.size() + connections.size() + 2;
+}
+
+bool SceneState::_instantiate_next_node(InstantiationState &r_state) const {
+	const int i = r_state.next;
 	int nc = nodes.size();
-	ERR_FAIL_COND_V_MSG(nc == 0, nullptr, vformat("Failed to instantiate scene state of \"%s\", node count is 0. Make sure the PackedScene resource is valid.", path));
 
 	const StringName *snames = nullptr;
 	int sname_count = names.size();
@@ -182,417 +248,405 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		props = &variants[0];
 	}
 
-	//Vector<Variant> properties;
-
-	const NodeData *nd = &nodes[0];
+	Node **ret_nodes = r_state.ret_nodes.ptr();
 
-	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
-	ret_nodes[0] = nullptr; // Sidesteps "maybe uninitialized" false-positives on GCC.
+	const NodeData &n = nodes[i];
 
-	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
+	Node *parent = nullptr;
+	String old_parent_path;
 
-	HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> resources_local_to_scenes; // Record the mappings in sub-scenes.
-
-	LocalVector<DeferredNodePathProperties> deferred_node_paths;
-
-	bool deep_search_warned = false;
-
-	for (int i = 0; i < nc; i++) {
-		const NodeData &n = nd[i];
-
-		Node *parent = nullptr;
-		String old_parent_path;
-
-		if (i > 0) {
-			ERR_FAIL_COND_V_MSG(n.parent == -1, nullptr, vformat("Invalid scene: node %s does not specify its parent node.", snames[n.name]));
-			NODE_FROM_ID(nparent, n.parent);
+	if (i > 0) {
+		ERR_FAIL_COND_V_MSG(n.parent == -1, false, vformat("Invalid scene: node %s does not specify its parent node.", snames[n.name]));
+		NODE_FROM_ID(nparent, n.parent);
 #ifdef DEBUG_ENABLED
-			if (!nparent && (n.parent & FLAG_ID_IS_PATH)) {
-				WARN_PRINT(String("Parent path '" + String(node_paths[n.parent & FLAG_MASK]) + "' for node '" + String(snames[n.name]) + "' has vanished when instantiating: '" + get_path() + "'.").ascii().get_data());
-				old_parent_path = String(node_paths[n.parent & FLAG_MASK]).trim_prefix("./").replace_char('/', '@');
-				nparent = ret_nodes[0];
-			}
+		if (!nparent && (n.parent & FLAG_ID_IS_PATH)) {
+			WARN_PRINT(String("Parent path '" + String(node_paths[n.parent & FLAG_MASK]) + "' for node '" + String(snames[n.name]) + "' has vanished when instantiating: '" + get_path() + "'.").ascii().get_data());
+			old_parent_path = String(node_paths[n.parent & FLAG_MASK]).trim_prefix("./").replace_char('/', '@');
+			nparent = ret_nodes[0];
+		}
 #endif
-			parent = nparent;
-		} else {
-			// i == 0 is root node.
-			ERR_FAIL_COND_V_MSG(n.parent != -1, nullptr, vformat("Invalid scene: root node %s cannot specify a parent node.", snames[n.name]));
-			ERR_FAIL_COND_V_MSG(n.type == TYPE_INSTANTIATED && base_scene_idx < 0, nullptr, vformat("Invalid scene: root node %s in an instance, but there's no base scene.", snames[n.name]));
-		}
-
-		Node *node = nullptr;
-		MissingNode *missing_node = nullptr;
-		bool is_inherited_scene = false;
-
-		if (i == 0 && base_scene_idx >= 0) {
-			// Scene inheritance on root node.
-			Ref<PackedScene> sdata = props[base_scene_idx];
-			ERR_FAIL_COND_V(sdata.is_null(), nullptr);
-			node = sdata->instantiate(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE); //only main gets main edit state
-			ERR_FAIL_NULL_V(node, nullptr);
-			if (p_edit_state != GEN_EDIT_STATE_DISABLED) {
-				node->set_scene_inherited_state(sdata->get_state());
-			}
-			is_inherited_scene = true;
-		} else if (n.instance >= 0) {
-			// Instance a scene into this node.
-			if (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) {
-				const String scene_path = props[n.instance & FLAG_MASK];
-				if (disable_placeholders) {
-					Ref<PackedScene> sdata = ResourceLoader::load(scene_path, "PackedScene");
-					if (sdata.is_valid()) {
-						node = sdata->instantiate(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
-						ERR_FAIL_NULL_V(node, nullptr);
-					} else if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						missing_node = memnew(MissingNode);
-						missing_node->set_original_scene(scene_path);
-						missing_node->set_recording_properties(true);
-						node = missing_node;
-					} else {
-						ERR_FAIL_V_MSG(nullptr, "Placeholder scene is missing.");
-					}
-				} else {
-					InstancePlaceholder *ip = memnew(InstancePlaceholder);
-					ip->set_instance_path(scene_path);
-					node = ip;
-				}
-				node->set_scene_instance_load_placeholder(true);
-			} else {
-				Ref<Resource> res = props[n.instance & FLAG_MASK];
-				Ref<PackedScene> sdata = res;
+		parent = nparent;
+	} else {
+		// i == 0 is root node.
+		ERR_FAIL_COND_V_MSG(n.parent != -1, false, vformat("Invalid scene: root node %s cannot specify a parent node.", snames[n.name]));
+		ERR_FAIL_COND_V_MSG(n.type == TYPE_INSTANTIATED && base_scene_idx < 0, false, vformat("Invalid scene: root node %s in an instance, but there's no base scene.", snames[n.name]));
+	}
+
+	Node *node = nullptr;
+	MissingNode *missing_node = nullptr;
+	bool is_inherited_scene = false;
+
+	if (i == 0 && base_scene_idx >= 0) {
+		// Scene inheritance on root node.
+		Ref<PackedScene> sdata = props[base_scene_idx];
+		ERR_FAIL_COND_V(sdata.is_null(), false);
+		node = sdata->instantiate(r_state.edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE); //only main gets main edit state
+		ERR_FAIL_NULL_V(node, false);
+		if (r_state.edit_state != GEN_EDIT_STATE_DISABLED) {
+			node->set_scene_inherited_state(sdata->get_state());
+		}
+		is_inherited_scene = true;
+	} else if (n.instance >= 0) {
+		// Instance a scene into this node.
+		if (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) {
+			const String scene_path = props[n.instance & FLAG_MASK];
+			if (disable_placeholders) {
+				Ref<PackedScene> sdata = ResourceLoader::load(scene_path, "PackedScene");
 				if (sdata.is_valid()) {
-					node = sdata->instantiate(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
-					ERR_FAIL_NULL_V_MSG(node, nullptr, vformat("Failed to load scene dependency: \"%s\". Make sure the required scene is valid.", sdata->get_path()));
+					node = sdata->instantiate(r_state.edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
+					ERR_FAIL_NULL_V(node, false);
 				} else if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
 					missing_node = memnew(MissingNode);
-#ifdef TOOLS_ENABLED
-					if (res.is_valid()) {
-						missing_node->set_original_scene(res->get_meta("__load_path__", ""));
-					}
-#endif
+					missing_node->set_original_scene(scene_path);
 					missing_node->set_recording_properties(true);
 					node = missing_node;
 				} else {
-					ERR_FAIL_V_MSG(nullptr, "Scene instance is missing.");
+					ERR_FAIL_V_MSG(false, "Placeholder scene is missing.");
 				}
+			} else {
+				InstancePlaceholder *ip = memnew(InstancePlaceholder);
+				ip->set_instance_path(scene_path);
+				node = ip;
 			}
+			node->set_scene_instance_load_placeholder(true);
+		} else {
+			Ref<Resource> res = props[n.instance & FLAG_MASK];
+			Ref<PackedScene> sdata = res;
+			if (sdata.is_valid()) {
+				node = sdata->instantiate(r_state.edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
+				ERR_FAIL_NULL_V_MSG(node, false, vformat("Failed to load scene dependency: \"%s\". Make sure the required scene is valid.", sdata->get_path()));
+			} else if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				missing_node = memnew(MissingNode);
+#ifdef TOOLS_ENABLED
+				if (res.is_valid()) {
+					missing_node->set_original_scene(res->get_meta("__load_path__", ""));
+				}
+#endif
+				missing_node->set_recording_properties(true);
+				node = missing_node;
+			} else {
+				ERR_FAIL_V_MSG(false, "Scene instance is missing.");
+			}
+		}
 
-		} else if (n.type == TYPE_INSTANTIATED) {
-			// Get the node from somewhere, it likely already exists from another instance.
-			if (parent) {
-				node = parent->_get_child_by_name(snames[n.name]);
-				if (i < ids.size()) {
-					if (!node) {
-						// Can't get by name, try to fetch by ID. This is slow, but should be fixed after re-save.
-						int32_t id = ids[i];
-						if (id != Node::UNIQUE_SCENE_ID_UNASSIGNED) {
-							if (!deep_search_warned) {
-								WARN_PRINT(vformat("%sA node in the scene this one inherits from has been removed or moved, so a recovery process needs to take place. Please re-save this scene to avoid the cost of this process next time.", !get_path().is_empty() ? get_path() + ": " : ""));
-								deep_search_warned = true;
-							}
-							Node *base = parent;
-							while (base != ret_nodes[0] && !base->is_instance()) {
-								base = base->get_parent();
-							}
-							node = _find_node_by_id(base, base, id);
+	} else if (n.type == TYPE_INSTANTIATED) {
+		// Get the node from somewhere, it likely already exists from another instance.
+		if (parent) {
+			node = parent->_get_child_by_name(snames[n.name]);
+			if (i < ids.size()) {
+				if (!node) {
+					// Can't get by name, try to fetch by ID. This is slow, but should be fixed after re-save.
+					int32_t id = ids[i];
+					if (id != Node::UNIQUE_SCENE_ID_UNASSIGNED) {
+						if (!r_state.deep_search_warned) {
+							WARN_PRINT(vformat("%sA node in the scene this one inherits from has been removed or moved, so a recovery process needs to take place. Please re-save this scene to avoid the cost of this process next time.", !get_path().is_empty() ? get_path() + ": " : ""));
+							r_state.deep_search_warned = true;
 						}
-					} else {
-						if (ids[i] != node->get_unique_scene_id()) {
-							// This may be a scene that did not originally have ids and
-							// was saved before the parent, so force the id to match the
-							// parent scene node id.
-							ids.write[i] = node->get_unique_scene_id();
+						Node *base = parent;
+						while (base != ret_nodes[0] && !base->is_instance()) {
+							base = base->get_parent();
 						}
+						node = _find_node_by_id(base, base, id);
+					}
+				} else {
+					if (ids[i] != node->get_unique_scene_id()) {
+						// This may be a scene that did not originally have ids and
+						// was saved before the parent, so force the id to match the
+						// parent scene node id.
+						ids.write[i] = node->get_unique_scene_id();
 					}
 				}
+			}
 #ifdef DEBUG_ENABLED
-				if (!node) {
-					WARN_PRINT(String("Node '" + String(ret_nodes[0]->get_path_to(parent)) + "/" + String(snames[n.name]) + "' was modified from inside an instance, but it has vanished.").ascii().get_data());
-				}
-#endif
+			if (!node) {
+				WARN_PRINT(String("Node '" + String(ret_nodes[0]->get_path_to(parent)) + "/" + String(snames[n.name]) + "' was modified from inside an instance, but it has vanished.").ascii().get_data());
 			}
-		} else {
-			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+#endif
+		}
+	} else {
+		// Node belongs to this scene and must be created.
+		Object *obj = ClassDB::instantiate(snames[n.type]);
 
-			node = Object::cast_to<Node>(obj);
+		node = Object::cast_to<Node>(obj);
 
-			if (!node) {
-				if (obj) {
-					memdelete(obj);
-					obj = nullptr;
-				}
+		if (!node) {
+			if (obj) {
+				memdelete(obj);
+				obj = nullptr;
+			}
 
-				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-					missing_node = memnew(MissingNode);
-					missing_node->set_original_class(snames[n.type]);
-					missing_node->set_recording_properties(true);
-					node = missing_node;
-					obj = missing_node;
-				} else {
-					WARN_PRINT(vformat("Node %s of type %s cannot be created. A placeholder will be created instead.", snames[n.name], snames[n.type]).ascii().get_data());
-					if (n.parent >= 0 && n.parent < nc && ret_nodes[n.parent]) {
-						if (Object::cast_to<Control>(ret_nodes[n.parent])) {
-							obj = memnew(Control);
-						} else if (Object::cast_to<Node2D>(ret_nodes[n.parent])) {
-							obj = memnew(Node2D);
+			if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				missing_node = memnew(MissingNode);
+				missing_node->set_original_class(snames[n.type]);
+				missing_node->set_recording_properties(true);
+				node = missing_node;
+				obj = missing_node;
+			} else {
+				WARN_PRINT(vformat("Node %s of type %s cannot be created. A placeholder will be created instead.", snames[n.name], snames[n.type]).ascii().get_data());
+				if (n.parent >= 0 && n.parent < nc && ret_nodes[n.parent]) {
+					if (Object::cast_to<Control>(ret_nodes[n.parent])) {
+						obj = memnew(Control);
+					} else if (Object::cast_to<Node2D>(ret_nodes[n.parent])) {
+						obj = memnew(Node2D);
 #ifndef _3D_DISABLED
-						} else if (Object::cast_to<Node3D>(ret_nodes[n.parent])) {
-							obj = memnew(Node3D);
+					} else if (Object::cast_to<Node3D>(ret_nodes[n.parent])) {
+						obj = memnew(Node3D);
 #endif // _3D_DISABLED
-						}
-					}
-
-					if (!obj) {
-						obj = memnew(Node);
 					}
+				}
 
-					node = Object::cast_to<Node>(obj);
+				if (!obj) {
+					obj = memnew(Node);
 				}
-			}
-		}
 
-		if (node) {
-			if (i < ids.size()) {
-				node->set_unique_scene_id(ids[i]);
+				node = Object::cast_to<Node>(obj);
 			}
-			// may not have found the node (part of instantiated scene and removed)
-			// if found all is good, otherwise ignore
-
-			//properties
-			int nprop_count = n.properties.size();
-			if (nprop_count) {
-				const NodeData::Property *nprops = &n.properties[0];
+		}
+	}
 
-				Dictionary missing_resource_properties;
+	if (node) {
+		if (i < ids.size()) {
+			node->set_unique_scene_id(ids[i]);
+		}
+		// may not have found the node (part of instantiated scene and removed)
+		// if found all is good, otherwise ignore
 
-				for (int j = 0; j < nprop_count; j++) {
-					bool valid;
+		//properties
+		int nprop_count = n.properties.size();
+		if (nprop_count) {
+			const NodeData::Property *nprops = &n.properties[0];
 
-					ERR_FAIL_INDEX_V(nprops[j].value, prop_count, nullptr);
+			Dictionary missing_resource_properties;
 
-					if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
-						if (!Engine::get_singleton()->is_editor_hint() && node->get_scene_instance_load_placeholder()) {
-							// We cannot know if the referenced nodes exist yet, so instead of deferring, we write the NodePaths directly.
+			for (int j = 0; j < nprop_count; j++) {
+				bool valid;
 
-							uint32_t name_idx = nprops[j].name & (FLAG_PATH_PROPERTY_IS_NODE - 1);
-							ERR_FAIL_UNSIGNED_INDEX_V(name_idx, (uint32_t)sname_count, nullptr);
+				ERR_FAIL_INDEX_V(nprops[j].value, prop_count, false);
 
-							node->set(snames[name_idx], props[nprops[j].value], &valid);
-							continue;
-						}
+				if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
+					if (!Engine::get_singleton()->is_editor_hint() && node->get_scene_instance_load_placeholder()) {
+						// We cannot know if the referenced nodes exist yet, so instead of deferring, we write the NodePaths directly.
 
 						uint32_t name_idx = nprops[j].name & (FLAG_PATH_PROPERTY_IS_NODE - 1);
-						ERR_FAIL_UNSIGNED_INDEX_V(name_idx, (uint32_t)sname_count, nullptr);
+						ERR_FAIL_UNSIGNED_INDEX_V(name_idx, (uint32_t)sname_count, false);
 
-						DeferredNodePathProperties dnp;
-						dnp.value = props[nprops[j].value];
-						dnp.base = node->get_instance_id();
-						dnp.property = snames[name_idx];
-						deferred_node_paths.push_back(dnp);
+						node->set(snames[name_idx], props[nprops[j].value], &valid);
 						continue;
 					}
 
-					ERR_FAIL_INDEX_V(nprops[j].name, sname_count, nullptr);
+					uint32_t name_idx = nprops[j].name & (FLAG_PATH_PROPERTY_IS_NODE - 1);
+					ERR_FAIL_UNSIGNED_INDEX_V(name_idx, (uint32_t)sname_count, false);
 
-					if (snames[nprops[j].name] == CoreStringName(script)) {
-						//work around to avoid old script variables from disappearing, should be the proper fix to:
-						//https://github.com/godotengine/godot/issues/2958
+					DeferredNodePathProperties dnp;
+					dnp.value = props[nprops[j].value];
+					dnp.base = node->get_instance_id();
+					dnp.property = snames[name_idx];
+					r_state.deferred_node_paths.push_back(dnp);
+					continue;
+				}
 
-						//store old state
-						List<Pair<StringName, Variant>> old_state;
-						if (node->get_script_instance()) {
-							node->get_script_instance()->get_property_state(old_state);
-						}
+				ERR_FAIL_INDEX_V(nprops[j].name, sname_count, false);
+
+				if (snames[nprops[j].name] == CoreStringName(script)) {
+					//work around to avoid old script variables from disappearing, should be the proper fix to:
+					//https://github.com/godotengine/godot/issues/2958
+
+					//store old state
+					List<Pair<StringName, Variant>> old_state;
+					if (node->get_script_instance()) {
+						node->get_script_instance()->get_property_state(old_state);
+					}
 
 #ifdef TOOLS_ENABLED
-						const Ref<Script> value_as_script = props[nprops[j].value];
-						// It is possible that the user changed an existing script to abstract after it was attached to a node.
-						// When this happens, the user needs to fix it. See https://github.com/godotengine/godot/issues/109171
-						if (value_as_script.is_valid() && value_as_script->is_abstract()) {
-							const String global_class_name = value_as_script->get_global_name();
-							if (global_class_name.is_empty()) {
-								ERR_PRINT("Node \"" + snames[n.name] + "\" previously had a script, but that script is now abstract. Please assign a different script (right-click -> Attach Script...) or change the node to a different type (right-click -> Change Type...) to fix this, then re-save the scene.");
-							} else {
-								ERR_PRINT("Node \"" + snames[n.name] + "\" previously had a class of type \"" + global_class_name + "\", but that class is now abstract. Please assign a different script (right-click -> Attach Script...) or change the node to a different type (right-click -> Change Type...) to fix this, then re-save the scene.");
-							}
-							callable_mp((Object *)node, &Object::remove_meta).call_deferred(SceneStringName(_custom_type_script));
+					const Ref<Script> value_as_script = props[nprops[j].value];
+					// It is possible that the user changed an existing script to abstract after it was attached to a node.
+					// When this happens, the user needs to fix it. See https://github.com/godotengine/godot/issues/109171
+					if (value_as_script.is_valid() && value_as_script->is_abstract()) {
+						const String global_class_name = value_as_script->get_global_name();
+						if (global_class_name.is_empty()) {
+							ERR_PRINT("Node \"" + snames[n.name] + "\" previously had a script, but that script is now abstract. Please assign a different script (right-click -> Attach Script...) or change the node to a different type (right-click -> Change Type...) to fix this, then re-save the scene.");
 						} else {
-							node->set_script(props[nprops[j].value]);
+							ERR_PRINT("Node \"" + snames[n.name] + "\" previously had a class of type \"" + global_class_name + "\", but that class is now abstract. Please assign a different script (right-click -> Attach Script...) or change the node to a different type (right-click -> Change Type...) to fix this, then re-save the scene.");
 						}
-#else
+						callable_mp((Object *)node, &Object::remove_meta).call_deferred(SceneStringName(_custom_type_script));
+					} else {
 						node->set_script(props[nprops[j].value]);
+					}
+#else
+					node->set_script(props[nprops[j].value]);
 #endif // TOOLS_ENABLED
 
-						//restore old state for new script, if exists
-						for (const Pair<StringName, Variant> &E : old_state) {
-							node->set(E.first, E.second);
+					//restore old state for new script, if exists
+					for (const Pair<StringName, Variant> &E : old_state) {
+						node->set(E.first, E.second);
+					}
+				} else {
+					Variant value = props[nprops[j].value];
+
+					if (value.get_type() == Variant::OBJECT) {
+						//handle resources that are local to scene by duplicating them if needed
+						Ref<Resource> res = value;
+						if (res.is_valid()) {
+							value = make_local_resource(value, n, r_state.resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, r_state.edit_state);
 						}
 					} else {
-						Variant value = props[nprops[j].value];
-
-						if (value.get_type() == Variant::OBJECT) {
-							//handle resources that are local to scene by duplicating them if needed
-							Ref<Resource> res = value;
-							if (res.is_valid()) {
-								value = make_local_resource(value, n, resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, p_edit_state);
-							}
-						} else {
-							// Making sure that instances of inherited scenes don't share the same
-							// reference between them.
-							if (is_inherited_scene) {
-								value = value.duplicate(true);
-							}
+						// Making sure that instances of inherited scenes don't share the same
+						// reference between them.
+						if (is_inherited_scene) {
+							value = value.duplicate(true);
 						}
+					}
 
-						if (value.get_type() == Variant::ARRAY) {
-							Array set_array = value;
-							bool is_get_valid = false;
-							Variant get_value = node->get(snames[nprops[j].name], &is_get_valid);
-
-							if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-								Array get_array = get_value;
-								if (set_array.is_same_typed(get_array)) {
-									set_array = set_array.duplicate();
-								} else {
-									set_array = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-								}
-							}
+					if (value.get_type() == Variant::ARRAY) {
+						Array set_array = value;
+						bool is_get_valid = false;
+						Variant get_value = node->get(snames[nprops[j].name], &is_get_valid);
 
-							value = setup_resources_in_array(set_array, n, resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, p_edit_state);
+						if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+							Array get_array = get_value;
+							if (set_array.is_same_typed(get_array)) {
+								set_array = set_array.duplicate();
+							} else {
+								set_array = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+							}
 						}
 
-						if (value.get_type() == Variant::DICTIONARY) {
-							Dictionary set_dict = value;
-							bool is_get_valid = false;
-							Variant get_value = node->get(snames[nprops[j].name], &is_get_valid);
-
-							if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-								Dictionary get_dict = get_value;
-								if (set_dict.is_same_typed(get_dict)) {
-									set_dict = set_dict.duplicate();
-								} else {
-									set_dict = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(), get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-								}
-							}
+						value = setup_resources_in_array(set_array, n, r_state.resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, r_state.edit_state);
+					}
 
-							value = setup_resources_in_dictionary(set_dict, n, resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, p_edit_state);
-						}
+					if (value.get_type() == Variant::DICTIONARY) {
+						Dictionary set_dict = value;
+						bool is_get_valid = false;
+						Variant get_value = node->get(snames[nprops[j].name], &is_get_valid);
 
-						bool set_valid = true;
-						if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled() && value.get_type() == Variant::OBJECT) {
-							Ref<MissingResource> mr = value;
-							if (mr.is_valid()) {
-								missing_resource_properties[snames[nprops[j].name]] = mr;
-								set_valid = false;
+						if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+							Dictionary get_dict = get_value;
+							if (set_dict.is_same_typed(get_dict)) {
+								set_dict = set_dict.duplicate();
+							} else {
+								set_dict = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(), get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
 							}
 						}
 
-						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
-						}
-						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
-							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
+						value = setup_resources_in_dictionary(set_dict, n, r_state.resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, r_state.edit_state);
+					}
+
+					bool set_valid = true;
+					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled() && value.get_type() == Variant::OBJECT) {
+						Ref<MissingResource> mr = value;
+						if (mr.is_valid()) {
+							missing_resource_properties[snames[nprops[j].name]] = mr;
+							set_valid = false;
 						}
 					}
+
+					if (set_valid) {
+						node->set(snames[nprops[j].name], value, &valid);
+					}
+					if (r_state.edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
+						value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
+					}
 				}
-				if (!missing_resource_properties.is_empty()) {
-					node->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-				}
 			}
+			if (!missing_resource_properties.is_empty()) {
+				node->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+			}
+		}
 
-			//name
+		//name
 
-			//groups
-			for (int j = 0; j < n.groups.size(); j++) {
-				ERR_FAIL_INDEX_V(n.groups[j], sname_count, nullptr);
-				node->add_to_group(snames[n.groups[j]], true);
-			}
+		//groups
+		for (int j = 0; j < n.groups.size(); j++) {
+			ERR_FAIL_INDEX_V(n.groups[j], sname_count, false);
+			node->add_to_group(snames[n.groups[j]], true);
+		}
 
-			if (n.instance >= 0 || n.type != TYPE_INSTANTIATED || i == 0) {
-				//if node was not part of instance, must set its name, parenthood and ownership
-				if (i > 0) {
-					if (parent) {
-						bool pending_add = true;
+		if (n.instance >= 0 || n.type != TYPE_INSTANTIATED || i == 0) {
+			//if node was not part of instance, must set its name, parenthood and ownership
+			if (i > 0) {
+				if (parent) {
+					bool pending_add = true;
 #ifdef TOOLS_ENABLED
-						if (Engine::get_singleton()->is_editor_hint()) {
-							Node *existing = parent->_get_child_by_name(snames[n.name]);
-							if (existing) {
-								// There's already a node in the same parent with the same name.
-								// This means that somehow the node was added both to the scene being
-								// loaded and another one instantiated in the former, maybe because of
-								// manual editing, or a bug in scene saving, or a loophole in the workflow
-								// (with any of the bugs possibly already fixed).
-								// Bring consistency back by letting it be assigned a non-clashing name.
-								// This simple workaround at least avoids leaks and helps the user realize
-								// something awkward has happened.
-								if (instantiation_warn_notify) {
-									instantiation_warn_notify(vformat(
-											TTR("An incoming node's name clashes with %s already in the scene (presumably, from a more nested instance).\nThe less nested node will be renamed. Please fix and re-save the scene."),
-											ret_nodes[0]->get_path_to(existing)));
-								}
-								node->set_name(snames[n.name]);
-								parent->add_child(node, true);
-								pending_add = false;
+					if (Engine::get_singleton()->is_editor_hint()) {
+						Node *existing = parent->_get_child_by_name(snames[n.name]);
+						if (existing) {
+							// There's already a node in the same parent with the same name.
+							// This means that somehow the node was added both to the scene being
+							// loaded and another one instantiated in the former, maybe because of
+							// manual editing, or a bug in scene saving, or a loophole in the workflow
+							// (with any of the bugs possibly already fixed).
+							// Bring consistency back by letting it be assigned a non-clashing name.
+							// This simple workaround at least avoids leaks and helps the user realize
+							// something awkward has happened.
+							if (instantiation_warn_notify) {
+								instantiation_warn_notify(vformat(
+										TTR("An incoming node's name clashes with %s already in the scene (presumably, from a more nested instance).\nThe less nested node will be renamed. Please fix and re-save the scene."),
+										ret_nodes[0]->get_path_to(existing)));
 							}
+							node->set_name(snames[n.name]);
+							parent->add_child(node, true);
+							pending_add = false;
 						}
+					}
 #endif
-						if (pending_add) {
-							parent->_add_child_nocheck(node, snames[n.name]);
-						}
-						if (n.index >= 0 && n.index < parent->get_child_count() - 1) {
-							parent->move_child(node, n.index);
-						}
-					} else {
-						//it may be possible that an instantiated scene has changed
-						//and the node has nowhere to go anymore
-						stray_instances.push_back(node); //can't be added, go to stray list
+					if (pending_add) {
+						parent->_add_child_nocheck(node, snames[n.name]);
 					}
-				} else {
-					if (Engine::get_singleton()->is_editor_hint()) {
-						//validate name if using editor, to avoid broken
-						node->set_name(snames[n.name]);
-					} else {
-						node->_set_name_nocheck(snames[n.name]);
+					if (n.index >= 0 && n.index < parent->get_child_count() - 1) {
+						parent->move_child(node, n.index);
 					}
+				} else {
+					//it may be possible that an instantiated scene has changed
+					//and the node has nowhere to go anymore
+					r_state.stray_instances.push_back(node); //can't be added, go to stray list
+				}
+			} else {
+				if (Engine::get_singleton()->is_editor_hint()) {
+					//validate name if using editor, to avoid broken
+					node->set_name(snames[n.name]);
+				} else {
+					node->_set_name_nocheck(snames[n.name]);
 				}
 			}
+		}
 
-			if (!old_parent_path.is_empty()) {
-				node->set_name(old_parent_path + "#" + node->get_name());
-			}
+		if (!old_parent_path.is_empty()) {
+			node->set_name(old_parent_path + "#" + node->get_name());
+		}
 
-			if (n.owner >= 0) {
-				NODE_FROM_ID(owner, n.owner);
-				if (owner) {
-					node->_set_owner_nocheck(owner);
-					if (node->data.unique_name_in_owner) {
-						node->_acquire_unique_name_in_owner();
-					}
+		if (n.owner >= 0) {
+			NODE_FROM_ID(owner, n.owner);
+			if (owner) {
+				node->_set_owner_nocheck(owner);
+				if (node->data.unique_name_in_owner) {
+					node->_acquire_unique_name_in_owner();
 				}
 			}
-
-			// We only want to deal with pinned flag if instantiating as pure main (no instance, no inheriting.)
-			if (p_edit_state == GEN_EDIT_STATE_MAIN) {
-				_sanitize_node_pinned_properties(node);
-			} else {
-				node->remove_meta("_edit_pinned_properties_");
-			}
 		}
 
-		if (missing_node) {
-			missing_node->set_recording_properties(false);
+		// We only want to deal with pinned flag if instantiating as pure main (no instance, no inheriting.)
+		if (r_state.edit_state == GEN_EDIT_STATE_MAIN) {
+			_sanitize_node_pinned_properties(node);
+		} else {
+			node->remove_meta("_edit_pinned_properties_");
 		}
+	}
 
-		ret_nodes[i] = node;
+	if (missing_node) {
+		missing_node->set_recording_properties(false);
+	}
 
-		if (node && gen_node_path_cache && ret_nodes[0]) {
-			NodePath n2 = ret_nodes[0]->get_path_to(node);
-			node_path_cache[n2] = i;
-		}
+	ret_nodes[i] = node;
+
+	if (node && r_state.gen_node_path_cache && ret_nodes[0]) {
+		NodePath n2 = ret_nodes[0]->get_path_to(node);
+		node_path_cache[n2] = i;
 	}
+	return true;
+}
 
-	for (const DeferredNodePathProperties &dnp : deferred_node_paths) {
+void SceneState::_instantiate_node_paths(InstantiationState &r_state) const {
+	for (const DeferredNodePathProperties &dnp : r_state.deferred_node_paths) {
 		// Replace properties stored as NodePaths with actual Nodes.
 		Node *base = ObjectDB::get_instance<Node>(dnp.base);
 		ERR_CONTINUE_EDMSG(!base, vformat("Failed to set deferred property '%s' as the base node disappeared.", dnp.property));
@@ -638,57 +692,58 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		}
 	}
 
-	for (KeyValue<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &E : resources_local_to_scenes) {
+	for (KeyValue<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &E : r_state.resources_local_to_scenes) {
 		for (KeyValue<Ref<Resource>, Ref<Resource>> &R : E.value) {
 			R.value->setup_local_to_scene(); // Setup may be required for the resource to work properly.
 		}
 	}
+}
 
-	//do connections
-
-	int cc = connections.size();
-	const ConnectionData *cdata = connections.ptr();
-
-	for (int i = 0; i < cc; i++) {
-		const ConnectionData &c = cdata[i];
-		//ERR_FAIL_INDEX_V( c.from, nc, nullptr );
-		//ERR_FAIL_INDEX_V( c.to, nc, nullptr );
+bool SceneState::_instantiate_next_connection(InstantiationState &r_state) const {
+	int nc = nodes.size();
+	const StringName *snames = names.ptr();
+	const Variant *props = variants.ptr();
+	Node **ret_nodes = r_state.ret_nodes.ptr();
 
-		NODE_FROM_ID(cfrom, c.from);
-		NODE_FROM_ID(cto, c.to);
+	const ConnectionData &c = connections[r_state.next];
 
-		if (!cfrom || !cto) {
-			continue;
-		}
+	NODE_FROM_ID(cfrom, c.from);
+	NODE_FROM_ID(cto, c.to);
 
-		Callable callable(cto, snames[c.method]);
+	if (!cfrom || !cto) {
+		return true;
+	}
 
-		Array binds;
-		if (c.flags & CONNECT_APPEND_SOURCE_OBJECT) {
-			binds.push_back(cfrom);
-		}
+	Callable callable(cto, snames[c.method]);
 
-		for (int bind : c.binds) {
-			binds.push_back(props[bind]);
-		}
+	Array binds;
+	if (c.flags & CONNECT_APPEND_SOURCE_OBJECT) {
+		binds.push_back(cfrom);
+	}
 
-		if (!binds.is_empty()) {
-			callable = callable.bindv(binds);
-		}
+	for (int bind : c.binds) {
+		binds.push_back(props[bind]);
+	}
 
-		if (c.unbinds > 0) {
-			callable = callable.unbind(c.unbinds);
-		}
+	if (!binds.is_empty()) {
+		callable = callable.bindv(binds);
+	}
 
-		cfrom->connect(snames[c.signal], callable, CONNECT_PERSIST | c.flags | (p_edit_state == GEN_EDIT_STATE_MAIN ? 0 : CONNECT_INHERITED));
+	if (c.unbinds > 0) {
+		callable = callable.unbind(c.unbinds);
 	}
 
-	//Node *s = ret_nodes[0];
+	cfrom->connect(snames[c.signal], callable, CONNECT_PERSIST | c.flags | (r_state.edit_state == GEN_EDIT_STATE_MAIN ? 0 : CONNECT_INHERITED));
+	return true;
+}
+
+void SceneState::_instantiate_finish(InstantiationState &r_state) const {
+	Node **ret_nodes = r_state.ret_nodes.ptr();
 
 	//remove nodes that could not be added, likely as a result that
-	while (stray_instances.size()) {
-		memdelete(stray_instances.front()->get());
-		stray_instances.pop_front();
+	while (r_state.stray_instances.size()) {
+		memdelete(r_state.stray_instances.front()->get());
+		r_state.stray_instances.pop_front();
 	}
 
 	for (int i = 0; i < editable_instances.size(); i++) {
@@ -697,8 +752,22 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			ret_nodes[0]->set_editable_instance(ei, true);
 		}
 	}
+}
 
-	return ret_nodes[0];
+#undef NODE_FROM_ID
+
+Node *SceneState::instantiate(GenEditState p_edit_state) const {
+	InstantiationState state;
+	if (!_instantiate_begin(state, p_edit_state)) {
+		return nullptr;
+	}
+	while (state.stage != InstantiationState::STAGE_DONE) {
+		if (!_instantiate_step(state)) {
+			state.discard();
+			return nullptr;
+		}
+	}
+	return state.ret_nodes[0];
 }
 
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
@@ -2490,17 +2559,43 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 		return nullptr;
 	}
 
+	_setup_instance(s, p_edit_state);
+
+	return s;
+}
+
+void PackedScene::_setup_instance(Node *p_instance, GenEditState p_edit_state) const {
 	if (p_edit_state != GEN_EDIT_STATE_DISABLED) {
-		s->set_scene_instance_state(state);
+		p_instance->set_scene_instance_state(state);
 	}
 
 	if (!is_built_in()) {
-		s->set_scene_file_path(get_path());
+		p_instance->set_scene_file_path(get_path());
 	}
 
-	s->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+	p_instance->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+}
 
-	return s;
+Ref<SceneInstantiation> PackedScene::instantiate_incremental(GenEditState p_edit_state) const {
+#ifndef TOOLS_ENABLED
+	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, Ref<SceneInstantiation>(), "Edit state is only for editors, does not work without tools compiled.");
+#endif
+
+	Ref<SceneInstantiation> instantiation;
+	instantiation.instantiate();
+	if (instantiation->start(Ref<PackedScene>((PackedScene *)this), p_edit_state) != OK) {
+		return Ref<SceneInstantiation>();
+	}
+	return instantiation;
+}
+
+Ref<SceneInstantiation> PackedScene::instantiate_threaded() const {
+	Ref<SceneInstantiation> instantiation;
+	instantiation.instantiate();
+	if (instantiation->start_threaded(Ref<PackedScene>((PackedScene *)this)) != OK) {
+		return Ref<SceneInstantiation>();
+	}
+	return instantiation;
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
@@ -2589,6 +2684,8 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_incremental", "edit_state"), &PackedScene::instantiate_incremental, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_threaded"), &PackedScene::instantiate_threaded);
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -2605,3 +2702,154 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+Error SceneInstantiation::start(const Ref<PackedScene> &p_scene, PackedScene::GenEditState p_edit_state) {
+	ERR_FAIL_COND_V(p_scene.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(get_status() == STATUS_IN_PROGRESS, ERR_BUSY, "Instantiation already in progress.");
+
+	cancel();
+
+	scene = p_scene;
+	state = p_scene->get_state();
+	edit_state = p_edit_state;
+	if (!state->_instantiate_begin(instantiation, (SceneState::GenEditState)p_edit_state)) {
+		status = STATUS_FAILED;
+		return ERR_CANT_CREATE;
+	}
+
+	status = STATUS_IN_PROGRESS;
+	steps_done.set(0);
+	step_count = state->_get_instantiation_step_count();
+	return OK;
+}
+
+Error SceneInstantiation::start_threaded(const Ref<PackedScene> &p_scene) {
+	Error err = start(p_scene, PackedScene::GEN_EDIT_STATE_DISABLED);
+	if (err != OK) {
+		return err;
+	}
+
+	abort_requested.clear();
+	task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &SceneInstantiation::_threaded_build, nullptr, false, vformat("SceneInstantiation:%s", p_scene->get_path()));
+	return OK;
+}
+
+SceneInstantiation::Status SceneInstantiation::_run_steps(uint64_t p_time_budget_usec) {
+	// Always make some progress, even if the budget is too small for a single step.
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	do {
+		if (!state->_instantiate_step(instantiation)) {
+			instantiation.discard();
+			status = STATUS_FAILED;
+			return status;
+		}
+		steps_done.increment();
+
+		if (instantiation.stage == SceneState::InstantiationState::STAGE_DONE) {
+			root = instantiation.ret_nodes[0];
+			instantiation.ret_nodes.clear();
+			scene->_setup_instance(root, edit_state);
+			status = STATUS_DONE;
+			return status;
+		}
+	} while (OS::get_singleton()->get_ticks_usec() - begin < p_time_budget_usec);
+
+	return status;
+}
+
+void SceneInstantiation::_threaded_build(void *p_userdata) {
+	// A zero budget runs a single step, so cancel() doesn't wait for the whole scene.
+	while (status == STATUS_IN_PROGRESS && !abort_requested.is_set()) {
+		_run_steps(0);
+	}
+}
+
+void SceneInstantiation::_finish_task() {
+	if (task_id == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	task_id = WorkerThreadPool::INVALID_TASK_ID;
+}
+
+SceneInstantiation::Status SceneInstantiation::process(uint64_t p_time_budget_usec) {
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		// The task does the work, only collect it once it's over.
+		if (WorkerThreadPool::get_singleton()->is_task_completed(task_id)) {
+			_finish_task();
+		}
+		return get_status();
+	}
+
+	ERR_FAIL_COND_V_MSG(status != STATUS_IN_PROGRESS, status, "No instantiation in progress.");
+	return _run_steps(p_time_budget_usec);
+}
+
+SceneInstantiation::Status SceneInstantiation::wait() {
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		_finish_task();
+		return status;
+	}
+
+	ERR_FAIL_COND_V_MSG(status != STATUS_IN_PROGRESS, status, "No instantiation in progress.");
+	return _run_steps(UINT64_MAX);
+}
+
+SceneInstantiation::Status SceneInstantiation::get_status() const {
+	// The status belongs to the task until it completes.
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID && !WorkerThreadPool::get_singleton()->is_task_completed(task_id)) {
+		return STATUS_IN_PROGRESS;
+	}
+	return status;
+}
+
+float SceneInstantiation::get_progress() const {
+	if (get_status() == STATUS_DONE) {
+		return 1.0;
+	}
+	return step_count > 0 ? float(steps_done.get()) / step_count : 0.0;
+}
+
+Node *SceneInstantiation::get_node() {
+	ERR_FAIL_COND_V_MSG(get_status() != STATUS_DONE, nullptr, "Instantiation is not done.");
+	_finish_task();
+	Node *ret = root;
+	root = nullptr;
+	return ret;
+}
+
+void SceneInstantiation::cancel() {
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		// The task stops after its current step.
+		abort_requested.set();
+		_finish_task();
+	}
+
+	instantiation.discard();
+	if (root) {
+		memdelete(root);
+		root = nullptr;
+	}
+	scene.unref();
+	state.unref();
+	if (status == STATUS_IN_PROGRESS) {
+		status = STATUS_FAILED;
+	}
+}
+
+void SceneInstantiation::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("process", "time_budget_usec"), &SceneInstantiation::process);
+	ClassDB::bind_method(D_METHOD("wait"), &SceneInstantiation::wait);
+	ClassDB::bind_method(D_METHOD("get_status"), &SceneInstantiation::get_status);
+	ClassDB::bind_method(D_METHOD("get_progress"), &SceneInstantiation::get_progress);
+	ClassDB::bind_method(D_METHOD("get_node"), &SceneInstantiation::get_node);
+	ClassDB::bind_method(D_METHOD("cancel"), &SceneInstantiation::cancel);
+
+	BIND_ENUM_CONSTANT(STATUS_IN_PROGRESS);
+	BIND_ENUM_CONSTANT(STATUS_DONE);
+	BIND_ENUM_CONSTANT(STATUS_FAILED);
+}
+
+SceneInstantiation::~SceneInstantiation() {
+	cancel();
+}
@@ -31,8 +31,11 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/main/node.h"
 
+class SceneInstantiation;
+
 class SceneState : public RefCounted {
 	GDCLASS(SceneState, RefCounted);
 
@@ -138,6 +141,44 @@ public:
 		int node = -1;
 	};
 
+private:
+	friend class SceneInstantiation;
+
+	// Everything an instantiation keeps between steps, so that it can be
+	// carried out all at once or spread over several calls.
+	struct InstantiationState {
+		enum Stage {
+			STAGE_NODES,
+			STAGE_NODE_PATHS,
+			STAGE_CONNECTIONS,
+			STAGE_FINISH,
+			STAGE_DONE,
+		};
+
+		Stage stage = STAGE_DONE;
+		int next = 0;
+		GenEditState edit_state = GEN_EDIT_STATE_DISABLED;
+		LocalVector<Node *> ret_nodes;
+		// Nodes where instantiation failed (because something is missing.)
+		List<Node *> stray_instances;
+		HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> resources_local_to_scenes; // Record the mappings in sub-scenes.
+		LocalVector<DeferredNodePathProperties> deferred_node_paths;
+		bool gen_node_path_cache = false;
+		bool deep_search_warned = false;
+
+		// Frees the nodes built so far.
+		void discard();
+	};
+
+	bool _instantiate_begin(InstantiationState &r_state, GenEditState p_edit_state) const;
+	bool _instantiate_step(InstantiationState &r_state) const;
+	int _get_instantiation_step_count() const;
+	bool _instantiate_next_node(InstantiationState &r_state) const;
+	void _instantiate_node_paths(InstantiationState &r_state) const;
+	bool _instantiate_next_connection(InstantiationState &r_state) const;
+	void _instantiate_finish(InstantiationState &r_state) const;
+
+public:
 	static void set_disable_placeholders(bool p_disable);
 	static Ref<Resource> get_remap_resource(const Ref<Resource> &p_resource, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &remap_cache, const Ref<Resource> &p_fallback, Node *p_for_scene);
 
@@ -250,6 +291,8 @@ class PackedScene : public Resource {
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
+	friend class SceneInstantiation;
+
 protected:
 	virtual bool editor_can_reload_from_file() override { return false; } // this is handled by editor better
 	static void _bind_methods();
@@ -263,12 +306,18 @@ public:
 		GEN_EDIT_STATE_MAIN_INHERITED,
 	};
 
+private:
+	void _setup_instance(Node *p_instance, GenEditState p_edit_state) const;
+
+public:
 	Error pack(Node *p_scene);
 
 	void clear();
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	Ref<SceneInstantiation> instantiate_incremental(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	Ref<SceneInstantiation> instantiate_threaded() const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -292,3 +341,57 @@ public:
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
+
+// Builds a PackedScene over several calls to process(), each bounded by a
+// time budget, so large scenes don't stall a single frame. The nodes stay
+// outside of the scene tree until the whole scene is built.
+//
+// It can also build the whole scene on a WorkerThreadPool task instead.
+// Nodes that are not in the tree can be used from any thread, so the task
+// can create and configure them; only adding the result to the tree (which
+// runs enter tree and ready) is left to the main thread.
+class SceneInstantiation : public RefCounted {
+	GDCLASS(SceneInstantiation, RefCounted);
+
+public:
+	enum Status {
+		STATUS_IN_PROGRESS,
+		STATUS_DONE,
+		STATUS_FAILED,
+	};
+
+private:
+	Ref<PackedScene> scene;
+	Ref<SceneState> state;
+	SceneState::InstantiationState instantiation;
+	PackedScene::GenEditState edit_state = PackedScene::GEN_EDIT_STATE_DISABLED;
+	Status status = STATUS_FAILED;
+	SafeNumeric<int> steps_done;
+	int step_count = 0;
+	Node *root = nullptr;
+
+	// While the task runs, it owns everything above but scene and state.
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	SafeFlag abort_requested;
+
+	Status _run_steps(uint64_t p_time_budget_usec);
+	void _threaded_build(void *p_userdata);
+	void _finish_task();
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error start(const Ref<PackedScene> &p_scene, PackedScene::GenEditState p_edit_state);
+	Error start_threaded(const Ref<PackedScene> &p_scene);
+	Status process(uint64_t p_time_budget_usec);
+	Status wait();
+	Status get_status() const;
+	float get_progress() const;
+	Node *get_node();
+	void cancel();
+
+	~SceneInstantiation();
+};
+
+VARIANT_ENUM_CAST(SceneInstantiation::Status)
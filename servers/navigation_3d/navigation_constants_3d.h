@@ -72,6 +72,8 @@ constexpr const char *const NAV_MESH_CELL_SIZE_HINT = "0.001,100,0.001,or_greate
 
 constexpr float EDGE_CONNECTION_MARGIN = 0.25f;
 constexpr float LINK_CONNECTION_RADIUS = 1.0f;
+constexpr float HIERARCHICAL_CLUSTER_SIZE = 32.0f;
+constexpr int PATH_CACHE_MAX_ENTRIES = 1024;
 constexpr int path_search_max_polygons = 4096;
 
 // Agent.
@@ -84,4 +86,9 @@ constexpr float AVOIDANCE_AGENT_TIME_HORIZON_OBSTACLES = 0.0;
 constexpr int AVOIDANCE_AGENT_MAX_NEIGHBORS = 10;
 constexpr float AVOIDANCE_AGENT_NEIGHBOR_DISTANCE = 50.0;
 
+// Avoidance.
+
+constexpr int AVOIDANCE_AGENT_TREE_MAX_REFITS = 30; // Agent trees are rebuilt after this many syncs with only moved agents.
+constexpr int AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT = 60; // Syncs an obstacle must stay unchanged before it joins the static obstacle tree.
+
 } //namespace NavigationDefaults3D
@@ -283,6 +283,11 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Optional, servers without a deterministic mode keep these defaults.
+	virtual void space_set_deterministic(RID p_space, bool p_enabled);
+	virtual bool space_is_deterministic(RID p_space) const;
+	virtual uint64_t space_get_state_hash(RID p_space) const;
+
 	//missing space parameters
 
 	/* AREA API */
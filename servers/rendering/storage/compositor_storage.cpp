@@ -57,12 +57,9 @@ void RendererCompositorStorage::compositor_effect_free(RID p_rid) {
 	ERR_FAIL_NULL(effect);
 
 	// Remove this RID from any compositor that uses it.
-	for (const RID &compositor_rid : compositor_owner.get_owned_list()) {
-		Compositor *compositor = compositor_owner.get_or_null(compositor_rid);
-		if (compositor) {
-			compositor->compositor_effects.erase(p_rid);
-		}
-	}
+	compositor_owner.for_each_owned([p_rid](const RID &p_compositor_rid, Compositor *p_compositor) {
+		p_compositor->compositor_effects.erase(p_rid);
+	});
 
 	// Update motion vector count if needed.
 	if (effect->is_enabled && effect->flags.has_flag(RS::CompositorEffectFlags::COMPOSITOR_EFFECT_FLAG_NEEDS_MOTION_VECTORS)) {
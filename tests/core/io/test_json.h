@@ -339,6 +339,99 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 	}
 }
 
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	const String inputs[] = {
+		"null",
+		"true",
+		"-12.5e3",
+		R"("hello")",
+		R"("Unicode: é中😀 and raw: é中😀")",
+		R"(["a", ["b", [], {}], 1, false, null])",
+		R"({"name": "Godot Engine", "apples": {"red": 500, "blue": -20}, "escaped \"key\"": "\t\\/"})",
+		"[1, 2, 3,]",
+		"{\n\t\"multi\": [\n\t\t1,\n\t\t2\n\t]\n}\n",
+		"  \"a long string that is scanned 16 bytes at a time by the structural scanner\"  ",
+	};
+
+	for (const String &input : inputs) {
+		JSON json_string;
+		JSON json_utf8;
+		CHECK_MESSAGE(json_string.parse(input) == OK, vformat("Parsing `%s` as a String should succeed.", input));
+		CHECK_MESSAGE(json_utf8.parse_utf8(input.to_utf8_buffer()) == OK, vformat("Parsing `%s` as UTF-8 should succeed.", input));
+		CHECK_MESSAGE(
+				json_utf8.get_data().hash_compare(json_string.get_data()),
+				vformat("Parsing `%s` as UTF-8 should return the same data as parsing it as a String.", input));
+	}
+
+	const String invalid_inputs[] = {
+		"",
+		"[1, 2",
+		R"({"key" 1})",
+		R"({"key": 1 "other": 2})",
+		"[1] 2",
+		"nul",
+		"12abc",
+		R"("unterminated)",
+		R"("\x")",
+		R"("\ud83d")",
+		"{\n\"a\":\n[1,\n2,,]}",
+	};
+
+	for (const String &input : invalid_inputs) {
+		JSON json;
+		CHECK_MESSAGE(json.parse_utf8(input.to_utf8_buffer()) == ERR_PARSE_ERROR, vformat("Parsing `%s` as UTF-8 should fail.", input));
+		CHECK_MESSAGE(json.get_data() == Variant(), vformat("Parsing `%s` as UTF-8 should not return data.", input));
+		CHECK_FALSE(json.get_error_message().is_empty());
+	}
+
+	JSON json;
+	json.parse_utf8(String("{\n\"a\":\n[1,\n2,,]}").to_utf8_buffer());
+	CHECK_MESSAGE(json.get_error_line() == 3, "The error line should be computed from the failing token.");
+
+	PackedByteArray with_bom = { 0xef, 0xbb, 0xbf, '[', '1', ']' };
+	CHECK(json.parse_utf8(with_bom, true) == OK);
+	CHECK(Array(json.get_data()).size() == 1);
+	CHECK(json.get_parsed_text() == "[1]");
+}
+
+TEST_CASE("[JSON] Parsing streams fed in chunks") {
+	const String input = R"({"id": 1, "tags": ["a", "b"]} ["\"]\"", {"x": [1, {}]}] "text" 42 )";
+	const PackedByteArray bytes = input.to_utf8_buffer();
+
+	for (int chunk_size : { 1, 3, 7, 64 }) {
+		JSON json;
+		json.begin_stream();
+		Array values;
+		for (int64_t i = 0; i < bytes.size(); i += chunk_size) {
+			Error err = json.feed_stream(bytes.slice(i, i + chunk_size));
+			while (err == OK) {
+				values.push_back(json.get_data());
+				err = json.feed_stream(PackedByteArray());
+			}
+			CHECK_MESSAGE(err == ERR_BUSY, "The stream should wait for more data.");
+		}
+		CHECK(json.finish_stream() == ERR_FILE_EOF);
+
+		REQUIRE_MESSAGE(values.size() == 4, vformat("Every value should be parsed with chunks of %d bytes.", chunk_size));
+		CHECK(int(Dictionary(values[0])["id"]) == 1);
+		CHECK(Array(values[1])[0] == "\"]\"");
+		CHECK(values[2] == "text");
+		CHECK(int(values[3]) == 42);
+	}
+
+	JSON json;
+	json.begin_stream();
+	CHECK(json.feed_stream(String("12").to_utf8_buffer()) == ERR_BUSY);
+	CHECK(json.feed_stream(String("34").to_utf8_buffer()) == ERR_BUSY);
+	CHECK_MESSAGE(json.finish_stream() == OK, "Finishing the stream should parse a trailing top-level number.");
+	CHECK(int(json.get_data()) == 1234);
+
+	json.begin_stream();
+	CHECK(json.feed_stream(String("[1, 2").to_utf8_buffer()) == ERR_BUSY);
+	CHECK(json.finish_stream() == ERR_PARSE_ERROR);
+	CHECK(json.get_error_message() == "Expected ']'");
+}
+
 TEST_CASE("[JSON] Serialization") {
 	JSON json;
 
@@ -116,4 +116,64 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Read packed files through PackedData, with and without memory mapping") {
+	const String source_path = TestUtils::get_temp_path("pck_mapped_source.bin");
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped.pck");
+
+	Vector<uint8_t> source_data;
+	source_data.resize(100000);
+	for (int i = 0; i < source_data.size(); i++) {
+		source_data.write[i] = uint8_t((i * 31) ^ (i >> 8));
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(source_data);
+	}
+
+	PCKPacker pck_packer;
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("res://pck_mapped_test/data.bin", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data != nullptr);
+	REQUIRE(packed_data->add_pack(output_pck_path, true, 0) == OK);
+
+	for (bool use_memory_mapping : { true, false }) {
+		packed_data->set_use_memory_mapping(use_memory_mapping);
+
+		Ref<FileAccess> f = FileAccess::open("res://pck_mapped_test/data.bin", FileAccess::READ);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == uint64_t(source_data.size()));
+
+		Vector<uint8_t> read_data = f->get_buffer(source_data.size());
+		CHECK_MESSAGE(read_data == source_data, "Data read from the pack should match the source file.");
+		CHECK(f->get_buffer(16).is_empty());
+		CHECK(f->eof_reached());
+
+		f->seek(1000);
+		const uint8_t *borrowed = f->borrow_buffer(5000);
+		if (borrowed) {
+			CHECK_MESSAGE(use_memory_mapping, "Borrowing should only succeed on memory mapped packs.");
+			CHECK(memcmp(borrowed, source_data.ptr() + 1000, 5000) == 0);
+			CHECK(f->get_position() == 6000);
+			CHECK_MESSAGE(f->borrow_buffer(source_data.size()) == nullptr, "Borrowing past the end of the file should fail.");
+			CHECK(f->get_position() == 6000);
+		} else {
+			CHECK(f->get_position() == 1000);
+		}
+		uint64_t position = f->get_position();
+		CHECK(f->get_8() == source_data[position]);
+	}
+
+	packed_data->set_use_memory_mapping(true);
+
+	// Leave the global PackedData as it was for the other tests.
+	packed_data->remove_pack(output_pck_path);
+	CHECK_FALSE(packed_data->has_path("res://pck_mapped_test/data.bin"));
+	CHECK_FALSE(packed_data->has_directory("res://pck_mapped_test"));
+}
+
 } // namespace TestPCKPacker
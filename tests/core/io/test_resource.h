@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "scene/main/node.h"
@@ -627,4 +628,89 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+static String save_resource_chain(const String &p_file, int p_sub_resource_count, int p_floats_per_sub_resource) {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	Ref<Resource> previous;
+	for (int i = 0; i < p_sub_resource_count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		PackedFloat32Array data;
+		data.resize(p_floats_per_sub_resource);
+		data.fill(i);
+		child->set_meta("data", data);
+		if (previous.is_valid()) {
+			child->set_meta("previous", previous); // References between internal resources.
+		}
+		children.push_back(child);
+		previous = child;
+	}
+	resource->set_meta("children", children);
+
+	const String save_path = TestUtils::get_temp_path(p_file);
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+	return save_path;
+}
+
+static void check_loaded_resource_chain(const Ref<Resource> &p_loaded, int p_sub_resource_count, int p_floats_per_sub_resource) {
+	REQUIRE(p_loaded.is_valid());
+	CHECK(p_loaded->get_name() == "Root");
+
+	Array loaded_children = p_loaded->get_meta("children");
+	REQUIRE(loaded_children.size() == p_sub_resource_count);
+
+	bool all_match = true;
+	for (int i = 0; i < p_sub_resource_count; i++) {
+		// Reduce number of check messages.
+		Ref<Resource> child = loaded_children[i];
+		PackedFloat32Array data = child->get_meta("data");
+		Ref<Resource> child_previous = child->get_meta("previous", Variant());
+		all_match &= child->get_name() == vformat("Child %d", i);
+		all_match &= data.size() == p_floats_per_sub_resource && data[p_floats_per_sub_resource - 1] == i;
+		all_match &= i == 0 ? child_previous.is_null() : child_previous == loaded_children[i - 1];
+	}
+	CHECK(all_match);
+}
+
+TEST_CASE("[Resource] Binary loading with sub-threads decodes internal resources in parallel") {
+	// Just enough to go through the threaded path.
+	const int sub_resource_count = ResourceLoaderBinary::THREADED_DECODE_MIN_RESOURCES_PER_TASK * 2 + 1;
+	const int floats_per_sub_resource = 16;
+	const String save_path = save_resource_chain("threaded_decode_resource.res", sub_resource_count, floats_per_sub_resource);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+
+	for (int use_sub_threads = 0; use_sub_threads < 2; use_sub_threads++) {
+		Error err = FAILED;
+		Ref<Resource> loaded = loader->load(save_path, save_path, &err, use_sub_threads, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+		CHECK(err == OK);
+		check_loaded_resource_chain(loaded, sub_resource_count, floats_per_sub_resource);
+	}
+}
+
+TEST_CASE("[Resource][Benchmark] Binary loading with sub-threads" * doctest::skip()) {
+	const int sub_resource_count = 2000;
+	const int floats_per_sub_resource = 1024;
+	const String save_path = save_resource_chain("large_resource.res", sub_resource_count, floats_per_sub_resource);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+
+	uint64_t elapsed_usec[2] = {};
+	for (int use_sub_threads = 0; use_sub_threads < 2; use_sub_threads++) {
+		Error err = FAILED;
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		Ref<Resource> loaded = loader->load(save_path, save_path, &err, use_sub_threads, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+		elapsed_usec[use_sub_threads] = OS::get_singleton()->get_ticks_usec() - begin;
+
+		CHECK(err == OK);
+		check_loaded_resource_chain(loaded, sub_resource_count, floats_per_sub_resource);
+	}
+
+	MESSAGE(vformat("Loading %d internal resources: %d usec sequentially, %d usec with sub-threads.", sub_resource_count, elapsed_usec[0], elapsed_usec[1]));
+}
+
 } // namespace TestResource
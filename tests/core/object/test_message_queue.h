@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+static LocalVector<LocalVector<int>> received;
+static CallQueue *reentrant_queue = nullptr;
+
+static void record_message(int p_producer, int p_sequence) {
+	received[p_producer].push_back(p_sequence);
+}
+
+static void push_again(int p_remaining) {
+	received[0].push_back(p_remaining);
+	if (p_remaining > 0) {
+		reentrant_queue->push_callable(callable_mp_static(&push_again), p_remaining - 1);
+	}
+}
+
+struct ProducerData {
+	CallQueue *queue = nullptr;
+	int messages_per_producer = 0;
+};
+
+static void produce_messages(void *p_userdata, uint32_t p_producer) {
+	ProducerData *data = static_cast<ProducerData *>(p_userdata);
+	const Callable callable = callable_mp_static(&record_message);
+	for (int i = 0; i < data->messages_per_producer; i++) {
+		data->queue->push_callable(callable, int(p_producer), i);
+	}
+}
+
+static void produce_one_message(void *p_userdata) {
+	CallQueue *queue = static_cast<CallQueue *>(p_userdata);
+	queue->push_callable(callable_mp_static(&record_message), 0, 0);
+}
+
+static uint64_t push_from_producers(CallQueue *p_queue, int p_producers, int p_messages_per_producer) {
+	ProducerData data;
+	data.queue = p_queue;
+	data.messages_per_producer = p_messages_per_producer;
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&produce_messages, &data, p_producers, p_producers, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+TEST_CASE("[MessageQueue] Messages from many threads keep their per-thread order") {
+	const int producers = 8;
+	const int messages_per_producer = 2000;
+
+	CallQueue queue;
+	received.clear();
+	received.resize(producers);
+
+	push_from_producers(&queue, producers, messages_per_producer);
+	CHECK(queue.has_messages());
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+
+	bool ordered = true;
+	for (int i = 0; i < producers; i++) {
+		CHECK_MESSAGE(int(received[i].size()) == messages_per_producer, vformat("Producer %d should have delivered all of its messages.", i));
+		for (uint32_t j = 0; j < received[i].size(); j++) {
+			ordered = ordered && received[i][j] == int(j);
+		}
+	}
+	CHECK_MESSAGE(ordered, "Messages pushed by a thread should be flushed in the order they were pushed.");
+
+	received.clear();
+}
+
+TEST_CASE("[MessageQueue] Messages pushed while flushing are flushed too") {
+	CallQueue queue;
+	reentrant_queue = &queue;
+	received.clear();
+	received.resize(1);
+
+	queue.push_callable(callable_mp_static(&push_again), 3);
+	CHECK(queue.flush() == OK);
+
+	REQUIRE(received[0].size() == 4);
+	CHECK(received[0][0] == 3);
+	CHECK(received[0][3] == 0);
+	CHECK_FALSE(queue.has_messages());
+
+	reentrant_queue = nullptr;
+	received.clear();
+}
+
+TEST_CASE("[MessageQueue] Clearing drops messages from every thread") {
+	CallQueue queue;
+	received.clear();
+	received.resize(4);
+
+	push_from_producers(&queue, 4, 100);
+	CHECK(queue.has_messages());
+	queue.clear();
+	CHECK_FALSE(queue.has_messages());
+	CHECK(queue.flush() == OK);
+
+	for (const LocalVector<int> &messages : received) {
+		CHECK(messages.is_empty());
+	}
+	received.clear();
+}
+
+TEST_CASE("[MessageQueue] Threads that exited hand their buffers over") {
+	CallQueue queue;
+	received.clear();
+	received.resize(1);
+
+	for (int i = 0; i < 4; i++) {
+		Thread thread;
+		thread.start(&produce_one_message, &queue);
+		thread.wait_to_finish();
+	}
+	CHECK_MESSAGE(queue.get_max_buffer_usage() == CallQueue::PAGE_SIZE_BYTES, "Threads running one after the other should share a single buffer.");
+
+	CHECK(queue.flush() == OK);
+	CHECK(received[0].size() == 4);
+	received.clear();
+}
+
+TEST_CASE("[MessageQueue][Benchmark] Multi-producer push throughput" * doctest::skip()) {
+	const int messages_per_producer = 20000;
+	const int max_producers = MAX(1, MIN(8, OS::get_singleton()->get_processor_count()));
+
+	for (int producers = 1; producers <= max_producers; producers *= 2) {
+		CallQueue queue;
+		received.clear();
+		received.resize(producers);
+
+		const uint64_t usec = push_from_producers(&queue, producers, messages_per_producer);
+		queue.flush();
+
+		const double messages = double(producers) * messages_per_producer;
+		MESSAGE(vformat("%d producer(s): %d messages pushed in %d usec (%.1f messages/usec).", producers, int64_t(messages), usec, messages / MAX(uint64_t(1), usec)));
+	}
+	received.clear();
+}
+
+} // namespace TestMessageQueue
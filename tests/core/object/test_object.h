@@ -33,6 +33,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -457,6 +458,86 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+class SignalReceiver : public Object {
+public:
+	int calls = 0;
+	Object *emitter = nullptr;
+	SignalReceiver *disconnect_on_call = nullptr;
+	SignalReceiver *connect_on_call = nullptr;
+
+	void on_signal() {
+		calls++;
+		if (disconnect_on_call) {
+			emitter->disconnect("my_custom_signal", callable_mp(disconnect_on_call, &SignalReceiver::on_signal));
+			disconnect_on_call = nullptr;
+		}
+		if (connect_on_call) {
+			emitter->connect("my_custom_signal", callable_mp(connect_on_call, &SignalReceiver::on_signal));
+			connect_on_call = nullptr;
+		}
+	}
+};
+
+TEST_CASE("[Object] Connections changed during emission apply to the next emission") {
+	Object object;
+	object.add_user_signal(MethodInfo("my_custom_signal"));
+
+	SignalReceiver first;
+	SignalReceiver second;
+	SignalReceiver third;
+	SignalReceiver one_shot;
+	first.emitter = &object;
+	first.disconnect_on_call = &second;
+	first.connect_on_call = &third;
+
+	object.connect("my_custom_signal", callable_mp(&first, &SignalReceiver::on_signal));
+	object.connect("my_custom_signal", callable_mp(&second, &SignalReceiver::on_signal));
+	object.connect("my_custom_signal", callable_mp(&one_shot, &SignalReceiver::on_signal), Object::CONNECT_ONE_SHOT);
+
+	object.emit_signal("my_custom_signal");
+	CHECK(first.calls == 1);
+	CHECK_MESSAGE(second.calls == 1, "A slot disconnected during emission should still be called by that emission.");
+	CHECK_MESSAGE(third.calls == 0, "A slot connected during emission should not be called by that emission.");
+	CHECK(one_shot.calls == 1);
+
+	object.emit_signal("my_custom_signal");
+	CHECK(first.calls == 2);
+	CHECK(second.calls == 1);
+	CHECK(third.calls == 1);
+	CHECK(one_shot.calls == 1);
+	CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&one_shot, &SignalReceiver::on_signal)));
+}
+
+TEST_CASE("[Object][Benchmark] Signal emission throughput" * doctest::skip()) {
+	const int emissions = 20000;
+
+	for (int connections = 1; connections <= 64; connections *= 4) {
+		Object object;
+		object.add_user_signal(MethodInfo("my_custom_signal"));
+
+		LocalVector<SignalReceiver> receivers;
+		receivers.resize(connections);
+		for (SignalReceiver &receiver : receivers) {
+			object.connect("my_custom_signal", callable_mp(&receiver, &SignalReceiver::on_signal));
+		}
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emissions; i++) {
+			object.emit_signal("my_custom_signal");
+		}
+		const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		bool all_called = true;
+		for (const SignalReceiver &receiver : receivers) {
+			all_called = all_called && receiver.calls == emissions;
+		}
+		CHECK(all_called);
+
+		const double calls = double(connections) * emissions;
+		MESSAGE(vformat("%d connection(s): %d emissions in %d usec (%.1f calls/usec).", connections, emissions, usec, calls / MAX(uint64_t(1), usec)));
+	}
+}
+
 class NotificationObjectSuperclass : public Object {
 	GDCLASS(NotificationObjectSuperclass, Object);
 
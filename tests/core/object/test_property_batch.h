@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*  test_property_batch.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/property_batch.h"
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
+#include "scene/resources/material.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPropertyBatch {
+
+TEST_CASE("[PropertyBatch] Setup") {
+	Ref<PropertyBatch> batch;
+	batch.instantiate();
+	CHECK_FALSE(batch->is_valid());
+
+	CHECK(batch->setup("Node2D", "position") == OK);
+	CHECK(batch->is_valid());
+	CHECK(batch->get_target_class() == "Node2D");
+	CHECK(batch->get_property() == "position");
+	CHECK(batch->get_property_type() == Variant::VECTOR2);
+
+	ERR_PRINT_OFF;
+	CHECK(batch->setup("Node2D", "no_such_property") == ERR_INVALID_PARAMETER);
+	CHECK_FALSE(batch->is_valid());
+	CHECK(batch->setup("NoSuchClass", "position") == ERR_INVALID_PARAMETER);
+	CHECK(batch->set_all(Array(), Vector2()) == ERR_UNCONFIGURED);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[PropertyBatch] Set values on many objects") {
+	const int count = 64;
+	Array nodes;
+	PackedVector2Array positions;
+	for (int i = 0; i < count; i++) {
+		nodes.push_back(memnew(Node2D));
+		positions.push_back(Vector2(i, -i));
+	}
+
+	Ref<PropertyBatch> batch;
+	batch.instantiate();
+	REQUIRE(batch->setup("Node2D", "position") == OK);
+
+	SUBCASE("From a packed array") {
+		CHECK(batch->set_values(nodes, positions) == OK);
+		for (int i = 0; i < count; i++) {
+			CHECK(Object::cast_to<Node2D>(nodes[i])->get_position() == Vector2(i, -i));
+		}
+	}
+
+	SUBCASE("From an array with values that need converting") {
+		REQUIRE(batch->setup("Node2D", "rotation") == OK);
+		Array rotations;
+		for (int i = 0; i < count; i++) {
+			rotations.push_back(i % 2 ? Variant(1) : Variant(0.5));
+		}
+		CHECK(batch->set_values(nodes, rotations) == OK);
+		for (int i = 0; i < count; i++) {
+			CHECK(Object::cast_to<Node2D>(nodes[i])->get_rotation() == doctest::Approx(i % 2 ? 1.0 : 0.5));
+		}
+	}
+
+	SUBCASE("Same value for every object") {
+		CHECK(batch->set_all(nodes, Vector2(3, 4)) == OK);
+		for (int i = 0; i < count; i++) {
+			CHECK(Object::cast_to<Node2D>(nodes[i])->get_position() == Vector2(3, 4));
+		}
+	}
+
+	SUBCASE("Mismatched sizes and invalid objects") {
+		ERR_PRINT_OFF;
+		CHECK(batch->set_values(nodes, PackedVector2Array()) == ERR_INVALID_PARAMETER);
+		Array with_null = nodes.duplicate();
+		with_null[0] = Variant();
+		CHECK(batch->set_all(with_null, Vector2(5, 6)) == ERR_INVALID_PARAMETER);
+		ERR_PRINT_ON;
+		CHECK(Object::cast_to<Node2D>(nodes[1])->get_position() == Vector2(5, 6));
+	}
+
+	for (int i = 0; i < count; i++) {
+		memdelete(Object::cast_to<Node2D>(nodes[i]));
+	}
+}
+
+TEST_CASE("[PropertyBatch] Indexed properties and derived classes") {
+	Control *control = memnew(Control);
+	Control *other = memnew(Control);
+	Array controls = { control, other };
+
+	Ref<PropertyBatch> batch;
+	batch.instantiate();
+	REQUIRE(batch->setup("Control", "offset_right") == OK);
+	CHECK(batch->set_values(controls, PackedFloat32Array({ 10, 20 })) == OK);
+	CHECK(control->get_offset(SIDE_RIGHT) == doctest::Approx(10));
+	CHECK(other->get_offset(SIDE_RIGHT) == doctest::Approx(20));
+	CHECK(control->get_offset(SIDE_LEFT) == doctest::Approx(0));
+
+	// Properties inherited from CanvasItem are resolved against the derived class.
+	REQUIRE(batch->setup("CanvasItem", "modulate") == OK);
+	CHECK(batch->set_all(controls, Color(1, 0, 0)) == OK);
+	CHECK(control->get_modulate() == Color(1, 0, 0));
+
+	memdelete(control);
+	memdelete(other);
+}
+
+TEST_CASE("[PropertyBatch] Object values of the wrong class") {
+	Node2D *node = memnew(Node2D);
+	Array nodes = { node };
+	Ref<ShaderMaterial> material;
+	material.instantiate();
+	Ref<Resource> not_a_material;
+	not_a_material.instantiate();
+
+	Ref<PropertyBatch> batch;
+	batch.instantiate();
+	REQUIRE(batch->setup("CanvasItem", "material") == OK);
+	CHECK(batch->set_all(nodes, material) == OK);
+	CHECK(node->get_material() == material);
+
+	// Must not reach the setter as a Material.
+	CHECK(batch->set_all(nodes, not_a_material) == OK);
+	CHECK(node->get_material().is_null());
+
+	memdelete(node);
+}
+
+TEST_CASE("[PropertyBatch][Benchmark] Batch versus per-object writes" * doctest::skip()) {
+	const int count = 10000;
+	Array nodes;
+	Array transforms;
+	for (int i = 0; i < count; i++) {
+		nodes.push_back(memnew(Node2D));
+		transforms.push_back(Transform2D(i * 0.001, Vector2(i, i)));
+	}
+	const StringName property = "transform";
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		Object *node = nodes[i];
+		node->set(property, transforms[i]);
+	}
+	const uint64_t per_object_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	Ref<PropertyBatch> batch;
+	batch.instantiate();
+	REQUIRE(batch->setup("Node2D", property) == OK);
+	begin = OS::get_singleton()->get_ticks_usec();
+	CHECK(batch->set_values(nodes, transforms) == OK);
+	const uint64_t batch_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	CHECK(Object::cast_to<Node2D>(nodes[count - 1])->get_position() == Vector2(count - 1, count - 1));
+	MESSAGE(vformat("%d writes: Object::set() took %d usec, PropertyBatch took %d usec.", count, per_object_usec, batch_usec));
+
+	for (int i = 0; i < count; i++) {
+		memdelete(Object::cast_to<Node2D>(nodes[i]));
+	}
+}
+
+} // namespace TestPropertyBatch
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+struct InternData {
+	Vector<String> names;
+	LocalVector<LocalVector<StringName>> interned;
+	int rounds = 1;
+};
+
+static void intern_names(void *p_userdata, uint32_t p_thread) {
+	InternData *data = static_cast<InternData *>(p_userdata);
+	LocalVector<StringName> &interned = data->interned[p_thread];
+	for (int round = 0; round < data->rounds; round++) {
+		interned.clear();
+		for (const String &name : data->names) {
+			interned.push_back(StringName(name));
+		}
+	}
+}
+
+static uint64_t intern_from_threads(InternData &r_data, int p_threads) {
+	r_data.interned.clear();
+	r_data.interned.resize(p_threads);
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&intern_names, &r_data, p_threads, p_threads, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+static Vector<String> make_names(const String &p_prefix, int p_count) {
+	Vector<String> names;
+	for (int i = 0; i < p_count; i++) {
+		names.push_back(p_prefix + itos(i));
+	}
+	return names;
+}
+
+TEST_CASE("[StringName] Equal names interned from many threads share their data") {
+	InternData data;
+	data.names = make_names("test_string_name_shared_", 4096);
+
+	intern_from_threads(data, 8);
+
+	bool all_equal = true;
+	for (uint32_t i = 1; i < data.interned.size(); i++) {
+		for (int j = 0; j < data.names.size(); j++) {
+			all_equal = all_equal && data.interned[i][j] == data.interned[0][j];
+		}
+	}
+	CHECK_MESSAGE(all_equal, "Every thread should get the same StringName for the same string.");
+
+	for (int j = 0; j < data.names.size(); j++) {
+		CHECK(data.interned[0][j] == data.names[j]);
+		CHECK(StringName(data.names[j]) == data.interned[0][j]);
+	}
+}
+
+TEST_CASE("[StringName] Names released concurrently can be interned again") {
+	InternData data;
+	data.names = make_names("test_string_name_released_", 1024);
+	// Each round drops the names interned by the previous one, so threads keep
+	// releasing and re-creating entries while others look them up.
+	data.rounds = 16;
+
+	intern_from_threads(data, 8);
+	data.interned.clear();
+
+	for (const String &name : data.names) {
+		const StringName a = name;
+		const StringName b = name.utf8().get_data();
+		CHECK(a == b);
+		CHECK(a == name);
+	}
+}
+
+TEST_CASE("[StringName][Benchmark] Multi-threaded interning throughput" * doctest::skip()) {
+	InternData data;
+	data.names = make_names("test_string_name_benchmark_", 4096);
+	data.rounds = 8;
+	const int max_threads = MAX(1, MIN(8, OS::get_singleton()->get_processor_count()));
+
+	// Keep the names alive, so the benchmark measures lookups of already interned names.
+	LocalVector<StringName> keep_alive;
+	for (const String &name : data.names) {
+		keep_alive.push_back(name);
+	}
+
+	for (int threads = 1; threads <= max_threads; threads *= 2) {
+		const uint64_t usec = intern_from_threads(data, threads);
+		const double lookups = double(threads) * data.rounds * data.names.size();
+		MESSAGE(vformat("%d thread(s): %d lookups in %d usec (%.1f lookups/usec).", threads, int64_t(lookups), usec, lookups / MAX(uint64_t(1), usec)));
+	}
+	data.interned.clear();
+}
+
+} // namespace TestStringName
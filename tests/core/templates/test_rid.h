@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
@@ -115,6 +117,46 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
 
+TEST_CASE("[RID_Owner] Iterating owned elements") {
+	// Small chunks, so the elements span several of them.
+	RID_Owner<int, true> owner(sizeof(int) * 8);
+
+	LocalVector<RID> rids;
+	for (int i = 0; i < 100; i++) {
+		rids.push_back(owner.make_rid(i));
+		REQUIRE(rids[i].is_valid());
+	}
+	CHECK(owner.get_rid_count() == 100);
+	CHECK(*owner.get_or_null(rids[42]) == 42);
+
+	int sum = 0;
+	uint32_t visited = 0;
+	owner.for_each_owned([&](const RID &p_rid, int *p_value) {
+		CHECK(owner.owns(p_rid));
+		sum += *p_value;
+		visited++;
+	});
+	CHECK(visited == 100);
+	CHECK(sum == 99 * 100 / 2);
+
+	for (uint32_t i = 0; i < 50; i++) {
+		owner.free(rids[i]);
+	}
+	visited = 0;
+	owner.for_each_owned([&](const RID &p_rid, int *p_value) {
+		visited++;
+	});
+	CHECK(visited == 50);
+	CHECK(owner.get_or_null(rids[0]) == nullptr);
+	CHECK_FALSE(owner.owns(rids[49]));
+	CHECK(*owner.get_or_null(rids[50]) == 50);
+
+	for (uint32_t i = 50; i < 100; i++) {
+		owner.free(rids[i]);
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
+
 #ifdef THREADS_ENABLED
 // This case would let sanitizers realize data races.
 // Additionally, on purely weakly ordered architectures, it would detect synchronization issues
@@ -251,6 +293,63 @@ TEST_CASE("[RID_Owner] Thread safety") {
 		tester.test();
 	}
 }
+
+struct LookupData {
+	RID_Owner<uint64_t, true> owner;
+	LocalVector<RID> rids;
+	int rounds = 0;
+	std::atomic<uint64_t> found = 0;
+};
+
+static void lookup_or_churn(void *p_userdata, uint32_t p_index) {
+	LookupData *data = static_cast<LookupData *>(p_userdata);
+	if (p_index == 0) {
+		// One thread keeps allocating and freeing, like a server creating resources.
+		RID batch[64];
+		for (int round = 0; round < data->rounds; round++) {
+			for (RID &rid : batch) {
+				rid = data->owner.make_rid(0);
+			}
+			for (const RID &rid : batch) {
+				data->owner.free(rid);
+			}
+		}
+		return;
+	}
+	uint64_t found = 0;
+	for (int round = 0; round < data->rounds; round++) {
+		for (const RID &rid : data->rids) {
+			const uint64_t *value = data->owner.get_or_null(rid);
+			found += value && *value == rid.get_id();
+		}
+	}
+	data->found.fetch_add(found, std::memory_order_relaxed);
+}
+
+TEST_CASE("[RID_Owner][Benchmark] Lookups while another thread allocates" * doctest::skip()) {
+	const uint32_t threads = MAX(2, MIN(8, OS::get_singleton()->get_processor_count()));
+
+	LookupData data;
+	data.rounds = 200;
+	data.rids.resize(4096);
+	for (RID &rid : data.rids) {
+		rid = data.owner.allocate_rid();
+		data.owner.initialize_rid(rid, rid.get_id());
+	}
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&lookup_or_churn, &data, threads, threads, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	const uint64_t lookups = uint64_t(threads - 1) * data.rounds * data.rids.size();
+	CHECK(data.found.load() == lookups);
+	MESSAGE(vformat("%d lookups from %d threads in %d usec (%.1f lookups/usec).", lookups, threads - 1, usec, double(lookups) / MAX(uint64_t(1), usec)));
+
+	for (const RID &rid : data.rids) {
+		data.owner.free(rid);
+	}
+}
 #endif // THREADS_ENABLED
 
 } // namespace TestRID
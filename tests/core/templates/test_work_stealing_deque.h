@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner pops LIFO, thieves steal FIFO") {
+	WorkStealingDeque<uintptr_t, 8> deque;
+	CHECK(deque.is_empty());
+
+	for (uintptr_t i = 1; i <= 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size() == 4);
+
+	uintptr_t value = 0;
+	CHECK(deque.pop(value));
+	CHECK(value == 4);
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.steal(value));
+	CHECK(value == 2);
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Push fails when full") {
+	WorkStealingDeque<uintptr_t, 4> deque;
+	for (uintptr_t i = 1; i <= 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.push(5));
+
+	uintptr_t value = 0;
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.push(5)); // Room was made at the top end.
+
+	for (uintptr_t expected = 5; expected >= 2; expected--) {
+		CHECK(deque.pop(value));
+		CHECK(value == expected);
+	}
+	CHECK(deque.is_empty());
+}
+
+#ifdef THREADS_ENABLED
+TEST_CASE("[WorkStealingDeque] Every element is taken exactly once under concurrent stealing") {
+	static const uint32_t ELEMENTS = 100000;
+	static const uint32_t THIEVES = 4;
+
+	struct Context {
+		WorkStealingDeque<uintptr_t, 256> deque;
+		LocalVector<SafeNumeric<uint32_t>> taken;
+		SafeFlag done;
+	} ctx;
+	ctx.taken.resize(ELEMENTS);
+
+	Thread thieves[THIEVES];
+	for (Thread &thief : thieves) {
+		thief.start(
+				[](void *p_ud) {
+					Context *c = (Context *)p_ud;
+					uintptr_t value = 0;
+					while (!c->done.is_set() || !c->deque.is_empty()) {
+						if (c->deque.steal(value)) {
+							c->taken[value].increment();
+						}
+					}
+				},
+				&ctx);
+	}
+
+	uintptr_t value = 0;
+	for (uintptr_t i = 0; i < ELEMENTS; i++) {
+		while (!ctx.deque.push(i)) {
+			// Full; do some work ourselves to make room.
+			if (ctx.deque.pop(value)) {
+				ctx.taken[value].increment();
+			}
+		}
+		if (i % 3 == 0 && ctx.deque.pop(value)) {
+			ctx.taken[value].increment();
+		}
+	}
+	while (ctx.deque.pop(value)) {
+		ctx.taken[value].increment();
+	}
+	ctx.done.set();
+
+	for (Thread &thief : thieves) {
+		thief.wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < ELEMENTS; i++) {
+		// Reduce number of check messages.
+		all_taken_once &= ctx.taken[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+}
+#endif // THREADS_ENABLED
+
+} // namespace TestWorkStealingDeque
@@ -172,4 +172,176 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+struct GraphWork {
+	SafeNumeric<uint32_t> clock;
+	uint32_t stamps[4] = {};
+	LocalVector<SafeNumeric<uint32_t>> elements_stamp;
+	SafeNumeric<uint32_t> continuations;
+
+	void stamp_node(uint32_t p_node) {
+		stamps[p_node] = clock.increment();
+	}
+	void stamp_element(uint32_t p_index, uint32_t p_unused) {
+		elements_stamp[p_index].set(clock.increment());
+	}
+};
+
+static void static_graph_node_0(void *p_arg) {
+	((GraphWork *)p_arg)->stamp_node(0);
+}
+static void static_graph_node_1(void *p_arg) {
+	((GraphWork *)p_arg)->stamp_node(1);
+}
+static GraphWork *callable_graph_work = nullptr;
+static void static_callable_graph_node_3() {
+	callable_graph_work->stamp_node(3);
+}
+static void static_graph_continuation(void *p_arg) {
+	((GraphWork *)p_arg)->continuations.increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Run a task graph respecting dependencies") {
+	const uint32_t elements = 100;
+
+	GraphWork work;
+	work.elements_stamp.resize(elements);
+	callable_graph_work = &work;
+
+	// A diamond: node 0 first, then 1 and the group in parallel, then 3.
+	WorkerThreadPool::TaskGraph graph;
+	WorkerThreadPool::TaskGraph::NodeID first = graph.add_native_task(static_graph_node_0, &work);
+	WorkerThreadPool::TaskGraph::NodeID left = graph.add_native_task(static_graph_node_1, &work);
+	WorkerThreadPool::TaskGraph::NodeID right = graph.add_template_group_task(&work, &GraphWork::stamp_element, 0u, elements);
+	WorkerThreadPool::TaskGraph::NodeID last = graph.add_task(callable_mp_static(static_callable_graph_node_3));
+	graph.add_dependency(left, first);
+	graph.add_dependency(right, first);
+	graph.add_dependency(last, left);
+	graph.add_dependency(last, right);
+	graph.set_continuation(static_graph_continuation, &work);
+	CHECK(graph.get_node_count() == 4);
+
+	// Graphs can be run again once complete.
+	for (int run = 0; run < 3; run++) {
+		WorkerThreadPool::TaskGraphID id = WorkerThreadPool::get_singleton()->run_task_graph(graph, true);
+		REQUIRE(id != WorkerThreadPool::INVALID_TASK_ID);
+		CHECK(WorkerThreadPool::get_singleton()->wait_for_task_graph_completion(id) == OK);
+
+		CHECK(work.continuations.get() == (uint32_t)run + 1);
+		CHECK(work.stamps[0] < work.stamps[1]);
+		CHECK(work.stamps[1] < work.stamps[3]);
+
+		bool group_ordered = true;
+		for (uint32_t i = 0; i < elements; i++) {
+			// Reduce number of check messages.
+			group_ordered &= work.stamps[0] < work.elements_stamp[i].get() && work.elements_stamp[i].get() < work.stamps[3];
+		}
+		CHECK(group_ordered);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Task graph edge cases") {
+	GraphWork work;
+
+	SUBCASE("Empty graph completes right away") {
+		WorkerThreadPool::TaskGraph graph;
+		graph.set_continuation(static_graph_continuation, &work);
+		WorkerThreadPool::TaskGraphID id = WorkerThreadPool::get_singleton()->run_task_graph(graph);
+		CHECK(WorkerThreadPool::get_singleton()->is_task_graph_completed(id));
+		CHECK(WorkerThreadPool::get_singleton()->wait_for_task_graph_completion(id) == OK);
+		CHECK(work.continuations.get() == 1);
+	}
+
+	SUBCASE("Empty group still releases its dependents") {
+		WorkerThreadPool::TaskGraph graph;
+		WorkerThreadPool::TaskGraph::NodeID empty = graph.add_template_group_task(&work, &GraphWork::stamp_element, 0u, 0);
+		WorkerThreadPool::TaskGraph::NodeID after = graph.add_native_task(static_graph_node_1, &work);
+		graph.add_dependency(after, empty);
+		WorkerThreadPool::TaskGraphID id = WorkerThreadPool::get_singleton()->run_task_graph(graph);
+		CHECK(WorkerThreadPool::get_singleton()->wait_for_task_graph_completion(id) == OK);
+		CHECK(work.stamps[1] != 0);
+	}
+
+	SUBCASE("Cycles are rejected") {
+		WorkerThreadPool::TaskGraph graph;
+		WorkerThreadPool::TaskGraph::NodeID a = graph.add_native_task(static_graph_node_0, &work);
+		WorkerThreadPool::TaskGraph::NodeID b = graph.add_native_task(static_graph_node_1, &work);
+		graph.add_dependency(a, b);
+		graph.add_dependency(b, a);
+		ERR_PRINT_OFF;
+		CHECK(WorkerThreadPool::get_singleton()->run_task_graph(graph) == WorkerThreadPool::INVALID_TASK_ID);
+		ERR_PRINT_ON;
+		CHECK(work.clock.get() == 0);
+	}
+}
+
+struct NestedWork {
+	WorkerThreadPool *pool = nullptr;
+	SafeNumeric<uint32_t> leaves_run;
+	SafeNumeric<uint32_t> elements_run;
+};
+
+static const int NESTED_LEAVES = 16;
+static const int NESTED_ELEMENTS = 64;
+
+static void static_nested_leaf(void *p_arg) {
+	((NestedWork *)p_arg)->leaves_run.increment();
+}
+
+static void static_nested_group_element(void *p_arg, uint32_t p_index) {
+	((NestedWork *)p_arg)->elements_run.increment();
+}
+
+static void static_nested_root(void *p_arg) {
+	NestedWork *work = (NestedWork *)p_arg;
+	WorkerThreadPool::TaskID leaves[NESTED_LEAVES];
+	for (int i = 0; i < NESTED_LEAVES; i++) {
+		leaves[i] = work->pool->add_native_task(static_nested_leaf, work, true);
+	}
+	for (int i = 0; i < NESTED_LEAVES; i++) {
+		work->pool->wait_for_task_completion(leaves[i]);
+	}
+}
+
+// Not a strict benchmark (it'd be too noisy to assert on timings), but it reports
+// how both schedulers fare on a workload of tasks spawning more tasks, which is where
+// the shared queue sees the most contention.
+TEST_CASE("[WorkerThreadPool][Benchmark] Compare schedulers with tasks spawning nested tasks" * doctest::skip()) {
+	const int roots = 256;
+
+	uint64_t elapsed_usec[2] = {};
+	for (int mode = 0; mode < 2; mode++) {
+		const bool work_stealing = mode == 1;
+
+		WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+		pool->init(-1, 0.3, work_stealing);
+		CHECK(pool->is_using_work_stealing() == work_stealing);
+
+		NestedWork work;
+		work.pool = pool;
+
+		LocalVector<WorkerThreadPool::TaskID> root_tasks;
+		root_tasks.resize(roots);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < roots; i++) {
+			root_tasks[i] = pool->add_native_task(static_nested_root, &work, true);
+		}
+		for (int i = 0; i < roots; i++) {
+			pool->wait_for_task_completion(root_tasks[i]);
+		}
+		for (int i = 0; i < roots; i++) {
+			WorkerThreadPool::GroupID group = pool->add_native_group_task(static_nested_group_element, &work, NESTED_ELEMENTS, -1, true);
+			pool->wait_for_group_task_completion(group);
+		}
+		elapsed_usec[mode] = OS::get_singleton()->get_ticks_usec() - begin;
+
+		CHECK(work.leaves_run.get() == (uint32_t)(roots * NESTED_LEAVES));
+		CHECK(work.elements_run.get() == (uint32_t)(roots * NESTED_ELEMENTS));
+
+		memdelete(pool);
+	}
+
+	MESSAGE(vformat("Shared queue: %d usec. Work stealing: %d usec.", elapsed_usec[0], elapsed_usec[1]));
+}
+
 } // namespace TestWorkerThreadPool
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/object/class_db.h"
+#include "scene/2d/cpu_particles_2d.h"
 #include "scene/main/node.h"
 #include "scene/resources/packed_scene.h"
 
@@ -842,6 +843,103 @@ TEST_CASE("[SceneTree][Node] Test the processing") {
 	memdelete(node);
 }
 
+static LocalVector<uint32_t> process_batch_sizes;
+
+static void process_test_node_batch(Node *const *p_nodes, uint32_t p_count, int p_notification) {
+	process_batch_sizes.push_back(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		p_nodes[i]->notification(p_notification);
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Test batched processing") {
+	SceneTree::register_process_batch_func(TestNode::get_class_static(), &process_test_node_batch);
+	process_batch_sizes.clear();
+
+	List<Node *> process_order;
+	TestNode *node = memnew(TestNode);
+	TestNode *node2 = memnew(TestNode);
+	Node *plain_node = memnew(Node);
+	TestNode *node3 = memnew(TestNode);
+	TestNode *node4 = memnew(TestNode);
+	TestNode *node5 = memnew(TestNode);
+	for (Node *n : { (Node *)node, (Node *)node2, plain_node, (Node *)node3, (Node *)node4, (Node *)node5 }) {
+		SceneTree::get_singleton()->get_root()->add_child(n);
+	}
+	for (TestNode *n : { node, node2, node5 }) {
+		n->set_process(true);
+	}
+	for (TestNode *n : { node3, node4, node5 }) {
+		n->set_process_internal(true);
+	}
+	plain_node->set_process(true);
+	for (TestNode *n : { node, node2, node3, node4, node5 }) {
+		n->callback_list = &process_order;
+	}
+
+	SceneTree::get_singleton()->process(0);
+
+	// The node in the middle splits the batch, so that the processing order is kept. A node with
+	// both internal and regular processing is notified on its own, so that its two notifications
+	// stay back to back.
+	REQUIRE_EQ(process_batch_sizes.size(), 2u);
+	CHECK_EQ(process_batch_sizes[0], 2u); // Process of node and node2.
+	CHECK_EQ(process_batch_sizes[1], 2u); // Internal process of node3 and node4.
+
+	CHECK_EQ(node->process_counter, 1);
+	CHECK_EQ(node3->internal_process_counter, 1);
+	CHECK_EQ(node5->internal_process_counter, 1);
+	CHECK_EQ(node5->process_counter, 1);
+
+	REQUIRE_EQ(process_order.size(), 6);
+	List<Node *>::Element *E = process_order.front();
+	for (Node *expected : { (Node *)node, (Node *)node2, (Node *)node3, (Node *)node4, (Node *)node5, (Node *)node5 }) {
+		CHECK_EQ(E->get(), expected);
+		E = E->next();
+	}
+
+	SceneTree::unregister_process_batch_func(TestNode::get_class_static());
+	process_batch_sizes.clear();
+	memdelete(node);
+	memdelete(node2);
+	memdelete(plain_node);
+	memdelete(node3);
+	memdelete(node4);
+	memdelete(node5);
+}
+
+static Node *particles_to_free = nullptr;
+
+static void free_particles_on_finished() {
+	if (particles_to_free) {
+		memdelete(particles_to_free);
+		particles_to_free = nullptr;
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Test freeing a node of the same batch on finished") {
+	CPUParticles2D *particles[2];
+	for (CPUParticles2D *&p : particles) {
+		p = memnew(CPUParticles2D);
+		p->set_one_shot(true);
+		p->set_lifetime(0.1);
+		p->set_use_fixed_seed(true);
+		SceneTree::get_singleton()->get_root()->add_child(p);
+		p->set_emitting(true);
+	}
+	particles_to_free = particles[1];
+	particles[0]->connect(SceneStringName(finished), callable_mp_static(&free_particles_on_finished));
+
+	// Both finish during the same batch, the second one must not be updated or notified after it is freed.
+	for (int i = 0; i < 10 && particles_to_free; i++) {
+		SceneTree::get_singleton()->process(0.05);
+	}
+	CHECK_EQ(particles_to_free, nullptr);
+
+	free_particles_on_finished();
+	memdelete(particles[0]);
+}
+
 TEST_CASE("[SceneTree][Node] Test the process priority") {
 	List<Node *> process_order;
 
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -215,6 +217,140 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+static Ref<PackedScene> pack_scene_with_children(int p_children) {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	for (int i = 0; i < p_children; i++) {
+		Node *child = memnew(Node);
+		child->set_name(vformat("Child%d", i));
+		scene->add_child(child);
+		child->set_owner(scene);
+	}
+	// Connect the first child to the root, so there is a connection to restore.
+	scene->get_child(0)->connect("renamed", Callable(scene, "update_configuration_warnings"), Object::CONNECT_PERSIST);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+	return packed_scene;
+}
+
+TEST_CASE("[PackedScene] Incremental instantiation") {
+	Ref<PackedScene> packed_scene = pack_scene_with_children(20);
+
+	Ref<SceneInstantiation> instantiation = packed_scene->instantiate_incremental();
+	REQUIRE(instantiation.is_valid());
+	CHECK(instantiation->get_status() == SceneInstantiation::STATUS_IN_PROGRESS);
+	CHECK(instantiation->get_progress() == 0.0);
+
+	// A zero budget performs a single step per call.
+	int calls = 0;
+	while (instantiation->process(0) == SceneInstantiation::STATUS_IN_PROGRESS) {
+		calls++;
+		CHECK(instantiation->get_progress() < 1.0);
+	}
+	CHECK_MESSAGE(calls > 20, "Each node should be built in its own step.");
+	CHECK(instantiation->get_status() == SceneInstantiation::STATUS_DONE);
+	CHECK(instantiation->get_progress() == 1.0);
+
+	Node *instance = instantiation->get_node();
+	REQUIRE(instance != nullptr);
+	CHECK_FALSE(instance->is_inside_tree());
+	CHECK(instance->get_name() == "TestScene");
+	CHECK(instance->get_child_count() == 20);
+	CHECK(instance->get_child(19)->get_name() == "Child19");
+	CHECK(instance->get_child(19)->get_owner() == instance);
+
+	List<Object::Connection> connections;
+	instance->get_child(0)->get_signal_connection_list("renamed", &connections);
+	bool connected = false;
+	for (const Object::Connection &connection : connections) {
+		connected = connected || connection.callable.get_object() == instance;
+	}
+	CHECK(connected);
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(instantiation->get_node() == nullptr, "The root should only be handed over once.");
+	ERR_PRINT_ON;
+
+	memdelete(instance);
+}
+
+TEST_CASE("[PackedScene] Canceled incremental instantiation frees its nodes") {
+	Ref<PackedScene> packed_scene = pack_scene_with_children(5);
+
+	Ref<SceneInstantiation> instantiation = packed_scene->instantiate_incremental();
+	REQUIRE(instantiation.is_valid());
+	CHECK(instantiation->process(0) == SceneInstantiation::STATUS_IN_PROGRESS);
+	CHECK(instantiation->process(0) == SceneInstantiation::STATUS_IN_PROGRESS);
+
+	const uint32_t objects_before = ObjectDB::get_object_count();
+	instantiation->cancel();
+	CHECK(ObjectDB::get_object_count() == objects_before - 2);
+	CHECK(instantiation->get_status() == SceneInstantiation::STATUS_FAILED);
+
+	ERR_PRINT_OFF;
+	CHECK(instantiation->get_node() == nullptr);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[PackedScene] Incremental instantiation with a large budget finishes in one call") {
+	Ref<PackedScene> packed_scene = pack_scene_with_children(5);
+
+	Ref<SceneInstantiation> instantiation = packed_scene->instantiate_incremental();
+	REQUIRE(instantiation.is_valid());
+	CHECK(instantiation->process(10000000) == SceneInstantiation::STATUS_DONE);
+
+	Node *instance = instantiation->get_node();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_child_count() == 5);
+	memdelete(instance);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Threaded instantiation") {
+	Ref<PackedScene> packed_scene = pack_scene_with_children(20);
+
+	Ref<SceneInstantiation> instantiation = packed_scene->instantiate_threaded();
+	REQUIRE(instantiation.is_valid());
+	CHECK(instantiation->wait() == SceneInstantiation::STATUS_DONE);
+	CHECK(instantiation->get_status() == SceneInstantiation::STATUS_DONE);
+	CHECK(instantiation->get_progress() == 1.0);
+
+	Node *instance = instantiation->get_node();
+	REQUIRE(instance != nullptr);
+	CHECK_FALSE(instance->is_inside_tree());
+	CHECK(instance->get_child_count() == 20);
+	CHECK(instance->get_child(19)->get_owner() == instance);
+	CHECK(instance->get_child(0)->is_connected("renamed", Callable(instance, "update_configuration_warnings")));
+
+	// Only entering the tree is left to the main thread.
+	SceneTree::get_singleton()->get_root()->add_child(instance);
+	CHECK(instance->is_inside_tree());
+	CHECK(instance->is_ready());
+	CHECK(instance->get_child(19)->is_ready());
+
+	memdelete(instance);
+}
+
+TEST_CASE("[PackedScene] Canceled threaded instantiation frees its nodes") {
+	Ref<PackedScene> packed_scene = pack_scene_with_children(200);
+
+	const uint32_t objects_before = ObjectDB::get_object_count();
+	Ref<SceneInstantiation> instantiation = packed_scene->instantiate_threaded();
+	REQUIRE(instantiation.is_valid());
+	instantiation->cancel();
+	CHECK(ObjectDB::get_object_count() == objects_before + 1); // Only the instantiation itself is left.
+
+	// The task may have finished before it was canceled.
+	const SceneInstantiation::Status status = instantiation->get_status();
+	CHECK((status == SceneInstantiation::STATUS_FAILED || status == SceneInstantiation::STATUS_DONE));
+
+	ERR_PRINT_OFF;
+	CHECK(instantiation->get_node() == nullptr);
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -30,7 +30,12 @@
 
 #pragma once
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "scene/main/scene_tree.h"
 #include "scene/main/timer.h"
+#include "scene/main/timer_wheel.h"
+#include "scene/main/window.h"
 
 #include "tests/test_macros.h"
 
@@ -203,4 +208,184 @@ TEST_CASE("[SceneTree][Timer] Check Timer timeout signal") {
 	memdelete(test_timer);
 }
 
+TEST_CASE("[SceneTree][Timer] Repeating timer keeps its phase") {
+	Timer *test_timer = memnew(Timer);
+	SceneTree::get_singleton()->get_root()->add_child(test_timer);
+
+	SIGNAL_WATCH(test_timer, SNAME("timeout"));
+	test_timer->start(0.25);
+
+	SceneTree::get_singleton()->process(0.3);
+	SIGNAL_CHECK(SNAME("timeout"), Array{ {} });
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 0.2));
+
+	SceneTree::get_singleton()->process(0.1);
+	SIGNAL_CHECK_FALSE(SNAME("timeout"));
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 0.1));
+
+	SIGNAL_UNWATCH(test_timer, SNAME("timeout"));
+	memdelete(test_timer);
+}
+
+TEST_CASE("[SceneTree][Timer] Timer doesn't count down while it can't process") {
+	Timer *test_timer = memnew(Timer);
+	SceneTree::get_singleton()->get_root()->add_child(test_timer);
+	test_timer->start(1.0);
+
+	SceneTree::get_singleton()->set_pause(true);
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 1.0));
+	SceneTree::get_singleton()->set_pause(false);
+
+	test_timer->set_process_mode(Node::PROCESS_MODE_DISABLED);
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 1.0));
+	test_timer->set_process_mode(Node::PROCESS_MODE_INHERIT);
+
+	test_timer->set_paused(true);
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 1.0));
+	test_timer->set_paused(false);
+
+	SceneTree::get_singleton()->get_root()->remove_child(test_timer);
+	SceneTree::get_singleton()->process(0.5);
+	SceneTree::get_singleton()->get_root()->add_child(test_timer);
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 1.0));
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(Math::is_equal_approx(test_timer->get_time_left(), 0.5));
+
+	memdelete(test_timer);
+}
+
+static void restart_timer(void *p_timers, uint32_t p_index) {
+	Timer *timer = static_cast<Timer **>(p_timers)[p_index];
+	for (int i = 0; i < 100; i++) {
+		timer->start(1.0 + i);
+		timer->stop();
+	}
+	timer->start(2.0);
+}
+
+TEST_CASE("[SceneTree][Timer] Timers can be restarted from several threads") {
+	// Timer nodes of process thread groups share the tree's wheels with every other timer.
+	const int count = 64;
+	Timer *timers[count];
+	for (Timer *&timer : timers) {
+		timer = memnew(Timer);
+		SceneTree::get_singleton()->get_root()->add_child(timer);
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&restart_timer, timers, count);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	SceneTree::get_singleton()->process(1.0);
+	for (Timer *timer : timers) {
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 1.0));
+		memdelete(timer);
+	}
+}
+
+TEST_CASE("[SceneTree][SceneTreeTimer] Timeout and time left") {
+	Ref<SceneTreeTimer> timer = SceneTree::get_singleton()->create_timer(1.0);
+	Ref<SceneTreeTimer> pausable_timer = SceneTree::get_singleton()->create_timer(1.0, false);
+	SIGNAL_WATCH(timer.ptr(), SNAME("timeout"));
+
+	SceneTree::get_singleton()->process(0.25);
+	CHECK(Math::is_equal_approx(timer->get_time_left(), 0.75));
+
+	SUBCASE("Setting the time left moves the deadline") {
+		timer->set_time_left(2.0);
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 1.0));
+
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK(SNAME("timeout"), Array{ {} });
+		CHECK(timer->get_time_left() == 0.0);
+	}
+
+	SUBCASE("Pausable timers don't count down while paused") {
+		SceneTree::get_singleton()->set_pause(true);
+		SceneTree::get_singleton()->process(0.5);
+		SceneTree::get_singleton()->set_pause(false);
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 0.25));
+		CHECK(Math::is_equal_approx(pausable_timer->get_time_left(), 0.75));
+
+		SceneTree::get_singleton()->process(0.5);
+		SIGNAL_CHECK(SNAME("timeout"), Array{ {} });
+		CHECK(Math::is_equal_approx(pausable_timer->get_time_left(), 0.25));
+	}
+
+	SUBCASE("Timers in physics only count down on physics frames") {
+		timer->set_process_in_physics(true);
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 0.75));
+
+		SceneTree::get_singleton()->physics_process(1.0);
+		SIGNAL_CHECK(SNAME("timeout"), Array{ {} });
+	}
+
+	SIGNAL_UNWATCH(timer.ptr(), SNAME("timeout"));
+}
+
+TEST_CASE("[TimerWheel] Timers expire in order, regardless of how far they are") {
+	TimerWheel wheel;
+	const double delays[] = { 0.0, 0.01, 0.5, 3.0, 70.0, 5000.0, 1000000.0 };
+	TimerWheel::Entry entries[std_size(delays)];
+	for (uint32_t i = 0; i < std_size(delays); i++) {
+		wheel.schedule(&entries[i], delays[i]);
+	}
+	CHECK(wheel.get_count() == std_size(delays));
+
+	wheel.cancel(&entries[2]);
+	CHECK(wheel.get_count() == std_size(delays) - 1);
+
+	LocalVector<TimerWheel::Entry *> expired;
+	// Steps of a bit more than 1/60th of a second, but jump over the long pauses.
+	while (wheel.get_count() > 0) {
+		const double next = wheel.get_time() + 0.017;
+		wheel.advance(next < 4000.0 || next > 999990.0 ? 0.017 : 100.0);
+		while (TimerWheel::Entry *entry = wheel.pop_expired()) {
+			CHECK(entry->deadline <= wheel.get_time());
+			CHECK(entry->deadline > wheel.get_time() - 100.0);
+			expired.push_back(entry);
+		}
+	}
+
+	REQUIRE(expired.size() == std_size(delays) - 1);
+	for (uint32_t i = 1; i < expired.size(); i++) {
+		CHECK(expired[i - 1]->deadline < expired[i]->deadline);
+	}
+}
+
+TEST_CASE("[SceneTree][SceneTreeTimer][Benchmark] Processing many timers" * doctest::skip()) {
+	// With a timer wheel, frames should only cost what the expiring timers do,
+	// however many timers are waiting.
+	for (int count : { 1000, 10000, 100000 }) {
+		LocalVector<Ref<SceneTreeTimer>> timers;
+		timers.reserve(count);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			timers.push_back(SceneTree::get_singleton()->create_timer(1.0 + (i % 1000) * 0.1));
+		}
+		const uint64_t create_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		const int frames = 60;
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < frames; i++) {
+			SceneTree::get_singleton()->process(1.0 / 60.0);
+		}
+		const uint64_t process_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE(vformat("%d timers: %.3f usec per create_timer(), %.1f usec per frame.", count, double(create_usec) / count, double(process_usec) / frames));
+
+		// Let them all expire, so they don't leak into other tests.
+		timers.clear();
+		SceneTree::get_singleton()->process(101.0);
+	}
+}
+
 } // namespace TestTimer
@@ -41,15 +41,66 @@ class CallableMock : public Object {
 	GDCLASS(CallableMock, Object);
 
 public:
+	void function0() {
+		function0_calls++;
+	}
+
 	void function1(Variant arg0) {
 		function1_calls++;
 		function1_latest_arg0 = arg0;
 	}
 
+	unsigned function0_calls{ 0 };
 	unsigned function1_calls{ 0 };
 	Variant function1_latest_arg0;
 };
 
+static Ref<NavigationMesh> bake_box_navigation_mesh(NavigationServer3D *p_navigation_server, const Vector3 &p_size) {
+	Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+	Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+	Array arr;
+	arr.resize(RS::ARRAY_MAX);
+	BoxMesh::create_mesh_array(arr, p_size);
+	source_geometry->add_mesh_array(arr, Transform3D());
+	p_navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+	return navigation_mesh;
+}
+
+// Two synchronous maps with one region each on the same navigation mesh. Tests enable a
+// feature on the second map and compare its paths against the first one.
+static void create_map_pair(NavigationServer3D *p_navigation_server, const Ref<NavigationMesh> &p_navigation_mesh, RID r_maps[2], RID r_regions[2]) {
+	for (int i = 0; i < 2; i++) {
+		r_maps[i] = p_navigation_server->map_create();
+		r_regions[i] = p_navigation_server->region_create();
+		p_navigation_server->map_set_active(r_maps[i], true);
+		p_navigation_server->map_set_use_async_iterations(r_maps[i], false);
+		p_navigation_server->region_set_use_async_iterations(r_regions[i], false);
+		p_navigation_server->region_set_map(r_regions[i], r_maps[i]);
+		p_navigation_server->region_set_navigation_mesh(r_regions[i], p_navigation_mesh);
+	}
+}
+
+static void free_map_pair(NavigationServer3D *p_navigation_server, const RID p_maps[2], const RID p_regions[2]) {
+	for (int i = 0; i < 2; i++) {
+		p_navigation_server->free_rid(p_regions[i]);
+		p_navigation_server->free_rid(p_maps[i]);
+	}
+	p_navigation_server->physics_process(0.0); // Give server some cycles to commit.
+}
+
+static void query_path_on_map_pair(NavigationServer3D *p_navigation_server, const RID p_maps[2], const Vector3 &p_start_position, const Vector3 &p_target_position, Ref<NavigationPathQueryResult3D> r_query_results[2]) {
+	for (int i = 0; i < 2; i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(p_maps[i]);
+		query_parameters->set_start_position(p_start_position);
+		query_parameters->set_target_position(p_target_position);
+		r_query_results[i].instantiate();
+		p_navigation_server->query_path(query_parameters, r_query_results[i]);
+	}
+}
+
 TEST_SUITE("[Navigation3D]") {
 	TEST_CASE("[NavigationServer3D] Server should be empty when initialized") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -515,6 +566,191 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should keep avoiding obstacles that move between avoidance trees") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		RID agent_1 = navigation_server->agent_create();
+		RID obstacle_1 = navigation_server->obstacle_create();
+
+		navigation_server->map_set_active(map, true);
+
+		navigation_server->agent_set_map(agent_1, map);
+		navigation_server->agent_set_avoidance_enabled(agent_1, true);
+		navigation_server->agent_set_position(agent_1, Vector3(0, 0, 0));
+		navigation_server->agent_set_radius(agent_1, 1.6);
+		navigation_server->agent_set_velocity(agent_1, Vector3(1, 0, 0));
+		CallableMock agent_1_avoidance_callback_mock;
+		navigation_server->agent_set_avoidance_callback(agent_1, callable_mp(&agent_1_avoidance_callback_mock, &CallableMock::function1));
+
+		navigation_server->obstacle_set_map(obstacle_1, map);
+		navigation_server->obstacle_set_avoidance_enabled(obstacle_1, true);
+		PackedVector3Array obstacle_1_vertices;
+		obstacle_1_vertices.push_back(Vector3(1.5, 0, 0.5));
+		obstacle_1_vertices.push_back(Vector3(1.5, 0, 4.5));
+		navigation_server->obstacle_set_vertices(obstacle_1, obstacle_1_vertices);
+
+		// Unchanged obstacles move from the dynamic into the static obstacle tree after a number of syncs.
+		for (int i = 0; i <= NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT; i++) {
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			Vector3 agent_1_safe_velocity = agent_1_avoidance_callback_mock.function1_latest_arg0;
+			CHECK_MESSAGE(agent_1_safe_velocity.z < 0, "Agent 1 should avoid the obstacle in either obstacle tree.");
+		}
+		CHECK_EQ(agent_1_avoidance_callback_mock.function1_calls, NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT + 1);
+
+		// Moving the obstacle has to remove it from the static tree again.
+		navigation_server->obstacle_set_position(obstacle_1, Vector3(0, 0, 100));
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		Vector3 agent_1_safe_velocity = agent_1_avoidance_callback_mock.function1_latest_arg0;
+		CHECK_MESSAGE(agent_1_safe_velocity.z == 0, "Agent 1 should not avoid the moved obstacle.");
+
+		navigation_server->free_rid(obstacle_1);
+		navigation_server->free_rid(agent_1);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should keep avoiding a still obstacle over many syncs with a moving agent") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		RID agent_1 = navigation_server->agent_create();
+		RID obstacle_1 = navigation_server->obstacle_create();
+
+		navigation_server->map_set_active(map, true);
+
+		navigation_server->agent_set_map(agent_1, map);
+		navigation_server->agent_set_avoidance_enabled(agent_1, true);
+		navigation_server->agent_set_radius(agent_1, 1.6);
+		navigation_server->agent_set_velocity(agent_1, Vector3(1, 0, 0));
+		CallableMock agent_1_avoidance_callback_mock;
+		navigation_server->agent_set_avoidance_callback(agent_1, callable_mp(&agent_1_avoidance_callback_mock, &CallableMock::function1));
+
+		navigation_server->obstacle_set_map(obstacle_1, map);
+		navigation_server->obstacle_set_avoidance_enabled(obstacle_1, true);
+		PackedVector3Array obstacle_1_vertices;
+		obstacle_1_vertices.push_back(Vector3(1.5, 0, 0.5));
+		obstacle_1_vertices.push_back(Vector3(1.5, 0, 4.5));
+		navigation_server->obstacle_set_vertices(obstacle_1, obstacle_1_vertices);
+
+		// Long enough for the obstacle to settle in the static tree, and for the agent tree
+		// to go through several rebuilds after its maximum number of refits.
+		const int sync_count = 3 * MAX(NavigationDefaults3D::AVOIDANCE_OBSTACLE_STATIC_SYNC_COUNT, NavigationDefaults3D::AVOIDANCE_AGENT_TREE_MAX_REFITS);
+		bool avoided = true;
+		for (int i = 0; i < sync_count; i++) {
+			navigation_server->agent_set_position(agent_1, Vector3((i % 2) * -0.01, 0, 0));
+			navigation_server->physics_process(1.0 / 60.0);
+			Vector3 agent_1_safe_velocity = agent_1_avoidance_callback_mock.function1_latest_arg0;
+			// Reduce number of check messages.
+			avoided &= agent_1_safe_velocity.x > 0 && agent_1_safe_velocity.z < 0;
+		}
+		CHECK_MESSAGE(avoided, "Agent 1 should keep avoiding the still obstacle.");
+		CHECK_EQ(agent_1_avoidance_callback_mock.function1_calls, sync_count);
+
+		// Move both far away, the agent would no longer avoid the obstacle if its old position was kept.
+		navigation_server->obstacle_set_position(obstacle_1, Vector3(50, 0, 0));
+		navigation_server->agent_set_position(agent_1, Vector3(50, 0, 0));
+		navigation_server->physics_process(1.0 / 60.0);
+		Vector3 agent_1_safe_velocity = agent_1_avoidance_callback_mock.function1_latest_arg0;
+		CHECK_MESSAGE(agent_1_safe_velocity.x > 0, "Agent 1 should move a bit along desired velocity (+X).");
+		CHECK_MESSAGE(agent_1_safe_velocity.z < 0, "Agent 1 should avoid the moved obstacle.");
+
+		navigation_server->free_rid(obstacle_1);
+		navigation_server->free_rid(agent_1);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should avoid with many agents and moving obstacles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+
+		// A small version of the crowd scenario, large enough for the trees to have several levels.
+		const int agent_columns = 20;
+		const int agent_rows = 10;
+		const int obstacle_count = 50;
+
+		CallableMock agents_avoidance_callback_mock;
+		LocalVector<RID> agents;
+		for (int x = 0; x < agent_columns; x++) {
+			for (int z = 0; z < agent_rows; z++) {
+				RID agent = navigation_server->agent_create();
+				navigation_server->agent_set_map(agent, map);
+				navigation_server->agent_set_avoidance_enabled(agent, true);
+				navigation_server->agent_set_position(agent, Vector3(x * 2.0, 0, z * 2.0));
+				navigation_server->agent_set_neighbor_distance(agent, 5.0);
+				navigation_server->agent_set_velocity(agent, Vector3(1, 0, 0));
+				navigation_server->agent_set_avoidance_callback(agent, callable_mp(&agents_avoidance_callback_mock, &CallableMock::function1));
+				agents.push_back(agent);
+			}
+		}
+
+		PackedVector3Array obstacle_vertices;
+		obstacle_vertices.push_back(Vector3(-0.25, 0, -0.25));
+		obstacle_vertices.push_back(Vector3(-0.25, 0, 0.25));
+		obstacle_vertices.push_back(Vector3(0.25, 0, 0.25));
+		obstacle_vertices.push_back(Vector3(0.25, 0, -0.25));
+		LocalVector<RID> obstacles;
+		for (int i = 0; i < obstacle_count; i++) {
+			RID obstacle = navigation_server->obstacle_create();
+			navigation_server->obstacle_set_map(obstacle, map);
+			navigation_server->obstacle_set_avoidance_enabled(obstacle, true);
+			navigation_server->obstacle_set_position(obstacle, Vector3((i % 25) * 8.0 + 1.0, 0, (i / 25) * 5.0 + 1.0));
+			navigation_server->obstacle_set_vertices(obstacle, obstacle_vertices);
+			obstacles.push_back(obstacle);
+		}
+
+		// A probe agent away from the crowd that runs into a moving obstacle.
+		RID probe_agent = navigation_server->agent_create();
+		navigation_server->agent_set_map(probe_agent, map);
+		navigation_server->agent_set_avoidance_enabled(probe_agent, true);
+		navigation_server->agent_set_position(probe_agent, Vector3(-20, 0, -20));
+		navigation_server->agent_set_radius(probe_agent, 1.6);
+		navigation_server->agent_set_velocity(probe_agent, Vector3(1, 0, 0));
+		CallableMock probe_agent_avoidance_callback_mock;
+		navigation_server->agent_set_avoidance_callback(probe_agent, callable_mp(&probe_agent_avoidance_callback_mock, &CallableMock::function1));
+
+		RID probe_obstacle = navigation_server->obstacle_create();
+		navigation_server->obstacle_set_map(probe_obstacle, map);
+		navigation_server->obstacle_set_avoidance_enabled(probe_obstacle, true);
+		PackedVector3Array probe_obstacle_vertices;
+		probe_obstacle_vertices.push_back(Vector3(1.5, 0, 0.5));
+		probe_obstacle_vertices.push_back(Vector3(1.5, 0, 4.5));
+		navigation_server->obstacle_set_vertices(probe_obstacle, probe_obstacle_vertices);
+
+		const int frame_count = 5;
+		for (int frame = 0; frame < frame_count; frame++) {
+			for (uint32_t i = 0; i < obstacles.size(); i++) {
+				navigation_server->obstacle_set_position(obstacles[i], Vector3((i % 25) * 8.0 + 1.0 + frame * 0.1, 0, (i / 25) * 5.0 + 1.0));
+			}
+			for (uint32_t i = 0; i < agents.size(); i += 2) {
+				navigation_server->agent_set_position(agents[i], Vector3((i / agent_rows) * 2.0 + frame * 0.05, 0, (i % agent_rows) * 2.0));
+			}
+			navigation_server->agent_set_position(probe_agent, Vector3(-20, 0, -20));
+			navigation_server->obstacle_set_position(probe_obstacle, Vector3(-20, 0, -20 - (frame % 2) * 0.01));
+
+			navigation_server->physics_process(1.0 / 60.0);
+
+			Vector3 probe_agent_safe_velocity = probe_agent_avoidance_callback_mock.function1_latest_arg0;
+			CHECK_MESSAGE(probe_agent_safe_velocity.z < 0, "Probe agent should avoid the moving obstacle.");
+		}
+		CHECK_EQ(agents_avoidance_callback_mock.function1_calls, agents.size() * frame_count);
+		CHECK_EQ(probe_agent_avoidance_callback_mock.function1_calls, frame_count);
+
+		navigation_server->free_rid(probe_obstacle);
+		navigation_server->free_rid(probe_agent);
+		for (const RID &obstacle : obstacles) {
+			navigation_server->free_rid(obstacle);
+		}
+		for (const RID &agent : agents) {
+			navigation_server->free_rid(agent);
+		}
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 #ifndef DISABLE_DEPRECATED
 	// This test case uses only public APIs on purpose - other test cases use simplified baking.
 	// FIXME: Remove once deprecated `region_bake_navigation_mesh()` is removed.
@@ -798,6 +1034,372 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(query_result->get_path().size(), 0);
 		}
 
+		SUBCASE("Batched async queries should match synchronous queries") {
+			const int query_count = 64;
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			for (int i = 0; i < query_count; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters;
+				query_parameters.instantiate();
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(-4.5 + (i % 8), 0, -4.5));
+				query_parameters->set_target_position(Vector3(4.5, 0, -4.5 + (i / 8)));
+				if (i % 16 == 0) {
+					query_parameters->set_navigation_layers(2);
+				}
+				batch_parameters.push_back(query_parameters);
+
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				batch_results.push_back(query_result);
+			}
+
+			CallableMock callback_mock;
+			navigation_server->query_paths_async(batch_parameters, batch_results, callable_mp(&callback_mock, &CallableMock::function0));
+			CHECK_EQ(callback_mock.function0_calls, 0);
+
+			// Results are delivered at the latest on the second sync.
+			navigation_server->process(0.0);
+			navigation_server->process(0.0);
+			CHECK_EQ(callback_mock.function0_calls, 1);
+
+			for (int i = 0; i < query_count; i++) {
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				navigation_server->query_path(batch_parameters[i], query_result);
+
+				Ref<NavigationPathQueryResult3D> batch_result = batch_results[i];
+				CHECK_EQ(batch_result->get_path(), query_result->get_path());
+				CHECK_EQ(batch_result->get_path_rids(), query_result->get_path_rids());
+				CHECK_EQ(batch_result->get_path_length(), doctest::Approx(query_result->get_path_length()));
+				CHECK_EQ(batch_result->get_path().is_empty(), i % 16 == 0);
+			}
+		}
+
+		SUBCASE("Batched async queries should survive freeing their map") {
+			RID other_map = navigation_server->map_create();
+			RID other_region = navigation_server->region_create();
+			navigation_server->map_set_active(other_map, true);
+			navigation_server->map_set_use_async_iterations(other_map, false);
+			navigation_server->region_set_use_async_iterations(other_region, false);
+			navigation_server->region_set_map(other_region, other_map);
+			navigation_server->region_set_navigation_mesh(other_region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(other_map);
+			query_parameters->set_start_position(Vector3(10, 0, 10));
+			query_parameters->set_target_position(Vector3(0, 0, 0));
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+
+			CallableMock callback_mock;
+			navigation_server->query_paths_async({ query_parameters }, { query_result }, callable_mp(&callback_mock, &CallableMock::function0));
+			navigation_server->free_rid(other_region);
+			navigation_server->free_rid(other_map);
+			navigation_server->physics_process(0.0); // Frees the map while the batch may still run.
+			navigation_server->process(0.0);
+			navigation_server->process(0.0);
+			CHECK_EQ(callback_mock.function0_calls, 1);
+			CHECK_NE(query_result->get_path().size(), 0);
+		}
+
+		navigation_server->free_rid(region);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should find paths with hierarchical pathfinding") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = bake_box_navigation_mesh(navigation_server, Vector3(40.0, 0.001, 40.0));
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID maps[2];
+		RID regions[2];
+		create_map_pair(navigation_server, navigation_mesh, maps, regions);
+		navigation_server->map_set_use_hierarchical_pathfinding(maps[1], true);
+		navigation_server->map_set_hierarchical_cluster_size(maps[1], 4.0);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		CHECK_FALSE(navigation_server->map_get_use_hierarchical_pathfinding(maps[0]));
+		CHECK(navigation_server->map_get_use_hierarchical_pathfinding(maps[1]));
+		CHECK_EQ(navigation_server->map_get_hierarchical_cluster_size(maps[1]), doctest::Approx(4.0));
+
+		const Vector3 endpoints[][2] = {
+			{ Vector3(-19, 0, -19), Vector3(19, 0, 19) },
+			{ Vector3(19, 0, -19), Vector3(-19, 0, 19) },
+			{ Vector3(-19, 0, 0), Vector3(19, 0, 1) },
+			{ Vector3(0.5, 0, 0.5), Vector3(1, 0, 1) },
+		};
+
+		for (const Vector3 *endpoint : endpoints) {
+			Ref<NavigationPathQueryResult3D> query_results[2];
+			query_path_on_map_pair(navigation_server, maps, endpoint[0], endpoint[1], query_results);
+
+			const Vector<Vector3> &full_path = query_results[0]->get_path();
+			const Vector<Vector3> &hierarchical_path = query_results[1]->get_path();
+			REQUIRE_GE(hierarchical_path.size(), 2);
+			CHECK(hierarchical_path[0].is_equal_approx(full_path[0]));
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(full_path[full_path.size() - 1]));
+			CHECK_LE(query_results[1]->get_path_length(), query_results[0]->get_path_length() * 1.05);
+		}
+
+		// Region filters skip the cluster graph and keep their meaning.
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(maps[1]);
+		query_parameters->set_start_position(endpoints[0][0]);
+		query_parameters->set_target_position(endpoints[0][1]);
+		query_parameters->set_excluded_regions({ regions[1] });
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+		navigation_server->query_path(query_parameters, query_result);
+		CHECK_EQ(query_result->get_path().size(), 0);
+
+		free_map_pair(navigation_server, maps, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should search only the cluster corridor with hierarchical pathfinding") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A 40x40 grid of 1x1 polygons with a pocket that opens towards the start position.
+		// The full search floods the pocket before it goes around, the cluster corridor leaves it out.
+		// The walls are 4 cells thick and lie on the cluster borders, so no cluster spans a wall.
+		const int grid_size = 40;
+		const Rect2i walls[] = {
+			Rect2i(24, 4, 4, 32),
+			Rect2i(8, 4, 16, 4),
+			Rect2i(8, 32, 16, 4),
+		};
+
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= grid_size; z++) {
+			for (int x = 0; x <= grid_size; x++) {
+				vertices.push_back(Vector3(x - grid_size / 2, 0.0, z - grid_size / 2));
+			}
+		}
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < grid_size; z++) {
+			for (int x = 0; x < grid_size; x++) {
+				bool is_wall = false;
+				for (const Rect2i &wall : walls) {
+					is_wall = is_wall || wall.has_point(Point2i(x, z));
+				}
+				if (is_wall) {
+					continue;
+				}
+				const int vertex = z * (grid_size + 1) + x;
+				navigation_mesh->add_polygon({ vertex, vertex + 1, vertex + grid_size + 2, vertex + grid_size + 1 });
+			}
+		}
+
+		RID maps[2];
+		RID regions[2];
+		create_map_pair(navigation_server, navigation_mesh, maps, regions);
+		navigation_server->map_set_use_hierarchical_pathfinding(maps[1], true);
+		navigation_server->map_set_hierarchical_cluster_size(maps[1], 4.0);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		// Query one map per sync, so the searched polygon counts can be told apart.
+		const Vector3 start_position = Vector3(-17.5, 0, 0.5);
+		const Vector3 target_position = Vector3(17.5, 0, 0.5);
+		Ref<NavigationPathQueryResult3D> query_results[2];
+		int search_polygon_counts[2];
+		for (int i = 0; i < 2; i++) {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(maps[i]);
+			query_parameters->set_start_position(start_position);
+			query_parameters->set_target_position(target_position);
+			query_results[i].instantiate();
+			navigation_server->query_path(query_parameters, query_results[i]);
+
+			navigation_server->physics_process(0.0); // Collects the search counters.
+			search_polygon_counts[i] = navigation_server->get_process_info(NavigationServer3D::INFO_PATH_SEARCH_POLYGON_COUNT);
+		}
+
+		const Vector<Vector3> &full_path = query_results[0]->get_path();
+		const Vector<Vector3> &hierarchical_path = query_results[1]->get_path();
+		REQUIRE_GE(full_path.size(), 2);
+		REQUIRE_GE(hierarchical_path.size(), 2);
+		CHECK(full_path[full_path.size() - 1].is_equal_approx(target_position));
+		CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(target_position));
+		CHECK_LE(query_results[1]->get_path_length(), query_results[0]->get_path_length() * 1.05);
+
+		// A search that falls back to the whole map visits at least as many polygons as the full search.
+		CHECK_GT(search_polygon_counts[1], 0);
+		CHECK_LT(search_polygon_counts[1], search_polygon_counts[0]);
+
+		free_map_pair(navigation_server, maps, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should reuse cached path corridors") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = bake_box_navigation_mesh(navigation_server, Vector3(20.0, 0.001, 20.0));
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID maps[2];
+		RID regions[2];
+		create_map_pair(navigation_server, navigation_mesh, maps, regions);
+		navigation_server->map_set_use_path_cache(maps[1], true);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		CHECK_FALSE(navigation_server->map_get_use_path_cache(maps[0]));
+		CHECK(navigation_server->map_get_use_path_cache(maps[1]));
+
+		// Slightly different positions in the same polygons share the corridor, but not the path ends.
+		const Vector3 endpoints[][2] = {
+			{ Vector3(-9, 0, -9), Vector3(9, 0, 9) },
+			{ Vector3(-9, 0, -9), Vector3(9, 0, 9) },
+			{ Vector3(-9.1, 0, -9.1), Vector3(9.1, 0, 9.1) },
+		};
+
+		for (const Vector3 *endpoint : endpoints) {
+			Ref<NavigationPathQueryResult3D> query_results[2];
+			query_path_on_map_pair(navigation_server, maps, endpoint[0], endpoint[1], query_results);
+
+			CHECK_EQ(query_results[1]->get_path(), query_results[0]->get_path());
+			CHECK_EQ(query_results[1]->get_path_rids(), query_results[0]->get_path_rids());
+		}
+
+		navigation_server->physics_process(0.0); // Collects the cache counters.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT), 1);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 2);
+
+		SUBCASE("A new map iteration should start with an empty cache") {
+			navigation_server->region_set_navigation_layers(regions[1], 3);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(maps[1]);
+			query_parameters->set_start_position(endpoints[0][0]);
+			query_parameters->set_target_position(endpoints[0][1]);
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_NE(query_result->get_path().size(), 0);
+
+			navigation_server->physics_process(0.0); // Collects the cache counters.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 0);
+		}
+
+		free_map_pair(navigation_server, maps, regions);
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation meshes") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(40.0, 0.001, 40.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_mesh->set_tile_size(8.0);
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		CHECK_GT(navigation_mesh->get_bake_tiles().size(), 1);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		// The path crosses many tiles, so the tile borders have to be connected.
+		Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-19, 0, -19), Vector3(19, 0, 19), true);
+		REQUIRE_GE(path.size(), 2);
+		CHECK(path[path.size() - 1].distance_to(Vector3(19, 0, 19)) < 1.0);
+
+		SUBCASE("Unchanged tiles should be reused") {
+			const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+			const HashMap<Vector2i, NavigationMesh::BakeTile> bake_tiles = navigation_mesh->get_bake_tiles();
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(navigation_mesh->get_vertices(), vertices);
+
+			// Reused tiles share their data with the previous bake instead of holding an identical copy.
+			const HashMap<Vector2i, NavigationMesh::BakeTile> rebaked_tiles = navigation_mesh->get_bake_tiles();
+			REQUIRE_EQ(rebaked_tiles.size(), bake_tiles.size());
+			int reused_tile_count = 0;
+			for (const KeyValue<Vector2i, NavigationMesh::BakeTile> &E : rebaked_tiles) {
+				REQUIRE(bake_tiles.has(E.key));
+				reused_tile_count += E.value.vertices.ptr() == bake_tiles[E.key].vertices.ptr();
+			}
+			CHECK_EQ(reused_tile_count, bake_tiles.size());
+		}
+
+		SUBCASE("Changed tiles should be rebaked") {
+			const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+			const HashMap<Vector2i, NavigationMesh::BakeTile> bake_tiles = navigation_mesh->get_bake_tiles();
+			// Far enough from the tile seams for the neighbor tiles' borders not to reach it.
+			source_geometry->add_projected_obstruction({ Vector3(3, 0, 3), Vector3(5, 0, 3), Vector3(5, 0, 5), Vector3(3, 0, 5) }, -1.0, 2.0, true);
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_NE(navigation_mesh->get_vertices(), vertices);
+
+			// Tiles far away from the obstruction keep their source hash.
+			const HashMap<Vector2i, NavigationMesh::BakeTile> rebaked_tiles = navigation_mesh->get_bake_tiles();
+			REQUIRE(rebaked_tiles.has(Vector2i(-3, -3)));
+			CHECK_EQ(rebaked_tiles[Vector2i(-3, -3)].source_hash, bake_tiles[Vector2i(-3, -3)].source_hash);
+			CHECK_NE(rebaked_tiles[Vector2i(0, 0)].source_hash, bake_tiles[Vector2i(0, 0)].source_hash);
+			CHECK_EQ(rebaked_tiles[Vector2i(-3, -3)].mesh_hash, bake_tiles[Vector2i(-3, -3)].mesh_hash);
+			CHECK_NE(rebaked_tiles[Vector2i(0, 0)].mesh_hash, bake_tiles[Vector2i(0, 0)].mesh_hash);
+
+			// Only the tile under the obstruction was baked again, the others share their data with the previous bake.
+			REQUIRE_EQ(rebaked_tiles.size(), bake_tiles.size());
+			int rebaked_tile_count = 0;
+			for (const KeyValue<Vector2i, NavigationMesh::BakeTile> &E : rebaked_tiles) {
+				REQUIRE(bake_tiles.has(E.key));
+				rebaked_tile_count += E.value.vertices.ptr() != bake_tiles[E.key].vertices.ptr();
+			}
+			CHECK_EQ(rebaked_tile_count, 1);
+			CHECK_NE(rebaked_tiles[Vector2i(0, 0)].vertices.ptr(), bake_tiles[Vector2i(0, 0)].vertices.ptr());
+
+			// The region stitches the rebaked tiles between the ones it already built.
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			path = navigation_server->map_get_path(map, Vector3(-19, 0, -19), Vector3(19, 0, 19), true);
+			REQUIRE_GE(path.size(), 2);
+			CHECK(path[path.size() - 1].distance_to(Vector3(19, 0, 19)) < 1.0);
+		}
+
+		SUBCASE("Obstructions on tile seams should keep the tiles connected") {
+			// Straddles the seam at x = 0, so both tiles trace the obstruction outline along the seam
+			// with vertices the other tile does not have.
+			source_geometry->add_projected_obstruction({ Vector3(-1.3, 0, 2.6), Vector3(1.1, 0, 2.6), Vector3(1.1, 0, 5.2), Vector3(-1.3, 0, 5.2) }, -1.0, 2.0, true);
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			path = navigation_server->map_get_path(map, Vector3(-6, 0, 4), Vector3(6, 0, 4), true);
+			REQUIRE_GE(path.size(), 3);
+			CHECK(path[0].distance_to(Vector3(-6, 0, 4)) < 1.0);
+			CHECK(path[path.size() - 1].distance_to(Vector3(6, 0, 4)) < 1.0);
+
+			// Every seam edge between the two tiles is shared by a polygon on each side.
+			const Vector<Vector3> vertices = navigation_mesh->get_vertices();
+			HashMap<Vector2i, int> seam_edges;
+			for (int i = 0; i < navigation_mesh->get_polygon_count(); i++) {
+				const Vector<int> polygon = navigation_mesh->get_polygon(i);
+				for (int j = 0; j < polygon.size(); j++) {
+					const int a = polygon[j];
+					const int b = polygon[(j + 1) % polygon.size()];
+					if (Math::abs(vertices[a].x) < 0.01 && Math::abs(vertices[b].x) < 0.01 && vertices[a].z > -0.01 && vertices[b].z > -0.01 && vertices[a].z < 8.01 && vertices[b].z < 8.01) {
+						seam_edges[Vector2i(MIN(a, b), MAX(a, b))] += 1;
+					}
+				}
+			}
+			CHECK_FALSE(seam_edges.is_empty());
+			for (const KeyValue<Vector2i, int> &seam_edge : seam_edges) {
+				CHECK_EQ(seam_edge.value, 2);
+			}
+		}
+
 		navigation_server->free_rid(region);
 		navigation_server->free_rid(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
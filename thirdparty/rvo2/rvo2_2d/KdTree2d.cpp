@@ -37,16 +37,29 @@
 #include "Obstacle2d.h"
 
 namespace RVO2D {
-	KdTree2D::KdTree2D(RVOSimulator2D *sim) : obstacleTree_(NULL), sim_(sim) { }
+	KdTree2D::KdTree2D(RVOSimulator2D *sim) : obstacleTree_(NULL), dynamicObstacleTree_(NULL), sim_(sim) { }
 
 	KdTree2D::~KdTree2D()
 	{
 		deleteObstacleTree(obstacleTree_);
+		deleteObstacleTree(dynamicObstacleTree_);
+
+		for (size_t i = 0; i < obstacleTreeNodePool_.size(); ++i) {
+			delete obstacleTreeNodePool_[i];
+		}
+
+		for (size_t i = 0; i < dynamicObstacles_.size(); ++i) {
+			delete dynamicObstacles_[i];
+		}
+
+		for (size_t i = 0; i < obstaclePool_.size(); ++i) {
+			delete obstaclePool_[i];
+		}
 	}
 
-	void KdTree2D::buildAgentTree(std::vector<Agent2D *> agents)
+	void KdTree2D::buildAgentTree(const std::vector<Agent2D *> &agents)
 	{
-		agents_.swap(agents);
+		agents_ = agents;
 
 		if (!agents_.empty()) {
 			agentTree_.resize(2 * agents_.size() - 1);
@@ -105,21 +118,104 @@ namespace RVO2D {
 		}
 	}
 
-	void KdTree2D::buildObstacleTree(std::vector<Obstacle2D *> obstacles)
+	void KdTree2D::refitAgentTree()
 	{
-		deleteObstacleTree(obstacleTree_);
+		if (!agents_.empty()) {
+			refitAgentTreeRecursive(0);
+		}
+	}
+
+	void KdTree2D::refitAgentTreeRecursive(size_t node)
+	{
+		AgentTreeNode &treeNode = agentTree_[node];
+
+		if (treeNode.end - treeNode.begin > MAX_LEAF_SIZE) {
+			refitAgentTreeRecursive(treeNode.left);
+			refitAgentTreeRecursive(treeNode.right);
+
+			const AgentTreeNode &leftNode = agentTree_[treeNode.left];
+			const AgentTreeNode &rightNode = agentTree_[treeNode.right];
+
+			treeNode.minX = std::min(leftNode.minX, rightNode.minX);
+			treeNode.maxX = std::max(leftNode.maxX, rightNode.maxX);
+			treeNode.minY = std::min(leftNode.minY, rightNode.minY);
+			treeNode.maxY = std::max(leftNode.maxY, rightNode.maxY);
+		}
+		else {
+			treeNode.minX = treeNode.maxX = agents_[treeNode.begin]->position_.x();
+			treeNode.minY = treeNode.maxY = agents_[treeNode.begin]->position_.y();
+
+			for (size_t i = treeNode.begin + 1; i < treeNode.end; ++i) {
+				treeNode.maxX = std::max(treeNode.maxX, agents_[i]->position_.x());
+				treeNode.minX = std::min(treeNode.minX, agents_[i]->position_.x());
+				treeNode.maxY = std::max(treeNode.maxY, agents_[i]->position_.y());
+				treeNode.minY = std::min(treeNode.minY, agents_[i]->position_.y());
+			}
+		}
+	}
+
+	void KdTree2D::buildObstacleTree(const std::vector<Obstacle2D *> &obstacles)
+	{
+		releaseObstacleTree(obstacleTree_);
 
-		obstacleTree_ = buildObstacleTreeRecursive(obstacles);
+		/* Split obstacles are appended to the simulator obstacles, which may be the list passed in. */
+		obstacleBuildList_ = obstacles;
+		obstacleTree_ = buildObstacleTreeRecursive(obstacleBuildList_, sim_->obstacles_);
 	}
 
+	void KdTree2D::buildDynamicObstacleTree()
+	{
+		releaseObstacleTree(dynamicObstacleTree_);
+
+		obstacleBuildList_ = dynamicObstacles_;
+		dynamicObstacleTree_ = buildObstacleTreeRecursive(obstacleBuildList_, dynamicObstacles_);
+	}
+
+	Obstacle2D *KdTree2D::allocateObstacle()
+	{
+		if (obstaclePool_.empty()) {
+			return new Obstacle2D();
+		}
+
+		Obstacle2D *const obstacle = obstaclePool_.back();
+		obstaclePool_.pop_back();
+		*obstacle = Obstacle2D();
+		return obstacle;
+	}
+
+	void KdTree2D::releaseObstacles(std::vector<Obstacle2D *> &obstacles)
+	{
+		obstaclePool_.insert(obstaclePool_.end(), obstacles.begin(), obstacles.end());
+		obstacles.clear();
+	}
+
+	KdTree2D::ObstacleTreeNode *KdTree2D::allocateObstacleTreeNode()
+	{
+		if (obstacleTreeNodePool_.empty()) {
+			return new ObstacleTreeNode;
+		}
+
+		ObstacleTreeNode *const node = obstacleTreeNodePool_.back();
+		obstacleTreeNodePool_.pop_back();
+		return node;
+	}
+
+	void KdTree2D::releaseObstacleTree(ObstacleTreeNode *node)
+	{
+		if (node != NULL) {
+			releaseObstacleTree(node->left);
+			releaseObstacleTree(node->right);
+			obstacleTreeNodePool_.push_back(node);
+		}
+	}
 
-	KdTree2D::ObstacleTreeNode *KdTree2D::buildObstacleTreeRecursive(const std::vector<Obstacle2D *> &obstacles)
+	KdTree2D::ObstacleTreeNode *KdTree2D::buildObstacleTreeRecursive(const std::vector<Obstacle2D *> &obstacles, std::vector<Obstacle2D *> &splitObstacles)
 	{
 		if (obstacles.empty()) {
 			return NULL;
 		}
 		else {
-			ObstacleTreeNode *const node = new ObstacleTreeNode;
+			ObstacleTreeNode *const node = allocateObstacleTreeNode();
 
 			size_t optimalSplit = 0;
 			size_t minLeft = obstacles.size();
@@ -201,16 +297,16 @@ namespace RVO2D {
 
 					const Vector2 splitpoint = obstacleJ1->point_ + t * (obstacleJ2->point_ - obstacleJ1->point_);
 
-					Obstacle2D *const newObstacle = new Obstacle2D();
+					Obstacle2D *const newObstacle = allocateObstacle();
 					newObstacle->point_ = splitpoint;
 					newObstacle->prevObstacle_ = obstacleJ1;
 					newObstacle->nextObstacle_ = obstacleJ2;
 					newObstacle->isConvex_ = true;
 					newObstacle->unitDir_ = obstacleJ1->unitDir_;
 
-					newObstacle->id_ = sim_->obstacles_.size();
+					newObstacle->id_ = splitObstacles.size();
 
-					sim_->obstacles_.push_back(newObstacle);
+					splitObstacles.push_back(newObstacle);
 
 					obstacleJ1->nextObstacle_ = newObstacle;
 					obstacleJ2->prevObstacle_ = newObstacle;
@@ -227,8 +323,8 @@ namespace RVO2D {
 			}
 
 			node->obstacle = obstacleI1;
-			node->left = buildObstacleTreeRecursive(leftObstacles);
-			node->right = buildObstacleTreeRecursive(rightObstacles);
+			node->left = buildObstacleTreeRecursive(leftObstacles, splitObstacles);
+			node->right = buildObstacleTreeRecursive(rightObstacles, splitObstacles);
 			return node;
 		}
 	}
@@ -241,6 +337,7 @@ namespace RVO2D {
 	void KdTree2D::computeObstacleNeighbors(Agent2D *agent, float rangeSq) const
 	{
 		queryObstacleTreeRecursive(agent, rangeSq, obstacleTree_);
+		queryObstacleTreeRecursive(agent, rangeSq, dynamicObstacleTree_);
 	}
 
 	void KdTree2D::deleteObstacleTree(ObstacleTreeNode *node)
@@ -319,7 +416,7 @@ namespace RVO2D {
 
 	bool KdTree2D::queryVisibility(const Vector2 &q1, const Vector2 &q2, float radius) const
 	{
-		return queryVisibilityRecursive(q1, q2, radius, obstacleTree_);
+		return queryVisibilityRecursive(q1, q2, radius, obstacleTree_) && queryVisibilityRecursive(q1, q2, radius, dynamicObstacleTree_);
 	}
 
 	bool KdTree2D::queryVisibilityRecursive(const Vector2 &q1, const Vector2 &q2, float radius, const ObstacleTreeNode *node) const
@@ -128,17 +128,46 @@ namespace RVO2D {
 		/**
 		 * \brief      Builds an agent <i>k</i>d-tree.
 		 */
-		void buildAgentTree(std::vector<Agent2D *> agents);
+		void buildAgentTree(const std::vector<Agent2D *> &agents);
 
 		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
 
+		/**
+		 * \brief      Updates the bounds of the agent <i>k</i>d-tree for the
+		 *             current agent positions without repartitioning it. The
+		 *             agents must be the same as in the last build.
+		 */
+		void refitAgentTree();
+
+		void refitAgentTreeRecursive(size_t node);
+
 		/**
 		 * \brief      Builds an obstacle <i>k</i>d-tree.
 		 */
-		void buildObstacleTree(std::vector<Obstacle2D *> obstacles);
+		void buildObstacleTree(const std::vector<Obstacle2D *> &obstacles);
+
+		/**
+		 * \brief      Builds the dynamic obstacle <i>k</i>d-tree from
+		 *             dynamicObstacles_. It is queried together with the
+		 *             static obstacle tree, so obstacles that change often can
+		 *             be rebuilt without touching the static ones.
+		 */
+		void buildDynamicObstacleTree();
 
 		ObstacleTreeNode *buildObstacleTreeRecursive(const std::vector<Obstacle2D *> &
-													 obstacles);
+													 obstacles, std::vector<Obstacle2D *> &splitObstacles);
+
+		/**
+		 * \brief      Returns a reset obstacle, reusing a released one if
+		 *             possible.
+		 */
+		Obstacle2D *allocateObstacle();
+
+		/**
+		 * \brief      Releases all obstacles in the list for reuse and clears
+		 *             the list.
+		 */
+		void releaseObstacles(std::vector<Obstacle2D *> &obstacles);
 
 		/**
 		 * \brief      Computes the agent neighbors of the specified agent.
@@ -163,6 +192,14 @@ namespace RVO2D {
 		 */
 		void deleteObstacleTree(ObstacleTreeNode *node);
 
+		ObstacleTreeNode *allocateObstacleTreeNode();
+
+		/**
+		 * \brief      Releases the specified obstacle tree node and its
+		 *             children for reuse.
+		 */
+		void releaseObstacleTree(ObstacleTreeNode *node);
+
 		void queryAgentTreeRecursive(Agent2D *agent, float &rangeSq,
 									 size_t node) const;
 
@@ -191,6 +228,11 @@ namespace RVO2D {
 		std::vector<Agent2D *> agents_;
 		std::vector<AgentTreeNode> agentTree_;
 		ObstacleTreeNode *obstacleTree_;
+		ObstacleTreeNode *dynamicObstacleTree_;
+		std::vector<Obstacle2D *> dynamicObstacles_;
+		std::vector<Obstacle2D *> obstaclePool_;
+		std::vector<ObstacleTreeNode *> obstacleTreeNodePool_;
+		std::vector<Obstacle2D *> obstacleBuildList_;
 		RVOSimulator2D *sim_;
 
 		static const size_t MAX_LEAF_SIZE = 10;
@@ -43,9 +43,9 @@ namespace RVO3D {
 
 	KdTree3D::KdTree3D(RVOSimulator3D *sim) : sim_(sim) { }
 
-	void KdTree3D::buildAgentTree(std::vector<Agent3D *> agents)
+	void KdTree3D::buildAgentTree(const std::vector<Agent3D *> &agents)
 	{
-		agents_.swap(agents);
+		agents_ = agents;
 
 		if (!agents_.empty()) {
 			agentTree_.resize(2 * agents_.size() - 1);
@@ -121,6 +121,42 @@ namespace RVO3D {
 		}
 	}
 
+	void KdTree3D::refitAgentTree()
+	{
+		if (!agents_.empty()) {
+			refitAgentTreeRecursive(0);
+		}
+	}
+
+	void KdTree3D::refitAgentTreeRecursive(size_t node)
+	{
+		AgentTreeNode3D &treeNode = agentTree_[node];
+
+		if (treeNode.end - treeNode.begin > RVO3D_MAX_LEAF_SIZE) {
+			refitAgentTreeRecursive(treeNode.left);
+			refitAgentTreeRecursive(treeNode.right);
+
+			const AgentTreeNode3D &leftNode = agentTree_[treeNode.left];
+			const AgentTreeNode3D &rightNode = agentTree_[treeNode.right];
+
+			for (size_t i = 0; i < 3; ++i) {
+				treeNode.minCoord[i] = std::min(leftNode.minCoord[i], rightNode.minCoord[i]);
+				treeNode.maxCoord[i] = std::max(leftNode.maxCoord[i], rightNode.maxCoord[i]);
+			}
+		}
+		else {
+			treeNode.minCoord = agents_[treeNode.begin]->position_;
+			treeNode.maxCoord = agents_[treeNode.begin]->position_;
+
+			for (size_t i = treeNode.begin + 1; i < treeNode.end; ++i) {
+				for (size_t j = 0; j < 3; ++j) {
+					treeNode.maxCoord[j] = std::max(treeNode.maxCoord[j], agents_[i]->position_[j]);
+					treeNode.minCoord[j] = std::min(treeNode.minCoord[j], agents_[i]->position_[j]);
+				}
+			}
+		}
+	}
+
 	void KdTree3D::computeAgentNeighbors(Agent3D *agent, float rangeSq) const
 	{
 		queryAgentTreeRecursive(agent, rangeSq, 0);
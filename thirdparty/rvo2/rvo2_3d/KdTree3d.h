@@ -95,10 +95,19 @@ namespace RVO3D {
 		/**
 		 * \brief   Builds an agent <i>k</i>d-tree.
 		 */
-		void buildAgentTree(std::vector<Agent3D *> agents);
+		void buildAgentTree(const std::vector<Agent3D *> &agents);
 
 		void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
 
+		/**
+		 * \brief   Updates the bounds of the agent <i>k</i>d-tree for the
+		 *          current agent positions without repartitioning it. The agents
+		 *          must be the same as in the last build.
+		 */
+		void refitAgentTree();
+
+		void refitAgentTreeRecursive(size_t node);
+
 		/**
 		 * \brief   Computes the agent neighbors of the specified agent.
 		 * \param   agent    A pointer to the agent for which agent neighbors are to be computed.